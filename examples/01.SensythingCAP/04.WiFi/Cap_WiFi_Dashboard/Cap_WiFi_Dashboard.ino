@@ -99,8 +99,8 @@ void setup() {
     }
     
     Serial.println("✓ Platform initialized successfully");
-    Serial.println("ℹ️  Board: " + sensything.getBoardName());
-    Serial.println("ℹ️  Sensor: " + sensything.getSensorType());
+    Serial.printf("ℹ️  Board: %s\n", sensything.getBoardName());
+    Serial.printf("ℹ️  Sensor: %s\n", sensything.getSensorType());
     Serial.println();
     
     // Initialize WiFi
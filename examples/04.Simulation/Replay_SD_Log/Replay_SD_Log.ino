@@ -0,0 +1,70 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2025 Ashwin Whitchurch, Protocentral Electronics <info@protocentral.com>
+//
+// Sensything Replay - SD Log Playback Example
+// ==================================================================================
+// This example plays a CSV log recorded by the SD logger examples back through the
+// full streaming pipeline. The replayed data looks like a live Cap or OX board to
+// USB, BLE, WiFi and the web dashboard, so field captures can be used to test
+// dashboards and sinks, or replayed flat-out to stress throughput.
+//
+// Hardware Required:
+// - Protocentral Sensything Cap or OX board (any ESP32-S3 with the same SDIO wiring)
+// - MicroSD card holding a sensything_N.csv file (CSV format with header)
+// - USB cable for power and data
+//
+// Arduino IDE Setup:
+// - Board: "ESP32S3 Dev Module"
+// - USB Mode: "Hardware CDC and JTAG"
+// - USB CDC on Boot: "Enabled"
+// - Upload Mode: "UART0 / Hardware CDC"
+// - Upload Speed: 921600
+//
+// Required Libraries:
+// - Sensything Platform (this library)
+//
+//    Serial Monitor Settings:
+//    - Baud Rate: 115200
+//    - Line Ending: Newline
+//
+//    Available Commands (type in Serial Monitor):
+//    - replay speed <x>   : Playback speed (e.g., "replay speed 4" for 4x)
+//    - replay speed max   : As fast as the sinks accept samples
+//    - replay loop on|off : Restart at the end of the file
+//    - replay restart     : Rewind to the first record
+//    - status             : Records replayed, progress, dropped samples
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#include <SensythingCore.h>
+
+// Log file to play back (written by SensythingSDCard)
+SensythingReplay sensything(SD_MMC, "/sensything_1.csv");
+
+void setup() {
+    // Mount the SD card first; the replay board opens its file in initPlatform()
+    Serial.begin(115200);
+    if (!sensything.initSDCard()) {
+        while (1) {
+            delay(1000);
+        }
+    }
+    
+    if (!sensything.initPlatform()) {
+        while (1) {
+            delay(1000);
+        }
+    }
+    
+    // Real time, looping; use setSpeed(0) for flat-out playback
+    sensything.setSpeed(1.0);
+    sensything.setLoop(true);
+}
+
+void loop() {
+    // Streams each record when its recorded time comes up
+    sensything.update();
+}
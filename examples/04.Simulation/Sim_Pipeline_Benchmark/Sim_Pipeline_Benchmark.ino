@@ -0,0 +1,67 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2025 Ashwin Whitchurch, Protocentral Electronics <info@protocentral.com>
+//
+// Sensything Sim - Pipeline Benchmark Example
+// ==================================================================================
+// This example runs the full streaming pipeline on synthetic data, so throughput
+// and heap use can be measured on any ESP32-S3 without a Cap or OX sensor. The
+// simulated board reports itself as a Cap (or OX) board, so every sink, the web
+// dashboard and the host tools behave exactly as with real hardware.
+//
+// Hardware Required:
+// - Any ESP32-S3 board
+// - USB cable for power and data
+//
+// Arduino IDE Setup:
+// - Board: "ESP32S3 Dev Module"
+// - USB Mode: "Hardware CDC and JTAG"
+// - USB CDC on Boot: "Enabled"
+// - Upload Mode: "UART0 / Hardware CDC"
+// - Upload Speed: 921600
+//
+// Required Libraries:
+// - Sensything Platform (this library)
+//
+//    Serial Monitor Settings:
+//    - Baud Rate: 115200
+//    - Line Ending: Newline
+//
+//    Available Commands (type in Serial Monitor):
+//    - sim rate <hz>  : Free-running generation rate (e.g., "sim rate 2000")
+//    - sim rate 0     : Back to one sample per sample interval
+//    - sim noise <f>  : Noise as a fraction of the signal amplitude
+//    - usb_format binary : Compare CSV and binary USB throughput
+//    - status         : Generated samples/s, skipped and dropped samples, heap
+//
+//    Benchmark Notes:
+//    - "skipped" counts samples the generator dropped because update() fell
+//      more than 100 ms behind; "dropped" counts samples the sinks could not
+//      take in time. Both at zero means the pipeline keeps up with the rate.
+//    - Use SensythingSim sensything(SENSYTHING_SIM_OX) for PPG-shaped data.
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#include <SensythingCore.h>
+
+// Create a simulated Cap board
+SensythingSim sensything(SENSYTHING_SIM_CAP);
+
+void setup() {
+    // Initialize the platform (simulated sensor + USB communication)
+    if (!sensything.initPlatform()) {
+        while (1) {
+            delay(1000);
+        }
+    }
+    
+    // Generate 1000 samples/s regardless of the sample interval
+    sensything.setGenerationRate(1000);
+}
+
+void loop() {
+    // Generates, queues and streams every sample that is due
+    sensything.update();
+}
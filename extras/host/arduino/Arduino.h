@@ -0,0 +1,335 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Host Build - Arduino Core Stand-in
+//    The subset of the Arduino-ESP32 core the library uses, on top of the C++ runtime
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SENSYTHING_HOST_ARDUINO_H
+#define SENSYTHING_HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+#include <algorithm>
+#include <string>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define HEX 16
+#define DEC 10
+#define PROGMEM
+#define PGM_P const char*
+#define IRAM_ATTR
+#define RISING 0x01
+#define FALLING 0x02
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+#define HIGH 0x1
+#define LOW 0x0
+#define MSBFIRST 1
+#define SPI_MODE0 0
+#define SERIAL_8N1 0x800001c
+
+using std::min;
+using std::max;
+
+template <typename T, typename L, typename H>
+T constrain(T value, L low, H high) {
+    return value < low ? low : (value > high ? high : value);
+}
+
+// =================================================================================================
+// STRING
+// =================================================================================================
+
+/**
+ * Arduino String over std::string; allocates like the real one, so the host
+ * heap counters see the same allocation pattern
+ */
+class String {
+public:
+    String() {}
+    String(const char* text) : text(text ? text : "") {}
+    String(const std::string& text) : text(text) {}
+    String(char c) : text(1, c) {}
+    String(int value, unsigned char base = DEC) { fromSigned(value, base); }
+    String(long value, unsigned char base = DEC) { fromSigned(value, base); }
+    String(unsigned int value, unsigned char base = DEC) { fromUnsigned(value, base); }
+    String(unsigned long value, unsigned char base = DEC) { fromUnsigned(value, base); }
+    String(unsigned long long value, unsigned char base = DEC) { fromUnsigned(value, base); }
+    String(float value, unsigned int decimals = 2) { fromDouble(value, decimals); }
+    String(double value, unsigned int decimals = 2) { fromDouble(value, decimals); }
+
+    const char* c_str() const { return text.c_str(); }
+    unsigned int length() const { return (unsigned int)text.size(); }
+    bool isEmpty() const { return text.empty(); }
+    bool reserve(unsigned int size) { text.reserve(size); return true; }
+
+    String& operator+=(const String& other) { text += other.text; return *this; }
+    String& operator+=(const char* other) { text += other; return *this; }
+    String& operator+=(char c) { text += c; return *this; }
+    String& operator+=(int value) { return *this += String(value); }
+    String& operator+=(unsigned int value) { return *this += String(value); }
+    String& operator+=(long value) { return *this += String(value); }
+    String& operator+=(unsigned long value) { return *this += String(value); }
+    bool concat(const String& other) { text += other.text; return true; }
+
+    bool operator==(const String& other) const { return text == other.text; }
+    bool operator==(const char* other) const { return text == (other ? other : ""); }
+    bool operator!=(const String& other) const { return text != other.text; }
+    bool operator!=(const char* other) const { return !(*this == other); }
+    bool operator<(const String& other) const { return text < other.text; }
+    bool equals(const String& other) const { return text == other.text; }
+
+    char operator[](unsigned int index) const { return index < text.size() ? text[index] : 0; }
+    char charAt(unsigned int index) const { return (*this)[index]; }
+
+    bool startsWith(const String& prefix) const { return text.compare(0, prefix.text.size(), prefix.text) == 0; }
+    bool endsWith(const String& suffix) const {
+        return text.size() >= suffix.text.size() &&
+               text.compare(text.size() - suffix.text.size(), suffix.text.size(), suffix.text) == 0;
+    }
+    int indexOf(char c, unsigned int from = 0) const { return toIndex(text.find(c, from)); }
+    int indexOf(const String& s, unsigned int from = 0) const { return toIndex(text.find(s.text, from)); }
+    int lastIndexOf(char c) const { return toIndex(text.rfind(c)); }
+    String substring(unsigned int from) const { return from < text.size() ? text.substr(from) : std::string(); }
+    String substring(unsigned int from, unsigned int to) const {
+        if (from > to) std::swap(from, to);
+        return from < text.size() ? text.substr(from, to - from) : std::string();
+    }
+
+    void trim() {
+        size_t first = text.find_first_not_of(" \t\r\n");
+        size_t last = text.find_last_not_of(" \t\r\n");
+        text = (first == std::string::npos) ? std::string() : text.substr(first, last - first + 1);
+    }
+    void toLowerCase() { for (char& c : text) c = (char)tolower((unsigned char)c); }
+    void toUpperCase() { for (char& c : text) c = (char)toupper((unsigned char)c); }
+    void replace(const String& find, const String& with) {
+        if (find.text.empty()) return;
+        for (size_t at = text.find(find.text); at != std::string::npos; at = text.find(find.text, at + with.text.size())) {
+            text.replace(at, find.text.size(), with.text);
+        }
+    }
+    void remove(unsigned int index, unsigned int count = (unsigned int)-1) {
+        if (index < text.size()) text.erase(index, count);
+    }
+
+    long toInt() const { return atol(text.c_str()); }
+    float toFloat() const { return (float)atof(text.c_str()); }
+
+private:
+    std::string text;
+
+    static int toIndex(size_t at) { return at == std::string::npos ? -1 : (int)at; }
+    void fromUnsigned(unsigned long long value, unsigned char base) {
+        char digits[72];
+        snprintf(digits, sizeof(digits), base == HEX ? "%llx" : "%llu", value);
+        text = digits;
+    }
+    void fromSigned(long value, unsigned char base) {
+        if (base != DEC) {
+            fromUnsigned((unsigned long)value, base);
+            return;
+        }
+        text = std::to_string(value);
+    }
+    void fromDouble(double value, unsigned int decimals) {
+        char digits[352];
+        snprintf(digits, sizeof(digits), "%.*f", (int)decimals, value);
+        text = digits;
+    }
+};
+
+inline String operator+(const String& a, const String& b) { String out(a); out += b; return out; }
+inline String operator+(const String& a, const char* b) { String out(a); out += b; return out; }
+inline String operator+(const char* a, const String& b) { String out(a); out += b; return out; }
+inline String operator+(const String& a, char b) { String out(a); out += b; return out; }
+inline String operator+(char a, const String& b) { String out(a); out += b; return out; }
+
+// =================================================================================================
+// PRINT / STREAM / SERIAL
+// =================================================================================================
+
+class Print;
+
+class Printable {
+public:
+    virtual ~Printable() {}
+    virtual size_t printTo(Print& p) const = 0;
+};
+
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size) {
+        size_t n = 0;
+        while (size--) n += write(*buffer++);
+        return n;
+    }
+    size_t write(const char* buffer, size_t size) { return write((const uint8_t*)buffer, size); }
+    size_t write(const char* text) { return write((const uint8_t*)text, strlen(text)); }
+
+    size_t print(const String& s) { return write(s.c_str(), s.length()); }
+    size_t print(const char* s) { return write(s); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(int v, int base = DEC) { return print(String(v, (unsigned char)base)); }
+    size_t print(unsigned int v, int base = DEC) { return print(String(v, (unsigned char)base)); }
+    size_t print(long v, int base = DEC) { return print(String(v, (unsigned char)base)); }
+    size_t print(unsigned long v, int base = DEC) { return print(String(v, (unsigned char)base)); }
+    size_t print(double v, int decimals = 2) { return print(String(v, (unsigned int)decimals)); }
+    size_t print(const Printable& p) { return p.printTo(*this); }
+
+    size_t println() { return write("\r\n"); }
+    template <typename T>
+    size_t println(const T& v) { size_t n = print(v); return n + println(); }
+    template <typename T>
+    size_t println(const T& v, int format) { size_t n = print(v, format); return n + println(); }
+
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+    virtual void flush() {}
+};
+
+class Stream : public Print {
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+
+    void setTimeout(unsigned long ms) { timeoutMs = ms; }
+    String readStringUntil(char terminator);
+    size_t readBytes(uint8_t* buffer, size_t length);
+    size_t readBytes(char* buffer, size_t length) { return readBytes((uint8_t*)buffer, length); }
+
+protected:
+    unsigned long timeoutMs = 1000;
+};
+
+/**
+ * Console. Output goes to stdout unless a test captures or discards it;
+ * input comes from hostSerialInput(), so commands can be scripted.
+ */
+class HardwareSerial : public Stream {
+public:
+    void begin(unsigned long baud, uint32_t config = SERIAL_8N1) { (void)baud; (void)config; }
+    void end() {}
+    operator bool() const { return true; }
+
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* buffer, size_t size) override;
+    using Print::write;
+    int available() override;
+    int read() override;
+    int peek() override;
+    int availableForWrite() { return 4096; }
+    void flush() override;
+};
+
+extern HardwareSerial Serial;
+
+// Host controls for the console (see HostArduino.cpp)
+enum HostSerialOutput {
+    HOST_SERIAL_STDOUT,                          // Echo to stdout (default)
+    HOST_SERIAL_CAPTURE,                         // Keep in a buffer for hostSerialTakeOutput()
+    HOST_SERIAL_DISCARD                          // Count bytes only
+};
+void hostSerialSetOutput(HostSerialOutput mode);
+void hostSerialInput(const char* text);
+std::string hostSerialTakeOutput();
+uint64_t hostSerialBytesWritten();
+
+// =================================================================================================
+// TIME, PINS, INTERRUPTS
+// =================================================================================================
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+/**
+ * Move millis(), micros() and esp_timer_get_time() forward without waiting,
+ * so time-driven code can be run faster than real time. The cycle counter
+ * keeps real time, so costs are still measured; esp_timer callbacks are
+ * dispatched on real time and should not be running meanwhile.
+ */
+void hostClockAdvance(int64_t us);
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+
+inline uint8_t digitalPinToInterrupt(uint8_t pin) { return pin; }
+void attachInterrupt(uint8_t pin, void (*handler)(void), int mode);
+void attachInterruptArg(uint8_t pin, void (*handler)(void*), void* arg, int mode);
+void detachInterrupt(uint8_t pin);
+
+/**
+ * Raise an edge on a pin from a simulated source: runs the attached handler
+ * in the caller's thread, as the interrupt would on the target
+ * @return true if a handler was attached
+ */
+bool hostRaiseInterrupt(uint8_t pin);
+
+// =================================================================================================
+// NETWORK ADDRESS, CHIP
+// =================================================================================================
+
+class IPAddress : public Printable {
+public:
+    IPAddress() : value(0) {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : value(a | (b << 8) | (c << 16) | ((uint32_t)d << 24)) {}
+    String toString() const {
+        char text[16];
+        snprintf(text, sizeof(text), "%u.%u.%u.%u", (unsigned)(value & 0xFF), (unsigned)((value >> 8) & 0xFF),
+                 (unsigned)((value >> 16) & 0xFF), (unsigned)(value >> 24));
+        return String(text);
+    }
+    size_t printTo(Print& p) const override { return p.print(toString()); }
+    operator uint32_t() const { return value; }
+
+private:
+    uint32_t value;
+};
+
+/**
+ * Chip information. The cycle counter runs at a nominal 240 MHz from the host
+ * clock, so cycle figures convert to time as they do on the target.
+ */
+class EspClass {
+public:
+    uint32_t getCycleCount();
+    uint32_t getCpuFreqMHz() { return 240; }
+    uint32_t getFreeHeap();
+    uint32_t getMinFreeHeap();
+    uint32_t getMaxAllocHeap();
+    uint32_t getHeapSize();
+    uint32_t getPsramSize() { return 0; }
+    uint32_t getFreePsram() { return 0; }
+    uint64_t getEfuseMac() { return 0x0000A1B2C3D4E5F6ULL; }
+    void restart();
+};
+
+extern EspClass ESP;
+
+#endif // SENSYTHING_HOST_ARDUINO_H
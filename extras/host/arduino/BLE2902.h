@@ -0,0 +1,8 @@
+#ifndef SENSYTHING_HOST_BLE2902_H
+#define SENSYTHING_HOST_BLE2902_H
+
+#include "BLEDevice.h"
+
+class BLE2902 : public BLEDescriptor {};
+
+#endif
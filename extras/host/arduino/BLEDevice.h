@@ -0,0 +1,118 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Host Build - BLE Stand-in
+//    A BLE stack with no radio: every call succeeds and nothing is sent
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SENSYTHING_HOST_BLEDEVICE_H
+#define SENSYTHING_HOST_BLEDEVICE_H
+
+#include "Arduino.h"
+
+typedef uint8_t esp_bd_addr_t[6];
+typedef int esp_gap_ble_cb_event_t;
+
+typedef union {
+    struct { uint16_t conn_id; esp_bd_addr_t remote_bda; } connect;
+    struct { uint16_t conn_id; uint16_t mtu; } mtu;
+} esp_ble_gatts_cb_param_t;
+
+typedef union {
+    struct { int status; esp_bd_addr_t bda; uint16_t min_int, max_int, latency, conn_int, timeout; } update_conn_params;
+    struct { int status; esp_bd_addr_t bda; uint8_t tx_phy, rx_phy; } phy_update;
+} esp_ble_gap_cb_param_t;
+
+#define ESP_GAP_BLE_UPDATE_CONN_PARAMS_EVT 1
+#define ESP_GAP_BLE_PHY_UPDATE_COMPLETE_EVT 2
+#define ESP_BT_STATUS_SUCCESS 0
+#define ESP_BLE_GAP_PHY_1M 1
+#define ESP_BLE_GAP_PHY_2M 2
+#define ESP_BLE_GAP_PHY_2M_PREF_MASK 2
+#define ESP_BLE_GAP_NO_PREFER_TRANSMIT_PHY 1
+#define ESP_BLE_GAP_NO_PREFER_RECEIVE_PHY 2
+#define ESP_BLE_GAP_PHY_OPTIONS_NO_PREF 0
+
+inline esp_err_t esp_ble_gap_set_preferred_phy(esp_bd_addr_t, uint8_t, uint8_t, uint8_t, int) { return ESP_OK; }
+inline esp_err_t esp_ble_gap_set_preferred_default_phy(uint8_t, uint8_t) { return ESP_OK; }
+
+class BLEServer;
+
+class BLEUUID {
+public:
+    BLEUUID(const char*) {}
+    BLEUUID(uint16_t) {}
+};
+
+class BLEServerCallbacks {
+public:
+    virtual ~BLEServerCallbacks() {}
+    virtual void onConnect(BLEServer*) {}
+    virtual void onConnect(BLEServer*, esp_ble_gatts_cb_param_t*) {}
+    virtual void onDisconnect(BLEServer*) {}
+    virtual void onMtuChanged(BLEServer*, esp_ble_gatts_cb_param_t*) {}
+};
+
+class BLEDescriptor {
+public:
+    virtual ~BLEDescriptor() {}
+};
+
+class BLECharacteristic {
+public:
+    static const uint32_t PROPERTY_READ = 1;
+    static const uint32_t PROPERTY_WRITE = 8;
+    static const uint32_t PROPERTY_NOTIFY = 16;
+    void setValue(uint8_t*, size_t) {}
+    void notify(bool = true) {}
+    void addDescriptor(BLEDescriptor*) {}
+};
+
+class BLEService {
+public:
+    BLECharacteristic* createCharacteristic(const char*, uint32_t) { return &characteristic; }
+    void start() {}
+
+private:
+    BLECharacteristic characteristic;
+};
+
+class BLEServer {
+public:
+    void setCallbacks(BLEServerCallbacks*) {}
+    BLEService* createService(const char*) { return &service; }
+    uint16_t getPeerMTU(uint16_t) { return 23; }
+    uint16_t getConnId() { return 0; }
+    void updateConnParams(esp_bd_addr_t, uint16_t, uint16_t, uint16_t, uint16_t) {}
+    uint32_t getConnectedCount() { return 0; }
+
+private:
+    BLEService service;
+};
+
+class BLEAdvertising {
+public:
+    void addServiceUUID(const char*) {}
+    void setScanResponse(bool) {}
+    void setMinPreferred(uint16_t) {}
+    void setMaxPreferred(uint16_t) {}
+};
+
+typedef void (*gap_event_handler)(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t* param);
+
+class BLEDevice {
+public:
+    static void init(const char*) {}
+    static void deinit(bool) {}
+    static BLEServer* createServer() { static BLEServer server; return &server; }
+    static BLEAdvertising* getAdvertising() { static BLEAdvertising advertising; return &advertising; }
+    static void startAdvertising() {}
+    static esp_err_t setMTU(uint16_t) { return ESP_OK; }
+    static uint16_t getMTU() { return 23; }
+    static void setCustomGapHandler(gap_event_handler) {}
+};
+
+#endif // SENSYTHING_HOST_BLEDEVICE_H
@@ -0,0 +1,6 @@
+#ifndef SENSYTHING_HOST_BLESERVER_H
+#define SENSYTHING_HOST_BLESERVER_H
+
+#include "BLEDevice.h"
+
+#endif
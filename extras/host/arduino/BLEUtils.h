@@ -0,0 +1,6 @@
+#ifndef SENSYTHING_HOST_BLEUTILS_H
+#define SENSYTHING_HOST_BLEUTILS_H
+
+#include "BLEDevice.h"
+
+#endif
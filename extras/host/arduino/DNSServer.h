@@ -0,0 +1,16 @@
+#ifndef SENSYTHING_HOST_DNSSERVER_H
+#define SENSYTHING_HOST_DNSSERVER_H
+
+#include "Arduino.h"
+
+enum class DNSReplyCode { NoError };
+
+class DNSServer {
+public:
+    void setErrorReplyCode(DNSReplyCode) {}
+    bool start(int, const char*, IPAddress) { return true; }
+    void processNextRequest() {}
+    void stop() {}
+};
+
+#endif
@@ -0,0 +1,15 @@
+#ifndef SENSYTHING_HOST_ESPMDNS_H
+#define SENSYTHING_HOST_ESPMDNS_H
+
+#include "Arduino.h"
+
+class MDNSResponder {
+public:
+    bool begin(const char*) { return true; }
+    void addService(const char*, const char*, int) {}
+    void end() {}
+};
+
+extern MDNSResponder MDNS;
+
+#endif
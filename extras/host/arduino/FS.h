@@ -0,0 +1,80 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Host Build - Filesystem Stand-in
+//    fs::FS over a host directory, so replay and logging touch real files
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SENSYTHING_HOST_FS_H
+#define SENSYTHING_HOST_FS_H
+
+#include "Arduino.h"
+#include <memory>
+
+#define FILE_READ "r"
+#define FILE_WRITE "w"
+#define FILE_APPEND "a"
+
+namespace fs {
+
+class File : public Stream {
+public:
+    File() {}
+    File(FILE* handle, const std::string& name);
+
+    operator bool() const { return (bool)handle; }
+    void close() { handle.reset(); }
+    size_t size() const;
+    size_t position() const;
+    bool seek(uint32_t position);
+    const char* name() const { return fileName.c_str(); }
+
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* buffer, size_t size) override;
+    using Print::write;
+    int available() override;
+    int read() override;
+    int peek() override;
+    size_t read(uint8_t* buffer, size_t size);
+    void flush() override;
+
+private:
+    std::shared_ptr<FILE> handle;
+    std::string fileName;
+};
+
+/**
+ * Filesystem rooted at a host directory; paths are relative to it
+ */
+class FS {
+public:
+    FS() {}
+    explicit FS(const std::string& root) : root(root) {}
+
+    void setRoot(const std::string& directory) { root = directory; }
+    const std::string& getRoot() const { return root; }
+
+    File open(const char* path, const char* mode = FILE_READ, bool create = false);
+    File open(const String& path, const char* mode = FILE_READ, bool create = false) {
+        return open(path.c_str(), mode, create);
+    }
+    bool exists(const char* path);
+    bool exists(const String& path) { return exists(path.c_str()); }
+    bool remove(const char* path);
+    bool remove(const String& path) { return remove(path.c_str()); }
+
+protected:
+    std::string root;
+
+    std::string hostPath(const char* path) const;
+};
+
+} // namespace fs
+
+using fs::File;
+using fs::FS;
+
+#endif // SENSYTHING_HOST_FS_H
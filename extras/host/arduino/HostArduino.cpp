@@ -0,0 +1,263 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Host Build - Arduino Core Stand-in Implementation
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Arduino.h"
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+HardwareSerial Serial;
+EspClass ESP;
+
+// =================================================================================================
+// CLOCK
+// =================================================================================================
+
+static const std::chrono::steady_clock::time_point hostStart = std::chrono::steady_clock::now();
+
+static std::atomic<int64_t> hostClockOffsetNs(0);    // Added by hostClockAdvance()
+
+static int64_t hostNanoseconds() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - hostStart).count();
+}
+
+// What the board's clocks read: real time plus any simulated advance
+static int64_t hostClockNanoseconds() {
+    return hostNanoseconds() + hostClockOffsetNs.load();
+}
+
+void hostClockAdvance(int64_t us) {
+    hostClockOffsetNs += us * 1000;
+}
+
+int64_t esp_timer_get_time() {
+    return hostClockNanoseconds() / 1000;
+}
+
+// The target's counters are 32 bits wide and wrap; keep that on the host
+unsigned long millis() {
+    return (uint32_t)(hostClockNanoseconds() / 1000000);
+}
+
+unsigned long micros() {
+    return (uint32_t)(hostClockNanoseconds() / 1000);
+}
+
+void delay(unsigned long ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void delayMicroseconds(unsigned int us) {
+    std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+void yield() {
+    std::this_thread::yield();
+}
+
+uint32_t EspClass::getCycleCount() {
+    return (uint32_t)(hostNanoseconds() * 240 / 1000);
+}
+
+void EspClass::restart() {
+    fprintf(stderr, "ESP.restart() called on the host build\n");
+    exit(1);
+}
+
+// =================================================================================================
+// PRINT / STREAM
+// =================================================================================================
+
+size_t Print::printf(const char* format, ...) {
+    char local[256];
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(local, sizeof(local), format, args);
+    va_end(args);
+    if (length < 0) {
+        return 0;
+    }
+    if ((size_t)length < sizeof(local)) {
+        return write((const uint8_t*)local, length);
+    }
+
+    std::string text(length + 1, '\0');
+    va_start(args, format);
+    vsnprintf(&text[0], text.size(), format, args);
+    va_end(args);
+    return write((const uint8_t*)text.data(), length);
+}
+
+String Stream::readStringUntil(char terminator) {
+    String line;
+    int c;
+    while ((c = read()) >= 0 && c != terminator) {
+        line += (char)c;
+    }
+    return line;
+}
+
+size_t Stream::readBytes(uint8_t* buffer, size_t length) {
+    size_t count = 0;
+    int c;
+    while (count < length && (c = read()) >= 0) {
+        buffer[count++] = (uint8_t)c;
+    }
+    return count;
+}
+
+// =================================================================================================
+// SERIAL CONSOLE
+// =================================================================================================
+
+static std::mutex serialMutex;
+static HostSerialOutput serialOutput = HOST_SERIAL_STDOUT;
+static std::string serialCaptured;
+static std::deque<char> serialInput;
+static uint64_t serialBytes = 0;
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size) {
+    std::lock_guard<std::mutex> lock(serialMutex);
+    serialBytes += size;
+    if (serialOutput == HOST_SERIAL_STDOUT) {
+        fwrite(buffer, 1, size, stdout);
+    } else if (serialOutput == HOST_SERIAL_CAPTURE) {
+        serialCaptured.append((const char*)buffer, size);
+    }
+    return size;
+}
+
+int HardwareSerial::available() {
+    std::lock_guard<std::mutex> lock(serialMutex);
+    return (int)serialInput.size();
+}
+
+int HardwareSerial::read() {
+    std::lock_guard<std::mutex> lock(serialMutex);
+    if (serialInput.empty()) {
+        return -1;
+    }
+    char c = serialInput.front();
+    serialInput.pop_front();
+    return (uint8_t)c;
+}
+
+int HardwareSerial::peek() {
+    std::lock_guard<std::mutex> lock(serialMutex);
+    return serialInput.empty() ? -1 : (uint8_t)serialInput.front();
+}
+
+void HardwareSerial::flush() {
+    std::lock_guard<std::mutex> lock(serialMutex);
+    if (serialOutput == HOST_SERIAL_STDOUT) {
+        fflush(stdout);
+    }
+}
+
+void hostSerialSetOutput(HostSerialOutput mode) {
+    std::lock_guard<std::mutex> lock(serialMutex);
+    fflush(stdout);
+    serialOutput = mode;
+}
+
+void hostSerialInput(const char* text) {
+    std::lock_guard<std::mutex> lock(serialMutex);
+    serialInput.insert(serialInput.end(), text, text + strlen(text));
+}
+
+std::string hostSerialTakeOutput() {
+    std::lock_guard<std::mutex> lock(serialMutex);
+    std::string text;
+    text.swap(serialCaptured);
+    return text;
+}
+
+uint64_t hostSerialBytesWritten() {
+    std::lock_guard<std::mutex> lock(serialMutex);
+    return serialBytes;
+}
+
+// =================================================================================================
+// PINS AND INTERRUPTS
+// =================================================================================================
+
+#define HOST_PIN_COUNT 64
+
+typedef struct {
+    void (*handler)(void*);
+    void (*plainHandler)(void);
+    void* arg;
+} HostInterrupt;
+
+static uint8_t pinLevels[HOST_PIN_COUNT];
+static HostInterrupt interrupts[HOST_PIN_COUNT];
+static std::recursive_mutex interruptMutex;  // Held while a handler runs, so detach waits for it
+
+void pinMode(uint8_t pin, uint8_t mode) {
+    (void)pin;
+    (void)mode;
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+    if (pin < HOST_PIN_COUNT) {
+        pinLevels[pin] = value ? HIGH : LOW;
+    }
+}
+
+int digitalRead(uint8_t pin) {
+    return pin < HOST_PIN_COUNT ? pinLevels[pin] : LOW;
+}
+
+void attachInterrupt(uint8_t pin, void (*handler)(void), int mode) {
+    (void)mode;
+    if (pin >= HOST_PIN_COUNT) {
+        return;
+    }
+    std::lock_guard<std::recursive_mutex> lock(interruptMutex);
+    interrupts[pin].handler = nullptr;
+    interrupts[pin].plainHandler = handler;
+    interrupts[pin].arg = nullptr;
+}
+
+void attachInterruptArg(uint8_t pin, void (*handler)(void*), void* arg, int mode) {
+    (void)mode;
+    if (pin >= HOST_PIN_COUNT) {
+        return;
+    }
+    std::lock_guard<std::recursive_mutex> lock(interruptMutex);
+    interrupts[pin].handler = handler;
+    interrupts[pin].plainHandler = nullptr;
+    interrupts[pin].arg = arg;
+}
+
+void detachInterrupt(uint8_t pin) {
+    if (pin >= HOST_PIN_COUNT) {
+        return;
+    }
+    std::lock_guard<std::recursive_mutex> lock(interruptMutex);
+    memset(&interrupts[pin], 0, sizeof(HostInterrupt));
+}
+
+bool hostRaiseInterrupt(uint8_t pin) {
+    if (pin >= HOST_PIN_COUNT) {
+        return false;
+    }
+    std::lock_guard<std::recursive_mutex> lock(interruptMutex);
+    if (interrupts[pin].handler) {
+        interrupts[pin].handler(interrupts[pin].arg);
+        return true;
+    }
+    if (interrupts[pin].plainHandler) {
+        interrupts[pin].plainHandler();
+        return true;
+    }
+    return false;
+}
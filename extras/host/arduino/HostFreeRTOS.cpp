@@ -0,0 +1,291 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Host Build - FreeRTOS Stand-in Implementation
+//
+//    Each task is a detached std::thread. Deleting a task is only safe at a
+//    blocking call, as the library always arranges: a task deleted by another
+//    leaves at its next FreeRTOS call, and the deleter waits for that. Task
+//    records are never freed, so notifying a deleted task is caught and
+//    reported instead of corrupting memory.
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Arduino.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct HostTask {
+    std::mutex mutex;
+    std::condition_variable changed;
+    uint32_t notifications = 0;
+    bool deleteRequested = false;
+    bool finished = false;
+    std::string name;
+};
+
+struct HostQueue {
+    std::mutex mutex;
+    std::condition_variable changed;
+    std::vector<uint8_t> storage;
+    size_t itemSize;
+    size_t length;
+    size_t head = 0;
+    size_t count = 0;
+};
+
+// Thrown to unwind a deleted task's thread back to its entry wrapper
+struct HostTaskExit {};
+
+static thread_local HostTask* currentTask = nullptr;
+static std::atomic<uint32_t> liveTasks(0);
+static std::recursive_mutex criticalMutex;
+
+static std::chrono::steady_clock::time_point deadlineFor(TickType_t ticks) {
+    return std::chrono::steady_clock::now() + std::chrono::milliseconds(ticks * portTICK_PERIOD_MS);
+}
+
+static HostTask* selfTask() {
+    // Threads not created through xTaskCreate (the Arduino loop, tests) get a record on first use
+    if (!currentTask) {
+        currentTask = new HostTask();
+        currentTask->name = "host";
+    }
+    return currentTask;
+}
+
+// Called with task->mutex held at every blocking point
+static void leaveIfDeleted(HostTask* task, std::unique_lock<std::mutex>& lock) {
+    if (task->deleteRequested) {
+        lock.unlock();
+        throw HostTaskExit();
+    }
+}
+
+void hostEnterCritical() {
+    criticalMutex.lock();
+}
+
+void hostExitCritical() {
+    criticalMutex.unlock();
+}
+
+// =================================================================================================
+// TASKS
+// =================================================================================================
+
+BaseType_t xTaskCreatePinnedToCore(void (*entry)(void*), const char* name, uint32_t stackDepth,
+                                   void* arg, UBaseType_t priority, TaskHandle_t* handle, BaseType_t core) {
+    (void)stackDepth;
+    (void)priority;
+    (void)core;
+
+    HostTask* task = new HostTask();
+    task->name = name ? name : "";
+    if (handle) {
+        *handle = task;
+    }
+    liveTasks++;
+
+    std::thread([task, entry, arg]() {
+        currentTask = task;
+        try {
+            entry(arg);
+            fprintf(stderr, "task '%s' returned from its entry function\n", task->name.c_str());
+            abort();
+        } catch (const HostTaskExit&) {
+        }
+        std::lock_guard<std::mutex> lock(task->mutex);
+        task->finished = true;
+        liveTasks--;
+        task->changed.notify_all();
+    }).detach();
+    return pdPASS;
+}
+
+BaseType_t xTaskCreate(void (*entry)(void*), const char* name, uint32_t stackDepth,
+                       void* arg, UBaseType_t priority, TaskHandle_t* handle) {
+    return xTaskCreatePinnedToCore(entry, name, stackDepth, arg, priority, handle, tskNO_AFFINITY);
+}
+
+void vTaskDelete(TaskHandle_t task) {
+    if (!task || task == currentTask) {
+        if (!currentTask) {
+            fprintf(stderr, "vTaskDelete(nullptr) outside a task\n");
+            abort();
+        }
+        throw HostTaskExit();
+    }
+
+    std::unique_lock<std::mutex> lock(task->mutex);
+    if (task->deleteRequested) {
+        fprintf(stderr, "task '%s' deleted twice\n", task->name.c_str());
+        abort();
+    }
+    task->deleteRequested = true;
+    task->changed.notify_all();
+    task->changed.wait(lock, [task]() { return task->finished; });
+}
+
+void vTaskSuspend(TaskHandle_t task) {
+    if (task && task != currentTask) {
+        fprintf(stderr, "vTaskSuspend() of another task is not supported on the host\n");
+        abort();
+    }
+    HostTask* self = selfTask();
+    std::unique_lock<std::mutex> lock(self->mutex);
+    self->changed.wait(lock, [self]() { return self->deleteRequested; });
+    leaveIfDeleted(self, lock);
+}
+
+void vTaskDelay(TickType_t ticks) {
+    HostTask* self = selfTask();
+    std::unique_lock<std::mutex> lock(self->mutex);
+    self->changed.wait_until(lock, deadlineFor(ticks), [self]() { return self->deleteRequested; });
+    leaveIfDeleted(self, lock);
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle() {
+    return selfTask();
+}
+
+TickType_t xTaskGetTickCount() {
+    return (TickType_t)(millis() / portTICK_PERIOD_MS);
+}
+
+BaseType_t xPortGetCoreID() {
+    return 0;
+}
+
+void hostTaskYield() {
+    std::this_thread::yield();
+}
+
+uint32_t hostLiveTaskCount() {
+    return liveTasks.load();
+}
+
+// =================================================================================================
+// NOTIFICATIONS
+// =================================================================================================
+
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticksToWait) {
+    HostTask* self = selfTask();
+    std::unique_lock<std::mutex> lock(self->mutex);
+    auto ready = [self]() { return self->notifications != 0 || self->deleteRequested; };
+    if (ticksToWait == portMAX_DELAY) {
+        self->changed.wait(lock, ready);
+    } else {
+        self->changed.wait_until(lock, deadlineFor(ticksToWait), ready);
+    }
+    leaveIfDeleted(self, lock);
+
+    uint32_t value = self->notifications;
+    if (value) {
+        self->notifications = clearOnExit ? 0 : value - 1;
+    }
+    return value;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+    std::lock_guard<std::mutex> lock(task->mutex);
+    if (task->deleteRequested) {
+        fprintf(stderr, "notification sent to deleted task '%s'\n", task->name.c_str());
+        abort();
+    }
+    task->notifications++;
+    task->changed.notify_all();
+    return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t* higherPriorityTaskWoken) {
+    xTaskNotifyGive(task);
+    if (higherPriorityTaskWoken) {
+        *higherPriorityTaskWoken = pdTRUE;
+    }
+}
+
+// =================================================================================================
+// QUEUES AND SEMAPHORES
+// =================================================================================================
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize) {
+    HostQueue* queue = new HostQueue();
+    queue->length = length;
+    queue->itemSize = itemSize;
+    queue->storage.resize((size_t)length * itemSize);
+    return queue;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t ticksToWait) {
+    std::unique_lock<std::mutex> lock(queue->mutex);
+    auto room = [queue]() { return queue->count < queue->length; };
+    if (ticksToWait == portMAX_DELAY) {
+        queue->changed.wait(lock, room);
+    } else if (!queue->changed.wait_until(lock, deadlineFor(ticksToWait), room)) {
+        return pdFALSE;
+    }
+
+    size_t slot = (queue->head + queue->count) % queue->length;
+    if (queue->itemSize) {
+        memcpy(&queue->storage[slot * queue->itemSize], item, queue->itemSize);
+    }
+    queue->count++;
+    queue->changed.notify_all();
+    return pdTRUE;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t ticksToWait) {
+    std::unique_lock<std::mutex> lock(queue->mutex);
+    auto waiting = [queue]() { return queue->count > 0; };
+    if (ticksToWait == portMAX_DELAY) {
+        queue->changed.wait(lock, waiting);
+    } else if (!queue->changed.wait_until(lock, deadlineFor(ticksToWait), waiting)) {
+        return pdFALSE;
+    }
+
+    if (queue->itemSize) {
+        memcpy(item, &queue->storage[queue->head * queue->itemSize], queue->itemSize);
+    }
+    queue->head = (queue->head + 1) % queue->length;
+    queue->count--;
+    queue->changed.notify_all();
+    return pdTRUE;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue) {
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    return (UBaseType_t)queue->count;
+}
+
+void vQueueDelete(QueueHandle_t queue) {
+    delete queue;
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary() {
+    return xQueueCreate(1, 0);                   // Created empty, as in FreeRTOS
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex() {
+    SemaphoreHandle_t mutex = xQueueCreate(1, 0);
+    xQueueSend(mutex, nullptr, 0);               // Created available
+    return mutex;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticksToWait) {
+    return xQueueReceive(semaphore, nullptr, ticksToWait);
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore) {
+    return xQueueSend(semaphore, nullptr, 0);
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t semaphore) {
+    vQueueDelete(semaphore);
+}
@@ -0,0 +1,157 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Host Build - Heap Stand-in Implementation
+//
+//    Global operator new/delete are replaced to count allocations, so tests
+//    can assert a hot path allocates nothing. Free-heap figures are the
+//    live bytes taken from a nominal heap size.
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Arduino.h"
+#include "esp_heap_caps.h"
+#include <atomic>
+#include <malloc.h>
+#include <new>
+
+#define HOST_HEAP_SIZE (320 * 1024 * 1024)       // Nominal; large enough that host runtime use never fills it
+
+static std::atomic<uint64_t> allocations(0);
+static std::atomic<uint64_t> allocatedBytes(0);
+static std::atomic<int64_t> liveBytes(0);
+static std::atomic<int64_t> peakLiveBytes(0);
+static std::atomic<int64_t> localPeakLiveBytes(0);
+
+static void* countedAlloc(size_t size) {
+    void* ptr = malloc(size ? size : 1);
+    if (!ptr) {
+        return nullptr;
+    }
+    int64_t usable = (int64_t)malloc_usable_size(ptr);
+    allocations++;
+    allocatedBytes += size;
+    int64_t live = (liveBytes += usable);
+    int64_t peak = peakLiveBytes.load();
+    while (live > peak && !peakLiveBytes.compare_exchange_weak(peak, live)) {
+    }
+    peak = localPeakLiveBytes.load();
+    while (live > peak && !localPeakLiveBytes.compare_exchange_weak(peak, live)) {
+    }
+    return ptr;
+}
+
+static void countedFree(void* ptr) {
+    if (ptr) {
+        liveBytes -= (int64_t)malloc_usable_size(ptr);
+        free(ptr);
+    }
+}
+
+void* operator new(size_t size) {
+    void* ptr = countedAlloc(size);
+    if (!ptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    return countedAlloc(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    return countedAlloc(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    countedFree(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    countedFree(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    countedFree(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept {
+    countedFree(ptr);
+}
+
+uint64_t hostAllocationCount() {
+    return allocations.load();
+}
+
+uint64_t hostAllocatedBytes() {
+    return allocatedBytes.load();
+}
+
+// =================================================================================================
+// HEAP CAPABILITIES
+// =================================================================================================
+
+void* heap_caps_malloc(size_t size, uint32_t caps) {
+    (void)caps;
+    return countedAlloc(size);
+}
+
+void heap_caps_free(void* ptr) {
+    countedFree(ptr);
+}
+
+static size_t freeFor(int64_t live) {
+    return live >= HOST_HEAP_SIZE ? 0 : (size_t)(HOST_HEAP_SIZE - live);
+}
+
+size_t heap_caps_get_free_size(uint32_t caps) {
+    (void)caps;
+    return freeFor(liveBytes.load());
+}
+
+size_t heap_caps_get_minimum_free_size(uint32_t caps) {
+    (void)caps;
+    return freeFor(localPeakLiveBytes.load());
+}
+
+size_t heap_caps_get_largest_free_block(uint32_t caps) {
+    return heap_caps_get_free_size(caps);
+}
+
+size_t heap_caps_get_total_size(uint32_t caps) {
+    (void)caps;
+    return HOST_HEAP_SIZE;
+}
+
+int heap_caps_monitor_local_minimum_free_size_start(void) {
+    localPeakLiveBytes = liveBytes.load();
+    return 0;
+}
+
+int heap_caps_monitor_local_minimum_free_size_stop(void) {
+    localPeakLiveBytes = peakLiveBytes.load();
+    return 0;
+}
+
+uint32_t EspClass::getFreeHeap() {
+    return (uint32_t)freeFor(liveBytes.load());
+}
+
+uint32_t EspClass::getMinFreeHeap() {
+    return (uint32_t)freeFor(peakLiveBytes.load());
+}
+
+uint32_t EspClass::getMaxAllocHeap() {
+    return getFreeHeap();
+}
+
+uint32_t EspClass::getHeapSize() {
+    return HOST_HEAP_SIZE;
+}
@@ -0,0 +1,318 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Host Build - Peripheral Stand-in Implementations
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Arduino.h"
+#include "FS.h"
+#include "SD_MMC.h"
+#include "SPI.h"
+#include "Wire.h"
+#include "WiFi.h"
+#include "ESPmDNS.h"
+#include "Preferences.h"
+#include "protocentral_afe44xx.h"
+#include "driver/spi_master.h"
+#include <atomic>
+#include <map>
+#include <mutex>
+
+SPIClass SPI;
+TwoWire Wire;
+WiFiClass WiFi;
+MDNSResponder MDNS;
+SDMMCFS SD_MMC;
+
+// =================================================================================================
+// FILESYSTEM
+// =================================================================================================
+
+namespace fs {
+
+File::File(FILE* handle, const std::string& name) : handle(handle, fclose), fileName(name) {}
+
+size_t File::size() const {
+    if (!handle) {
+        return 0;
+    }
+    long position = ftell(handle.get());
+    fseek(handle.get(), 0, SEEK_END);
+    long end = ftell(handle.get());
+    fseek(handle.get(), position, SEEK_SET);
+    return end < 0 ? 0 : (size_t)end;
+}
+
+size_t File::position() const {
+    return handle ? (size_t)ftell(handle.get()) : 0;
+}
+
+bool File::seek(uint32_t position) {
+    return handle && fseek(handle.get(), position, SEEK_SET) == 0;
+}
+
+size_t File::write(const uint8_t* buffer, size_t size) {
+    return handle ? fwrite(buffer, 1, size, handle.get()) : 0;
+}
+
+int File::available() {
+    if (!handle) {
+        return 0;
+    }
+    size_t here = position();
+    size_t end = size();
+    return end > here ? (int)(end - here) : 0;
+}
+
+int File::read() {
+    return handle ? fgetc(handle.get()) : -1;
+}
+
+int File::peek() {
+    if (!handle) {
+        return -1;
+    }
+    int c = fgetc(handle.get());
+    if (c != EOF) {
+        ungetc(c, handle.get());
+    }
+    return c;
+}
+
+size_t File::read(uint8_t* buffer, size_t size) {
+    return handle ? fread(buffer, 1, size, handle.get()) : 0;
+}
+
+void File::flush() {
+    if (handle) {
+        fflush(handle.get());
+    }
+}
+
+std::string FS::hostPath(const char* path) const {
+    std::string full = root.empty() ? std::string(".") : root;
+    if (path[0] != '/') {
+        full += '/';
+    }
+    return full + path;
+}
+
+File FS::open(const char* path, const char* mode, bool create) {
+    (void)create;
+    std::string full = hostPath(path);
+    std::string hostMode = std::string(mode) + "b";
+    FILE* handle = fopen(full.c_str(), hostMode.c_str());
+    return handle ? File(handle, path) : File();
+}
+
+bool FS::exists(const char* path) {
+    FILE* handle = fopen(hostPath(path).c_str(), "rb");
+    if (handle) {
+        fclose(handle);
+    }
+    return handle != nullptr;
+}
+
+bool FS::remove(const char* path) {
+    return ::remove(hostPath(path).c_str()) == 0;
+}
+
+} // namespace fs
+
+bool SDMMCFS::setPins(int clk, int cmd, int d0, int d1, int d2, int d3) {
+    (void)clk; (void)cmd; (void)d0; (void)d1; (void)d2; (void)d3;
+    return true;
+}
+
+bool SDMMCFS::begin(const char* mountpoint, bool mode1bit) {
+    (void)mountpoint;
+    (void)mode1bit;
+    mounted = !root.empty();                     // No card until a host directory is set
+    return mounted;
+}
+
+// =================================================================================================
+// PREFERENCES
+// =================================================================================================
+
+static std::mutex preferencesMutex;
+static std::map<std::string, std::string> preferencesStore;
+
+bool Preferences::begin(const char* name, bool readOnly) {
+    (void)readOnly;
+    space = std::string(name) + "/";
+    return true;
+}
+
+bool Preferences::clear() {
+    std::lock_guard<std::mutex> lock(preferencesMutex);
+    for (auto it = preferencesStore.begin(); it != preferencesStore.end();) {
+        it = it->first.compare(0, space.size(), space) == 0 ? preferencesStore.erase(it) : std::next(it);
+    }
+    return true;
+}
+
+size_t Preferences::putString(const char* key, const String& value) {
+    std::lock_guard<std::mutex> lock(preferencesMutex);
+    preferencesStore[space + key] = value.c_str();
+    return value.length();
+}
+
+String Preferences::getString(const char* key, const String& defaultValue) {
+    std::lock_guard<std::mutex> lock(preferencesMutex);
+    auto it = preferencesStore.find(space + key);
+    return it == preferencesStore.end() ? defaultValue : String(it->second);
+}
+
+size_t Preferences::putBool(const char* key, bool value) {
+    return putString(key, value ? "1" : "0") ? 1 : 0;
+}
+
+bool Preferences::getBool(const char* key, bool defaultValue) {
+    return getString(key, defaultValue ? "1" : "0") == "1";
+}
+
+size_t Preferences::putUInt(const char* key, uint32_t value) {
+    return putString(key, String((unsigned long)value)) ? 4 : 0;
+}
+
+uint32_t Preferences::getUInt(const char* key, uint32_t defaultValue) {
+    String value = getString(key, "");
+    return value.isEmpty() ? defaultValue : (uint32_t)strtoul(value.c_str(), nullptr, 10);
+}
+
+// =================================================================================================
+// AFE4400
+// =================================================================================================
+
+#define HOST_AFE_RED_OFFSET 100000               // RED reads IR plus this, so the two are told apart
+
+static std::mutex afeMutex;                      // Orders reads against conversion and edge
+static std::atomic<uint32_t> afeConversion(0);
+static std::atomic<bool> afeExternalClock(false);
+
+uint32_t hostAfe44xxConvert(int drdyPin) {
+    std::lock_guard<std::mutex> lock(afeMutex);
+    afeExternalClock = true;
+    uint32_t conversion = ++afeConversion;
+    if (drdyPin >= 0) {
+        hostRaiseInterrupt((uint8_t)drdyPin);
+    }
+    return conversion;
+}
+
+uint32_t hostAfe44xxLatest() {
+    return afeConversion.load();
+}
+
+// Result of a read: the latest conversion, or a fresh one when nothing drives the clock
+static uint32_t afeRead() {
+    std::lock_guard<std::mutex> lock(afeMutex);
+    return afeExternalClock ? afeConversion.load() : ++afeConversion;
+}
+
+bool AFE44XX::get_AFE44XX_Data(afe44xx_data* data) {
+    uint32_t conversion = afeRead();
+    data->IR_data = conversion;
+    data->RED_data = conversion + HOST_AFE_RED_OFFSET;
+    data->spo2 = 98.0f;
+    data->heart_rate = 72;
+    data->buffer_count_overflow = false;
+    return true;
+}
+
+// =================================================================================================
+// SPI MASTER
+// =================================================================================================
+
+#define HOST_SPI_QUEUE_DEPTH 16
+#define HOST_AFE_REG_LED2VAL 0x2A
+#define HOST_AFE_REG_LED1VAL 0x2C
+
+struct spi_device_t {
+    spi_transaction_t* queue[HOST_SPI_QUEUE_DEPTH];
+    size_t head;
+    size_t count;
+    uint32_t burstConversion;                    // Conversion being read by the current burst
+};
+
+static void completeTransaction(spi_device_t* device, spi_transaction_t* transaction) {
+    const uint8_t* tx = (transaction->flags & SPI_TRANS_USE_TXDATA) ? transaction->tx_data
+                                                                    : (const uint8_t*)transaction->tx_buffer;
+    uint8_t* rx = (transaction->flags & SPI_TRANS_USE_RXDATA) ? transaction->rx_data
+                                                              : (uint8_t*)transaction->rx_buffer;
+    if (!rx || !tx) {
+        return;
+    }
+
+    // Result registers answer the address byte with 24 data bits; a burst
+    // starts at LED2VAL, which latches the conversion for the whole burst
+    uint32_t value = 0;
+    if (tx[0] == HOST_AFE_REG_LED2VAL) {
+        device->burstConversion = afeRead();
+        value = device->burstConversion + HOST_AFE_RED_OFFSET;
+    } else if (tx[0] == HOST_AFE_REG_LED1VAL) {
+        value = device->burstConversion;
+    }
+    rx[0] = 0;
+    rx[1] = (value >> 16) & 0xFF;
+    rx[2] = (value >> 8) & 0xFF;
+    rx[3] = value & 0xFF;
+}
+
+esp_err_t spi_bus_initialize(spi_host_device_t host, const spi_bus_config_t* config, int dmaChannel) {
+    (void)host; (void)config; (void)dmaChannel;
+    return ESP_OK;
+}
+
+esp_err_t spi_bus_free(spi_host_device_t host) {
+    (void)host;
+    return ESP_OK;
+}
+
+esp_err_t spi_bus_add_device(spi_host_device_t host, const spi_device_interface_config_t* config,
+                             spi_device_handle_t* handle) {
+    (void)host;
+    (void)config;
+    *handle = new spi_device_t();
+    return ESP_OK;
+}
+
+esp_err_t spi_bus_remove_device(spi_device_handle_t handle) {
+    if (handle->count) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    delete handle;
+    return ESP_OK;
+}
+
+esp_err_t spi_device_queue_trans(spi_device_handle_t handle, spi_transaction_t* transaction, TickType_t ticksToWait) {
+    (void)ticksToWait;
+    if (handle->count == HOST_SPI_QUEUE_DEPTH) {
+        return ESP_ERR_TIMEOUT;
+    }
+    handle->queue[(handle->head + handle->count) % HOST_SPI_QUEUE_DEPTH] = transaction;
+    handle->count++;
+    return ESP_OK;
+}
+
+esp_err_t spi_device_get_trans_result(spi_device_handle_t handle, spi_transaction_t** transaction,
+                                      TickType_t ticksToWait) {
+    (void)ticksToWait;
+    if (!handle->count) {
+        return ESP_ERR_TIMEOUT;
+    }
+    *transaction = handle->queue[handle->head];
+    handle->head = (handle->head + 1) % HOST_SPI_QUEUE_DEPTH;
+    handle->count--;
+    completeTransaction(handle, *transaction);
+    return ESP_OK;
+}
+
+esp_err_t spi_device_polling_transmit(spi_device_handle_t handle, spi_transaction_t* transaction) {
+    completeTransaction(handle, transaction);
+    return ESP_OK;
+}
@@ -0,0 +1,135 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Host Build - esp_timer Stand-in Implementation
+//
+//    One dispatch thread runs every callback, like the ESP-IDF timer task.
+//    Periodic timers keep an absolute schedule: a late callback does not
+//    shift the ones after it, and missed periods are run back to back.
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Arduino.h"
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct esp_timer {
+    void (*callback)(void*);
+    void* arg;
+    bool armed;
+    bool periodic;
+    int64_t periodUs;
+    int64_t dueUs;
+};
+
+// Never destroyed: the dispatch thread outlives static destruction at exit
+static std::mutex& timerMutex = *new std::mutex();
+static std::condition_variable& timerChanged = *new std::condition_variable();
+static std::vector<esp_timer*>& timers = *new std::vector<esp_timer*>();
+static bool dispatcherStarted = false;
+
+static void timerDispatchLoop() {
+    std::unique_lock<std::mutex> lock(timerMutex);
+    while (true) {
+        esp_timer* next = nullptr;
+        for (esp_timer* timer : timers) {
+            if (timer->armed && (!next || timer->dueUs < next->dueUs)) {
+                next = timer;
+            }
+        }
+        if (!next) {
+            timerChanged.wait(lock);
+            continue;
+        }
+
+        int64_t waitUs = next->dueUs - esp_timer_get_time();
+        if (waitUs > 0) {
+            timerChanged.wait_for(lock, std::chrono::microseconds(waitUs));
+            continue;                            // Timers may have changed while waiting
+        }
+
+        void (*callback)(void*) = next->callback;
+        void* arg = next->arg;
+        if (next->periodic) {
+            next->dueUs += next->periodUs;
+        } else {
+            next->armed = false;
+        }
+
+        lock.unlock();
+        callback(arg);
+        lock.lock();
+    }
+}
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t* args, esp_timer_handle_t* handle) {
+    if (!args || !args->callback || !handle) {
+        return ESP_FAIL;
+    }
+    esp_timer* timer = new esp_timer();
+    timer->callback = args->callback;
+    timer->arg = args->arg;
+    timer->armed = false;
+    timer->periodic = false;
+    timer->periodUs = 0;
+    timer->dueUs = 0;
+
+    std::lock_guard<std::mutex> lock(timerMutex);
+    timers.push_back(timer);
+    if (!dispatcherStarted) {
+        std::thread(timerDispatchLoop).detach();
+        dispatcherStarted = true;
+    }
+    *handle = timer;
+    return ESP_OK;
+}
+
+static esp_err_t startTimer(esp_timer_handle_t timer, uint64_t us, bool periodic) {
+    std::lock_guard<std::mutex> lock(timerMutex);
+    if (timer->armed) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    timer->armed = true;
+    timer->periodic = periodic;
+    timer->periodUs = (int64_t)us;
+    timer->dueUs = esp_timer_get_time() + (int64_t)us;
+    timerChanged.notify_all();
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t periodUs) {
+    return startTimer(timer, periodUs, true);
+}
+
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeoutUs) {
+    return startTimer(timer, timeoutUs, false);
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer) {
+    std::lock_guard<std::mutex> lock(timerMutex);
+    if (!timer->armed) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    timer->armed = false;
+    timerChanged.notify_all();
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_delete(esp_timer_handle_t timer) {
+    std::lock_guard<std::mutex> lock(timerMutex);
+    if (timer->armed) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    for (size_t i = 0; i < timers.size(); i++) {
+        if (timers[i] == timer) {
+            timers.erase(timers.begin() + i);
+            break;
+        }
+    }
+    delete timer;
+    return ESP_OK;
+}
@@ -0,0 +1,32 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Host Build - Preferences Stand-in
+//    Non-volatile storage kept in memory for the life of the process
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SENSYTHING_HOST_PREFERENCES_H
+#define SENSYTHING_HOST_PREFERENCES_H
+
+#include "Arduino.h"
+
+class Preferences {
+public:
+    bool begin(const char* name, bool readOnly = false);
+    void end() {}
+    bool clear();
+    size_t putString(const char* key, const String& value);
+    String getString(const char* key, const String& defaultValue = String());
+    size_t putBool(const char* key, bool value);
+    bool getBool(const char* key, bool defaultValue = false);
+    size_t putUInt(const char* key, uint32_t value);
+    uint32_t getUInt(const char* key, uint32_t defaultValue = 0);
+
+private:
+    std::string space;
+};
+
+#endif // SENSYTHING_HOST_PREFERENCES_H
@@ -0,0 +1,34 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Host Build - SD_MMC Stand-in
+//    The card is a host directory, mounted with SD_MMC.setRoot() before begin()
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SENSYTHING_HOST_SD_MMC_H
+#define SENSYTHING_HOST_SD_MMC_H
+
+#include "FS.h"
+
+typedef enum { CARD_NONE, CARD_MMC, CARD_SD, CARD_SDHC, CARD_UNKNOWN } sdcard_type_t;
+
+class SDMMCFS : public fs::FS {
+public:
+    bool setPins(int clk, int cmd, int d0, int d1 = -1, int d2 = -1, int d3 = -1);
+    bool begin(const char* mountpoint = "/sdcard", bool mode1bit = false);
+    void end() { mounted = false; }
+    uint8_t cardType() { return mounted ? CARD_SDHC : CARD_NONE; }
+    uint64_t cardSize() { return mounted ? 32ULL * 1024 * 1024 * 1024 : 0; }
+    uint64_t totalBytes() { return cardSize(); }
+    uint64_t usedBytes() { return 0; }
+
+private:
+    bool mounted = false;
+};
+
+extern SDMMCFS SD_MMC;
+
+#endif // SENSYTHING_HOST_SD_MMC_H
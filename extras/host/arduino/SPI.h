@@ -0,0 +1,27 @@
+#ifndef SENSYTHING_HOST_SPI_H
+#define SENSYTHING_HOST_SPI_H
+
+#include "Arduino.h"
+
+class SPISettings {
+public:
+    SPISettings(uint32_t, uint8_t, uint8_t) {}
+};
+
+// Bus set-up only; the AFE44XX stand-in produces its conversions directly
+class SPIClass {
+public:
+    void begin(int8_t = -1, int8_t = -1, int8_t = -1, int8_t = -1) {}
+    void end() {}
+    void setBitOrder(uint8_t) {}
+    void setDataMode(uint8_t) {}
+    void setFrequency(uint32_t) {}
+    void beginTransaction(SPISettings) {}
+    void endTransaction() {}
+    uint8_t transfer(uint8_t) { return 0; }
+    void transferBytes(const uint8_t*, uint8_t*, uint32_t) {}
+};
+
+extern SPIClass SPI;
+
+#endif
@@ -0,0 +1,43 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Host Build - WebServer Stand-in
+//    Accepts route registrations; no client ever connects
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SENSYTHING_HOST_WEBSERVER_H
+#define SENSYTHING_HOST_WEBSERVER_H
+
+#include "Arduino.h"
+#include <functional>
+
+enum HTTPMethod { HTTP_ANY, HTTP_GET, HTTP_POST };
+#define CONTENT_LENGTH_UNKNOWN ((size_t)-1)
+
+class WebServer {
+public:
+    WebServer(int) {}
+    void on(const char*, std::function<void()>) {}
+    void on(const char*, HTTPMethod, std::function<void()>) {}
+    void onNotFound(std::function<void()>) {}
+    void begin() {}
+    void handleClient() {}
+    void send(int, const char* = nullptr, const String& = String()) {}
+    void send(int, const char*, const char*) {}
+    void send_P(int, const char*, const char*, size_t) {}
+    void sendHeader(const String&, const String&, bool = false) {}
+    bool hasArg(const char*) { return false; }
+    String arg(const char*) { return String(); }
+    bool hasHeader(const char*) { return false; }
+    String header(const char*) { return String(); }
+    void collectHeaders(const char**, size_t) {}
+    void setContentLength(size_t) {}
+    void sendContent(const char*, size_t) {}
+    void sendContent(const String&) {}
+    void sendContent_P(const char*, size_t) {}
+};
+
+#endif // SENSYTHING_HOST_WEBSERVER_H
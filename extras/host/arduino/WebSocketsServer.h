@@ -0,0 +1,33 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Host Build - WebSockets Stand-in
+//    A server with no clients: broadcasts succeed and go nowhere
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SENSYTHING_HOST_WEBSOCKETSSERVER_H
+#define SENSYTHING_HOST_WEBSOCKETSSERVER_H
+
+#include "Arduino.h"
+
+typedef enum { WStype_ERROR, WStype_DISCONNECTED, WStype_CONNECTED, WStype_TEXT, WStype_BIN } WStype_t;
+
+class WebSocketsServer {
+public:
+    WebSocketsServer(int) {}
+    void onEvent(void (*)(uint8_t, WStype_t, uint8_t*, size_t)) {}
+    void begin() {}
+    void loop() {}
+    bool broadcastTXT(const String&) { return true; }
+    bool broadcastTXT(const char*, size_t = 0) { return true; }
+    bool broadcastBIN(const uint8_t*, size_t) { return true; }
+    bool sendTXT(uint8_t, const String&) { return true; }
+    bool sendTXT(uint8_t, const char*, size_t = 0) { return true; }
+    IPAddress remoteIP(uint8_t) { return IPAddress(); }
+    int connectedClients(bool = false) { return 0; }
+};
+
+#endif // SENSYTHING_HOST_WEBSOCKETSSERVER_H
@@ -0,0 +1,42 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Host Build - WiFi Stand-in
+//    A WiFi stack with no radio: never connects, the access point reports 0.0.0.0
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SENSYTHING_HOST_WIFI_H
+#define SENSYTHING_HOST_WIFI_H
+
+#include "Arduino.h"
+
+#define WL_IDLE_STATUS 0
+#define WL_CONNECTED 3
+#define WL_DISCONNECTED 6
+#define WIFI_OFF 0
+#define WIFI_STA 1
+#define WIFI_AP 2
+#define WIFI_AP_STA 3
+#define WIFI_AUTH_OPEN 0
+
+class WiFiClass {
+public:
+    int status() { return WL_DISCONNECTED; }
+    void mode(int) {}
+    bool softAP(const char*, const char* = nullptr) { return true; }
+    IPAddress softAPIP() { return IPAddress(); }
+    IPAddress localIP() { return IPAddress(); }
+    void begin(const char*, const char*) {}
+    void disconnect(bool = false) {}
+    int scanNetworks() { return 0; }
+    String SSID(int = 0) { return String(); }
+    int RSSI(int = 0) { return 0; }
+    int encryptionType(int) { return WIFI_AUTH_OPEN; }
+};
+
+extern WiFiClass WiFi;
+
+#endif // SENSYTHING_HOST_WIFI_H
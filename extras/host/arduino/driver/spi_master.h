@@ -0,0 +1,78 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Host Build - spi_master Stand-in
+//    Queued transactions complete in order; AFE4400 result registers read back
+//    the simulated conversion, every other frame reads zero
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SENSYTHING_HOST_SPI_MASTER_H
+#define SENSYTHING_HOST_SPI_MASTER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+
+typedef enum { SPI1_HOST = 0, SPI2_HOST = 1, SPI3_HOST = 2 } spi_host_device_t;
+
+#define SPI_DMA_CH_AUTO 3
+#define SPI_TRANS_USE_RXDATA (1 << 2)
+#define SPI_TRANS_USE_TXDATA (1 << 3)
+
+typedef struct {
+    int mosi_io_num;
+    int miso_io_num;
+    int sclk_io_num;
+    int quadwp_io_num;
+    int quadhd_io_num;
+    int max_transfer_sz;
+    uint32_t flags;
+    int intr_flags;
+} spi_bus_config_t;
+
+typedef struct {
+    uint8_t command_bits;
+    uint8_t address_bits;
+    uint8_t dummy_bits;
+    uint8_t mode;
+    int clock_speed_hz;
+    int input_delay_ns;
+    int spics_io_num;
+    uint32_t flags;
+    int queue_size;
+} spi_device_interface_config_t;
+
+typedef struct {
+    uint32_t flags;
+    uint16_t cmd;
+    uint64_t addr;
+    size_t length;
+    size_t rxlength;
+    void* user;
+    union {
+        const void* tx_buffer;
+        uint8_t tx_data[4];
+    };
+    union {
+        void* rx_buffer;
+        uint8_t rx_data[4];
+    };
+} spi_transaction_t;
+
+typedef struct spi_device_t* spi_device_handle_t;
+
+esp_err_t spi_bus_initialize(spi_host_device_t host, const spi_bus_config_t* config, int dmaChannel);
+esp_err_t spi_bus_free(spi_host_device_t host);
+esp_err_t spi_bus_add_device(spi_host_device_t host, const spi_device_interface_config_t* config,
+                             spi_device_handle_t* handle);
+esp_err_t spi_bus_remove_device(spi_device_handle_t handle);
+esp_err_t spi_device_queue_trans(spi_device_handle_t handle, spi_transaction_t* transaction, TickType_t ticksToWait);
+esp_err_t spi_device_get_trans_result(spi_device_handle_t handle, spi_transaction_t** transaction,
+                                      TickType_t ticksToWait);
+esp_err_t spi_device_polling_transmit(spi_device_handle_t handle, spi_transaction_t* transaction);
+
+#endif // SENSYTHING_HOST_SPI_MASTER_H
@@ -0,0 +1,38 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Host Build - Heap Capabilities Stand-in
+//    Figures come from the host allocation counters (see HostHeap.cpp)
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SENSYTHING_HOST_ESP_HEAP_CAPS_H
+#define SENSYTHING_HOST_ESP_HEAP_CAPS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define MALLOC_CAP_DMA (1 << 3)
+#define MALLOC_CAP_SPIRAM (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+#define MALLOC_CAP_DEFAULT (1 << 12)
+
+void* heap_caps_malloc(size_t size, uint32_t caps);
+void heap_caps_free(void* ptr);
+size_t heap_caps_get_free_size(uint32_t caps);
+size_t heap_caps_get_minimum_free_size(uint32_t caps);
+size_t heap_caps_get_largest_free_block(uint32_t caps);
+size_t heap_caps_get_total_size(uint32_t caps);
+int heap_caps_monitor_local_minimum_free_size_start(void);
+int heap_caps_monitor_local_minimum_free_size_stop(void);
+
+/**
+ * Allocation counters for the whole process: every operator new and
+ * heap_caps_malloc since start
+ */
+uint64_t hostAllocationCount();
+uint64_t hostAllocatedBytes();
+
+#endif // SENSYTHING_HOST_ESP_HEAP_CAPS_H
@@ -0,0 +1,10 @@
+#ifndef SENSYTHING_HOST_ESP_IDF_VERSION_H
+#define SENSYTHING_HOST_ESP_IDF_VERSION_H
+
+#define ESP_IDF_VERSION_VAL(major, minor, patch) (((major) << 16) | ((minor) << 8) | (patch))
+#define ESP_IDF_VERSION_MAJOR 5
+#define ESP_IDF_VERSION_MINOR 1
+#define ESP_IDF_VERSION_PATCH 4
+#define ESP_IDF_VERSION ESP_IDF_VERSION_VAL(5, 1, 4)
+
+#endif
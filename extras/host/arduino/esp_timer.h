@@ -0,0 +1,48 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Host Build - esp_timer Stand-in
+//    Periodic timers on a host thread with an absolute schedule, like the ESP-IDF timer task
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SENSYTHING_HOST_ESP_TIMER_H
+#define SENSYTHING_HOST_ESP_TIMER_H
+
+#include <stdint.h>
+
+typedef int esp_err_t;
+#define ESP_OK 0
+#define ESP_FAIL -1
+#define ESP_ERR_INVALID_STATE 0x103
+#define ESP_ERR_TIMEOUT 0x107
+
+typedef struct esp_timer* esp_timer_handle_t;
+typedef enum { ESP_TIMER_TASK, ESP_TIMER_ISR } esp_timer_dispatch_t;
+
+typedef struct {
+    void (*callback)(void* arg);
+    void* arg;
+    esp_timer_dispatch_t dispatch_method;
+    const char* name;
+    bool skip_unhandled_events;
+} esp_timer_create_args_t;
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t* args, esp_timer_handle_t* handle);
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t periodUs);
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeoutUs);
+
+/**
+ * Stop a timer. As on the target, a callback already running is not waited for.
+ */
+esp_err_t esp_timer_stop(esp_timer_handle_t timer);
+esp_err_t esp_timer_delete(esp_timer_handle_t timer);
+
+/**
+ * Microseconds since the host build started
+ */
+int64_t esp_timer_get_time();
+
+#endif // SENSYTHING_HOST_ESP_TIMER_H
@@ -0,0 +1,83 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Host Build - FreeRTOS Stand-in
+//    Tasks on std::thread, notifications, queues and semaphores on condition variables
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SENSYTHING_HOST_FREERTOS_H
+#define SENSYTHING_HOST_FREERTOS_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef struct HostTask* TaskHandle_t;
+typedef struct HostQueue* QueueHandle_t;
+typedef QueueHandle_t SemaphoreHandle_t;
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define pdFAIL 0
+#define portMAX_DELAY ((TickType_t)0xffffffffUL)
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define configMAX_PRIORITIES 25
+#define tskNO_AFFINITY 0x7fffffff
+#define portYIELD_FROM_ISR(woken) ((void)(woken))
+#define taskYIELD() hostTaskYield()
+
+// Single host address space: a critical section is a process-wide lock
+typedef struct { int unused; } portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED {0}
+void hostEnterCritical();
+void hostExitCritical();
+#define portENTER_CRITICAL(mux) hostEnterCritical()
+#define portEXIT_CRITICAL(mux) hostExitCritical()
+#define portENTER_CRITICAL_ISR(mux) hostEnterCritical()
+#define portEXIT_CRITICAL_ISR(mux) hostExitCritical()
+
+// Tasks. Priority and core are accepted and ignored; the host scheduler decides.
+BaseType_t xTaskCreatePinnedToCore(void (*entry)(void*), const char* name, uint32_t stackDepth,
+                                   void* arg, UBaseType_t priority, TaskHandle_t* handle, BaseType_t core);
+BaseType_t xTaskCreate(void (*entry)(void*), const char* name, uint32_t stackDepth,
+                       void* arg, UBaseType_t priority, TaskHandle_t* handle);
+void vTaskDelete(TaskHandle_t task);
+void vTaskSuspend(TaskHandle_t task);
+void vTaskDelay(TickType_t ticks);
+TaskHandle_t xTaskGetCurrentTaskHandle();
+TickType_t xTaskGetTickCount();
+BaseType_t xPortGetCoreID();
+void hostTaskYield();
+
+// Direct-to-task notifications (counting semaphore use only)
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticksToWait);
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t* higherPriorityTaskWoken);
+
+// Queues
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize);
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t ticksToWait);
+BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t ticksToWait);
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue);
+void vQueueDelete(QueueHandle_t queue);
+
+// Semaphores (a binary semaphore is a one-slot queue of empty items, as in FreeRTOS)
+SemaphoreHandle_t xSemaphoreCreateBinary();
+SemaphoreHandle_t xSemaphoreCreateMutex();
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticksToWait);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore);
+void vSemaphoreDelete(SemaphoreHandle_t semaphore);
+
+/**
+ * Number of tasks created and not yet deleted, for leak checks in tests
+ */
+uint32_t hostLiveTaskCount();
+
+#endif // SENSYTHING_HOST_FREERTOS_H
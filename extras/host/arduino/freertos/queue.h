@@ -0,0 +1,6 @@
+#ifndef SENSYTHING_HOST_FREERTOS_QUEUE_H
+#define SENSYTHING_HOST_FREERTOS_QUEUE_H
+
+#include "FreeRTOS.h"
+
+#endif
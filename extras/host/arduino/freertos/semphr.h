@@ -0,0 +1,6 @@
+#ifndef SENSYTHING_HOST_FREERTOS_SEMPHR_H
+#define SENSYTHING_HOST_FREERTOS_SEMPHR_H
+
+#include "FreeRTOS.h"
+
+#endif
@@ -0,0 +1,6 @@
+#ifndef SENSYTHING_HOST_FREERTOS_TASK_H
+#define SENSYTHING_HOST_FREERTOS_TASK_H
+
+#include "FreeRTOS.h"
+
+#endif
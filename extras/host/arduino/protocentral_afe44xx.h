@@ -0,0 +1,51 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Host Build - AFE44XX Library Stand-in
+//    Every read returns the next conversion of a counter, so tests can tell
+//    which conversions were captured, duplicated or missed
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SENSYTHING_HOST_PROTOCENTRAL_AFE44XX_H
+#define SENSYTHING_HOST_PROTOCENTRAL_AFE44XX_H
+
+#include "Arduino.h"
+
+typedef struct {
+    uint32_t IR_data;
+    uint32_t RED_data;
+    float spo2;
+    uint32_t heart_rate;
+    bool buffer_count_overflow;
+} afe44xx_data;
+
+class AFE44XX {
+public:
+    AFE44XX(int csPin, int pwdnPin) { (void)csPin; (void)pwdnPin; }
+    void afe44xx_init() {}
+
+    /**
+     * Read the latest conversion: IR is the conversion number (from 1), RED
+     * is IR + 100000, SpO2 and heart rate are fixed and valid
+     */
+    bool get_AFE44XX_Data(afe44xx_data* data);
+};
+
+/**
+ * Start a new conversion on the simulated AFE4400; the next read returns it.
+ * Without calls to this, every read starts its own conversion.
+ * @param drdyPin Pin whose interrupt is raised as the result registers
+ *                update, as ADC_RDY does (-1 = none); no read falls between
+ * @return The conversion number
+ */
+uint32_t hostAfe44xxConvert(int drdyPin = -1);
+
+/**
+ * Conversion number of the latest conversion (0 before the first)
+ */
+uint32_t hostAfe44xxLatest();
+
+#endif // SENSYTHING_HOST_PROTOCENTRAL_AFE44XX_H
@@ -0,0 +1,223 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Host Build - Delta Codec Benchmark
+//
+//    Runs SensythingDeltaEncoder, the firmware's own encoder, over a recording
+//    and reports bytes per sample, the compression ratio against the raw
+//    record and the encode cost. The recording is a binary SD log, or by
+//    default the Sim board's OX profile (whole IR/RED counts at 500 Hz,
+//    generated faster than real time). scripts/bench-delta-codec.py drives
+//    this program and decodes its output to check the round trip.
+//
+//    Usage: bench_delta_codec [--quick] [--input log.bin] [--samples n]
+//                             [--keyframe 16,64,256] [--recording out.bin]
+//                             [--output records.bin] [--json]
+//
+//    --recording writes the samples that were encoded as a binary log;
+//    --output writes the records of the first keyframe interval, each
+//    preceded by its length byte.
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#include <SensythingCore.h>
+#include <core/SensythingDeltaCodec.h>
+#include <esp_heap_caps.h>
+#include <fstream>
+#include <sstream>
+#include "HostCheck.h"
+#include "HostLogReader.h"
+
+#define SIM_RATE_HZ 500                          // The OX board's usual output rate
+#define BENCH_MIN_SECONDS 0.2                    // Repeat short recordings for a stable time
+
+/**
+ * Generate the Sim OX profile's signal without waiting for it in real time
+ */
+static std::vector<MeasurementData> simRecording(uint32_t samples) {
+    hostSerialSetOutput(HOST_SERIAL_DISCARD);
+    SensythingSim sim(SENSYTHING_SIM_OX);
+    sim.setGenerationRate(SIM_RATE_HZ);
+    hostSerialSetOutput(HOST_SERIAL_STDOUT);
+
+    std::vector<MeasurementData> recording;
+    recording.reserve(samples);
+    MeasurementData data;
+    memset(&data, 0, sizeof(data));
+    while (recording.size() < samples) {
+        if (!sim.readSample(data)) {
+            hostClockAdvance(1000000 / SIM_RATE_HZ);
+            continue;
+        }
+        data.measurement_count = (uint32_t)recording.size() + 1;
+        recording.push_back(data);
+    }
+    return recording;
+}
+
+static bool readRecording(const char* path, std::vector<MeasurementData>& recording) {
+    std::ifstream in(path, std::ios::binary);
+    std::ostringstream bytes;
+    bytes << in.rdbuf();
+    std::string file = bytes.str();
+
+    std::vector<HostLogRecord> records;
+    if (!in || !hostDecodeLog(file, records)) {
+        return false;
+    }
+    for (size_t i = 0; i < records.size(); i++) {
+        recording.push_back(hostLogSample(records[i], hostLogChannelCount(file)));
+    }
+    return !recording.empty();
+}
+
+static void writeRecording(const char* path, const std::vector<MeasurementData>& recording) {
+    static const ChannelInfo channels[SENSYTHING_MAX_CHANNELS] = {
+        {"CH0", "", 0, 0, true}, {"CH1", "", 0, 0, true}, {"CH2", "", 0, 0, true}, {"CH3", "", 0, 0, true},
+    };
+    BoardConfig config;
+    memset(&config, 0, sizeof(config));
+    config.boardType = BOARD_TYPE_OX;
+    config.boardName = "Sensything recording";
+    config.channelCount = recording[0].channel_count;
+    config.channels = channels;
+
+    // A single block with no trailer; the reader takes its whole records
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    uint8_t buffer[SENSYTHING_LOG_HEADER_MAX_SIZE];
+    out.write((const char*)buffer, sensythingEncodeLogHeader(buffer, config, 0));
+    for (size_t i = 0; i < recording.size(); i++) {
+        out.write((const char*)buffer, sensythingEncodeLogRecord(buffer, recording[i], config.channelCount));
+    }
+}
+
+struct CodecResult {
+    uint16_t keyframeInterval;
+    uint64_t rawBytes;
+    uint64_t encodedBytes;
+    double nsPerRecord;
+    uint64_t allocations;
+};
+
+/**
+ * Encode the whole recording, repeating it until the time is measurable
+ * @param stream Filled with length-prefixed records of the first pass
+ */
+static CodecResult runCodec(const std::vector<MeasurementData>& recording, uint16_t interval,
+                            std::vector<uint8_t>& stream) {
+    SensythingDeltaEncoder encoder;
+    encoder.setKeyframeInterval(interval);
+    uint8_t record[SENSYTHING_DELTA_MAX_RECORD_SIZE];
+    CodecResult result;
+    memset(&result, 0, sizeof(result));
+    result.keyframeInterval = interval;
+
+    stream.clear();
+    for (size_t i = 0; i < recording.size(); i++) {
+        size_t length = encoder.encode(record, recording[i]);
+        stream.push_back((uint8_t)length);
+        stream.insert(stream.end(), record, record + length);
+        result.rawBytes += SENSYTHING_DELTA_RAW_RECORD_SIZE(recording[i].channel_count);
+        result.encodedBytes += length;
+    }
+
+    // Timed passes: nothing but encode() in the loop
+    uint64_t allocationsBefore = hostAllocationCount();
+    uint64_t records = 0;
+    int64_t start = esp_timer_get_time();
+    uint32_t cycles = ESP.getCycleCount();
+    uint64_t totalCycles = 0;
+    do {
+        encoder.reset();
+        for (size_t i = 0; i < recording.size(); i++) {
+            encoder.encode(record, recording[i]);
+        }
+        records += recording.size();
+        uint32_t now = ESP.getCycleCount();
+        totalCycles += now - cycles;
+        cycles = now;
+    } while (esp_timer_get_time() - start < BENCH_MIN_SECONDS * 1000000);
+    result.nsPerRecord = totalCycles * 1000.0 / ESP.getCpuFreqMHz() / records;
+    result.allocations = hostAllocationCount() - allocationsBefore;
+    return result;
+}
+
+int main(int argc, char** argv) {
+    bool quick = hostQuickRun(argc, argv);
+    const char* input = hostOption(argc, argv, "--input", nullptr);
+    uint32_t samples = (uint32_t)atol(hostOption(argc, argv, "--samples", quick ? "5000" : "60000"));
+    const char* keyframes = hostOption(argc, argv, "--keyframe", "64");
+    const char* recordingPath = hostOption(argc, argv, "--recording", nullptr);
+    const char* outputPath = hostOption(argc, argv, "--output", nullptr);
+    bool json = false;
+    for (int i = 1; i < argc; i++) {
+        json = json || strcmp(argv[i], "--json") == 0;
+    }
+
+    std::vector<MeasurementData> recording;
+    if (input) {
+        if (!readRecording(input, recording)) {
+            fprintf(stderr, "cannot read %s as a binary log\n", input);
+            return 2;
+        }
+    } else {
+        recording = simRecording(samples ? samples : 1);
+    }
+    if (recordingPath) {
+        writeRecording(recordingPath, recording);
+    }
+
+    std::vector<CodecResult> results;
+    std::vector<uint8_t> stream;
+    for (const char* next = keyframes; *next;) {
+        char* end;
+        long interval = strtol(next, &end, 10);
+        if (end == next || interval < 1 || interval > 65535 || (*end && *end != ',')) {
+            fprintf(stderr, "--keyframe takes a comma-separated list of intervals (1-65535)\n");
+            return 2;
+        }
+        results.push_back(runCodec(recording, (uint16_t)interval, stream));
+        if (outputPath && results.size() == 1) {
+            std::ofstream out(outputPath, std::ios::binary | std::ios::trunc);
+            out.write((const char*)stream.data(), stream.size());
+        }
+        next = *end ? end + 1 : end;
+    }
+
+    const char* source = input ? input : "Sim OX profile";
+    size_t count = recording.size();
+    if (json) {
+        printf("{\"input\": \"%s\", \"samples\": %zu, \"channels\": %u, \"results\": [", source, count,
+               recording[0].channel_count);
+        for (size_t i = 0; i < results.size(); i++) {
+            const CodecResult& r = results[i];
+            printf("%s{\"keyframe_interval\": %u, \"raw_bytes\": %llu, \"encoded_bytes\": %llu, "
+                   "\"bytes_per_sample\": %.3f, \"ratio\": %.3f, \"encode_ns_per_sample\": %.1f, "
+                   "\"allocations\": %llu}",
+                   i ? ", " : "", r.keyframeInterval, (unsigned long long)r.rawBytes,
+                   (unsigned long long)r.encodedBytes, (double)r.encodedBytes / count,
+                   (double)r.rawBytes / r.encodedBytes, r.nsPerRecord, (unsigned long long)r.allocations);
+        }
+        printf("]}\n");
+    } else {
+        printf("Delta codec, %s: %zu samples, %u channels\n", source, count, recording[0].channel_count);
+        printf("  %-9s %10s %10s %9s %8s %12s %7s\n",
+               "keyframe", "raw", "encoded", "B/sample", "ratio", "ns/sample", "allocs");
+        for (size_t i = 0; i < results.size(); i++) {
+            const CodecResult& r = results[i];
+            printf("  %-9u %10llu %10llu %9.2f %6.2f:1 %12.1f %7llu\n", r.keyframeInterval,
+                   (unsigned long long)r.rawBytes, (unsigned long long)r.encodedBytes,
+                   (double)r.encodedBytes / count, (double)r.rawBytes / r.encodedBytes, r.nsPerRecord,
+                   (unsigned long long)r.allocations);
+        }
+    }
+
+    for (size_t i = 0; i < results.size(); i++) {
+        if (results[i].allocations || results[i].encodedBytes >= results[i].rawBytes) {
+            return 1;
+        }
+    }
+    return 0;
+}
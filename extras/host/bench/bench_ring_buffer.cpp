@@ -0,0 +1,109 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Host Build - Sample Ring Buffer Benchmark
+//
+//    Throughput of the sample ring between a producer and a consumer thread,
+//    and the cost of one push/pop pair without contention, for MeasurementData
+//    records in a ring of SENSYTHING_SAMPLE_RING_SIZE slots.
+//
+//    Usage: bench_ring_buffer [--quick] [--records n]
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#include <SensythingCore.h>
+#include <thread>
+#include "HostCheck.h"
+
+typedef SensythingRingBuffer<MeasurementData, SENSYTHING_SAMPLE_RING_SIZE> SampleRing;
+
+static SampleRing ring;
+
+/**
+ * Push and pop on one thread; the ring never fills
+ * @return Nanoseconds per push/pop pair
+ */
+static double benchUncontended(uint32_t records) {
+    MeasurementData in;
+    MeasurementData out;
+    memset(&in, 0, sizeof(in));
+    uint32_t checksum = 0;
+
+    int64_t start = esp_timer_get_time();
+    for (uint32_t i = 0; i < records; i++) {
+        in.timestamp = i;
+        ring.push(in);
+        ring.pop(out);
+        checksum += out.timestamp;
+    }
+    int64_t elapsed = esp_timer_get_time() - start;
+
+    if (checksum == 1) {
+        printf("\n");                            // Keeps the loop from being optimized away
+    }
+    return elapsed * 1000.0 / records;
+}
+
+/**
+ * Producer and consumer threads, each yielding when the ring is full or empty
+ * @param fullWaits Receives how often the producer found the ring full
+ * @return Records per second
+ */
+static double benchTwoThreads(uint32_t records, uint32_t& fullWaits) {
+    uint32_t waits = 0;
+    int64_t start = esp_timer_get_time();
+
+    std::thread producer([records, &waits]() {
+        MeasurementData data;
+        memset(&data, 0, sizeof(data));
+        for (uint32_t i = 0; i < records; i++) {
+            data.timestamp = i;
+            while (!ring.push(data)) {
+                waits++;
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    MeasurementData data;
+    uint32_t received = 0;
+    uint32_t errors = 0;
+    while (received < records) {
+        if (!ring.pop(data)) {
+            std::this_thread::yield();
+            continue;
+        }
+        if (data.timestamp != received) {
+            errors++;
+        }
+        received++;
+    }
+    producer.join();
+    int64_t elapsed = esp_timer_get_time() - start;
+
+    if (errors) {
+        fprintf(stderr, "%u records out of order\n", errors);
+    }
+    fullWaits = waits;
+    return errors ? 0.0 : records * 1000000.0 / elapsed;
+}
+
+int main(int argc, char** argv) {
+    bool quick = hostQuickRun(argc, argv);
+    uint32_t records = (uint32_t)atol(hostOption(argc, argv, "--records", quick ? "1000000" : "20000000"));
+
+    printf("Sample ring: %u slots of %zu bytes, %u records, %u hardware threads\n",
+           SENSYTHING_SAMPLE_RING_SIZE, sizeof(MeasurementData), records, std::thread::hardware_concurrency());
+
+    double pairNs = benchUncontended(records);
+    printf("  uncontended    %8.1f ns per push+pop\n", pairNs);
+
+    uint32_t fullWaits = 0;
+    double rate = benchTwoThreads(records, fullWaits);
+    printf("  two threads    %8.2f M records/s (%.1f ns/record), producer found it full %u times\n",
+           rate / 1000000.0, rate > 0 ? 1000000000.0 / rate : 0.0, fullWaits);
+
+    return rate > 0 ? 0 : 1;
+}
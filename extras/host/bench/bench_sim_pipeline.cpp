@@ -0,0 +1,109 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Host Build - Sim Pipeline Benchmark
+//
+//    Runs SensythingSim through the full update() pipeline (generate, queue,
+//    filter, format, USB sink) as the Sim_Pipeline_Benchmark example does on
+//    the board, with the console output counted instead of printed. Reports
+//    samples/s, update() latency, dropped samples and allocations per sample.
+//
+//    Usage: bench_sim_pipeline [--quick] [--seconds s] [--rate hz]
+//                              [--profile cap|ox] [--format csv|binary]
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#include <SensythingCore.h>
+#include <esp_heap_caps.h>
+#include "HostCheck.h"
+
+#define BENCH_WARMUP_MS 200                      // Let buffers and formatters reach steady state
+
+int main(int argc, char** argv) {
+    bool quick = hostQuickRun(argc, argv);
+    double seconds = atof(hostOption(argc, argv, "--seconds", quick ? "1" : "5"));
+    uint32_t rate = (uint32_t)atol(hostOption(argc, argv, "--rate", "20000"));
+    bool ox = strcmp(hostOption(argc, argv, "--profile", "cap"), "ox") == 0;
+    String format = hostOption(argc, argv, "--format", "csv");
+
+    hostSerialSetOutput(HOST_SERIAL_DISCARD);
+    SensythingSim sim(ox ? SENSYTHING_SIM_OX : SENSYTHING_SIM_CAP);
+    if (!sim.initPlatform()) {
+        fprintf(stderr, "initPlatform() failed\n");
+        return 1;
+    }
+    sim.processCommand("usb_format " + format);
+    if (!sim.setGenerationRate(rate)) {
+        fprintf(stderr, "rate must be 0-%u Hz\n", SENSYTHING_SIM_MAX_RATE_HZ);
+        return 1;
+    }
+
+    int64_t warmupEnd = esp_timer_get_time() + BENCH_WARMUP_MS * 1000LL;
+    while (esp_timer_get_time() < warmupEnd) {
+        sim.update();
+    }
+
+    // Reserved up front so the timing record itself allocates nothing
+    std::vector<uint32_t> updateCycles;
+    updateCycles.reserve((size_t)(seconds * 4000000));
+    uint64_t busyCycles = 0;                     // Only update() calls that generated samples
+
+    SensythingMetrics before;
+    sim.getMetrics(before);
+    uint32_t generatedBefore = sim.getGeneratedCount();
+    uint32_t skippedBefore = sim.getSkippedCount();
+    uint64_t bytesBefore = hostSerialBytesWritten();
+    uint64_t allocationsBefore = hostAllocationCount();
+
+    int64_t start = esp_timer_get_time();
+    int64_t end = start + (int64_t)(seconds * 1000000);
+    int64_t now = start;
+    while (now < end) {
+        uint32_t generatedSoFar = sim.getGeneratedCount();
+        uint32_t cycles = ESP.getCycleCount();
+        sim.update();
+        cycles = ESP.getCycleCount() - cycles;
+        if (sim.getGeneratedCount() != generatedSoFar) {
+            busyCycles += cycles;
+        }
+        if (updateCycles.size() < updateCycles.capacity()) {
+            updateCycles.push_back(cycles);
+        }
+        now = esp_timer_get_time();
+    }
+    double elapsed = (now - start) / 1000000.0;
+
+    uint64_t allocations = hostAllocationCount() - allocationsBefore;
+    uint64_t bytes = hostSerialBytesWritten() - bytesBefore;
+    SensythingMetrics after;
+    sim.getMetrics(after);
+    uint32_t generated = sim.getGeneratedCount() - generatedBefore;
+    uint32_t skipped = sim.getSkippedCount() - skippedBefore;
+    uint32_t delivered = after.sinks[SENSYTHING_SINK_USB].samplesDelivered -
+                         before.sinks[SENSYTHING_SINK_USB].samplesDelivered;
+    uint32_t dropped = after.samplesDropped - before.samplesDropped;
+    size_t updates = updateCycles.size();
+    double mhz = ESP.getCpuFreqMHz();
+    double p50 = hostPercentile(updateCycles, 0.5) / mhz;
+    double p99 = hostPercentile(updateCycles, 0.99) / mhz;
+    double slowest = updates ? updateCycles.back() / mhz : 0.0;
+
+    hostSerialSetOutput(HOST_SERIAL_STDOUT);
+    printf("Sim pipeline, %s profile, USB %s, %u Hz requested, %.1f s\n",
+           ox ? "ox" : "cap", format.c_str(), rate, elapsed);
+    printf("  generated      %10u  (%.0f samples/s)\n", generated, generated / elapsed);
+    printf("  delivered USB  %10u  (%.0f samples/s, %.1f bytes/sample)\n",
+           delivered, delivered / elapsed, delivered ? (double)bytes / delivered : 0.0);
+    printf("  skipped        %10u  (generator more than %u ms behind)\n", skipped, SENSYTHING_SIM_MAX_LAG_MS);
+    printf("  dropped        %10u  (sample ring full)\n", dropped);
+    printf("  queue peak     %10u  of %u\n", after.queuePeak, SENSYTHING_SAMPLE_RING_SIZE);
+    printf("  update() us    p50 %.2f, p99 %.2f, max %.1f over %zu calls\n", p50, p99, slowest, updates);
+    printf("  CPU us/sample  %10.3f  (busy update() time per generated sample)\n",
+           generated ? busyCycles / mhz / generated : 0.0);
+    printf("  allocations    %10llu  (%.3f per sample)\n",
+           (unsigned long long)allocations, generated ? (double)allocations / generated : 0.0);
+
+    return generated > 0 && delivered > 0 ? 0 : 1;
+}
@@ -0,0 +1,107 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Host Build - Test and Benchmark Helpers
+//    Minimal checks for the host tests; each test file is its own executable
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SENSYTHING_HOST_CHECK_H
+#define SENSYTHING_HOST_CHECK_H
+
+#include <Arduino.h>
+#include <algorithm>
+#include <vector>
+
+static int hostCheckFailures = 0;
+
+#define CHECK(condition)                                                                    \
+    do {                                                                                    \
+        if (!(condition)) {                                                                 \
+            fprintf(stderr, "%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #condition);    \
+            hostCheckFailures++;                                                            \
+        }                                                                                   \
+    } while (0)
+
+#define CHECK_EQ(actual, expected)                                                          \
+    do {                                                                                    \
+        long long checkActual = (long long)(actual);                                        \
+        long long checkExpected = (long long)(expected);                                    \
+        if (checkActual != checkExpected) {                                                 \
+            fprintf(stderr, "%s:%d: CHECK_EQ failed: %s == %lld, expected %lld\n",          \
+                    __FILE__, __LINE__, #actual, checkActual, checkExpected);               \
+            hostCheckFailures++;                                                            \
+        }                                                                                   \
+    } while (0)
+
+#define CHECK_NEAR(actual, expected, tolerance)                                             \
+    do {                                                                                    \
+        double checkActual = (double)(actual);                                              \
+        double checkExpected = (double)(expected);                                          \
+        if (!(fabs(checkActual - checkExpected) <= (double)(tolerance))) {                  \
+            fprintf(stderr, "%s:%d: CHECK_NEAR failed: %s == %g, expected %g +/- %g\n",     \
+                    __FILE__, __LINE__, #actual, checkActual, checkExpected, (double)(tolerance)); \
+            hostCheckFailures++;                                                            \
+        }                                                                                   \
+    } while (0)
+
+/**
+ * Run one named test case and report it
+ */
+#define RUN_TEST(function)                                                                  \
+    do {                                                                                    \
+        int failuresBefore = hostCheckFailures;                                             \
+        function();                                                                         \
+        printf("%s %s\n", hostCheckFailures == failuresBefore ? "PASS" : "FAIL", #function); \
+    } while (0)
+
+/**
+ * Exit status for main(): 0 when every check passed
+ */
+inline int hostCheckResult() {
+    if (hostCheckFailures) {
+        fprintf(stderr, "%d check(s) failed\n", hostCheckFailures);
+    }
+    return hostCheckFailures ? 1 : 0;
+}
+
+/**
+ * True when the benchmark was started with --quick (the ctest smoke run)
+ */
+inline bool hostQuickRun(int argc, char** argv) {
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--quick") == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Value of "--name value" on the command line, or the fallback
+ */
+inline const char* hostOption(int argc, char** argv, const char* name, const char* fallback) {
+    for (int i = 1; i + 1 < argc; i++) {
+        if (strcmp(argv[i], name) == 0) {
+            return argv[i + 1];
+        }
+    }
+    return fallback;
+}
+
+/**
+ * Percentile of a set of timings (sorts the samples in place)
+ * @param fraction 0.5 for the median, 0.99 for p99
+ */
+inline uint32_t hostPercentile(std::vector<uint32_t>& samples, double fraction) {
+    if (samples.empty()) {
+        return 0;
+    }
+    std::sort(samples.begin(), samples.end());
+    size_t index = (size_t)(fraction * (samples.size() - 1) + 0.5);
+    return samples[index];
+}
+
+#endif // SENSYTHING_HOST_CHECK_H
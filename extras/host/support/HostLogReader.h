@@ -0,0 +1,119 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Host Build - Binary Log Reader
+//    Reads binary SD logs (SensythingLogFormat.h) back into records, for the
+//    tests that check the writer and the benchmarks that replay recordings
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SENSYTHING_HOST_LOG_READER_H
+#define SENSYTHING_HOST_LOG_READER_H
+
+#include <core/SensythingCRC.h>
+#include <core/SensythingLogFormat.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+// A record as stored, and whether a sync trailer covered it
+struct HostLogRecord {
+    uint8_t bytes[SENSYTHING_LOG_RECORD_MAX_SIZE];
+    bool verified;
+};
+
+/**
+ * Decode a log as the format documents: records are trusted when a sync
+ * trailer's count and CRC check out; bytes past the last trailer yield their
+ * whole records as unverified
+ * @return false if the header is missing or damaged
+ */
+inline bool hostDecodeLog(const std::string& file, std::vector<HostLogRecord>& records) {
+    const uint8_t* data = (const uint8_t*)file.data();
+    size_t length = file.size();
+    if (length < 14 || memcmp(data, SENSYTHING_LOG_MAGIC, 4) != 0) {
+        return false;
+    }
+    uint16_t headerSize;
+    memcpy(&headerSize, &data[8], 2);
+    if (length < headerSize) {
+        return false;
+    }
+    uint16_t headerCRC;
+    memcpy(&headerCRC, &data[headerSize - 2], 2);
+    if (sensythingCRC16(data, headerSize - 2) != headerCRC) {
+        return false;
+    }
+
+    size_t size = data[7];
+    size_t pos = headerSize;
+    size_t search = pos;
+    while (true) {
+        const uint8_t* found = search < length ? (const uint8_t*)memmem(&data[search], length - search,
+                                                                        SENSYTHING_LOG_SYNC_MARKER, 4) : nullptr;
+        size_t marker = found ? (size_t)(found - data) : length;
+        if (!found || marker + SENSYTHING_LOG_SYNC_SIZE > length) {
+            for (size_t offset = pos; offset + size <= length; offset += size) {
+                HostLogRecord record;
+                memcpy(record.bytes, &data[offset], size);
+                record.verified = false;
+                records.push_back(record);
+            }
+            return true;
+        }
+
+        uint16_t count;
+        uint16_t crc;
+        memcpy(&count, &data[marker + 4], 2);
+        memcpy(&crc, &data[marker + 6], 2);
+        if (marker < pos + (size_t)count * size) {
+            search = marker + 1;                 // Marker bytes inside record data
+            continue;
+        }
+        size_t block = marker - (size_t)count * size;
+        if (block != pos || sensythingCRC16(&data[block], marker - block) != crc) {
+            search = marker + 1;                 // Not a trailer for the bytes since the last one
+            continue;
+        }
+        for (size_t offset = block; offset < marker; offset += size) {
+            HostLogRecord record;
+            memcpy(record.bytes, &data[offset], size);
+            record.verified = true;
+            records.push_back(record);
+        }
+        pos = marker + SENSYTHING_LOG_SYNC_SIZE;
+        search = pos;
+    }
+}
+
+/**
+ * Channel count of a log whose header hostDecodeLog() accepted
+ */
+inline uint8_t hostLogChannelCount(const std::string& file) {
+    return (uint8_t)file[6];
+}
+
+/**
+ * Unpack a record into a sample
+ * @param channelCount Channels per record (from the header)
+ */
+inline MeasurementData hostLogSample(const HostLogRecord& record, uint8_t channelCount) {
+    MeasurementData data;
+    memset(&data, 0, sizeof(data));
+    size_t index = 0;
+    memcpy(&data.timestamp, &record.bytes[index], 4);
+    index += 4;
+    memcpy(&data.measurement_count, &record.bytes[index], 4);
+    index += 4;
+    memcpy(data.channels, &record.bytes[index], 4 * channelCount);
+    index += 4 * channelCount;
+    memcpy(data.metadata, &record.bytes[index], channelCount);
+    index += channelCount;
+    data.status_flags = record.bytes[index];
+    data.channel_count = channelCount;
+    return data;
+}
+
+#endif // SENSYTHING_HOST_LOG_READER_H
@@ -0,0 +1,316 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Host Build - Binary Log Tests
+//
+//    Writes a binary log through SensythingSDCard onto a host directory,
+//    then reads it back: every record must round-trip bit for bit and every
+//    sync trailer must verify. The log is then cut at every few bytes and
+//    decoded by support/HostLogReader.h; a cut may only lose the records it
+//    actually removed. With --converter, the truncated
+//    files are also run through scripts/convert-sd-log.py.
+//
+//    Usage: test_binary_log [--dir path] [--converter convert-sd-log.py]
+//                           [--python python3]
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#include <SensythingCore.h>
+#include <communication/SensythingSDCard.h>
+#include <sys/stat.h>
+#include <fstream>
+#include <sstream>
+#include "HostCheck.h"
+#include "HostLogReader.h"
+
+#define LOG_RECORDS 1000
+#define LOG_FLUSH_AT 300                         // An early sync closes a short block
+#define LOG_CHANNELS 4
+#define CUT_STRIDE 7                             // Cut points between the header and the end
+#define CONVERTER_CUTS 6                         // Truncated files also run through the converter
+
+static const ChannelInfo TEST_CHANNELS[LOG_CHANNELS] = {
+    {"CH0", "pF", 0.0f, 100.0f, true},
+    {"CH1", "pF", 0.0f, 100.0f, true},
+    {"CH2", "pF", 0.0f, 100.0f, true},
+    {"CH3", "pF", 0.0f, 100.0f, true},
+};
+
+static const BoardConfig TEST_CONFIG = {
+    BOARD_TYPE_CAP, "Sensything Cap", "FDC1004 Capacitance",
+    LOG_CHANNELS, TEST_CHANNELS, true,
+    -1, -1, -1, -1, -1, -1,
+    1, 1000
+};
+
+static std::string logDir = "binary_log_test";
+static std::string converter;
+static std::string python = "python3";
+
+// Where each complete sync block ends, from the intact file
+struct SyncPoint {
+    size_t end;                                  // Offset just past the trailer
+    uint32_t records;                            // Records up to and including this block
+};
+
+static float floatFromBits(uint32_t bits) {
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+/**
+ * Sample k of the test log: a ramp per channel, plus values a byte-level
+ * reader could trip on (NaN, -0, infinity, a denormal, "SYNC" inside a record)
+ */
+static MeasurementData testSample(uint32_t k) {
+    MeasurementData data;
+    memset(&data, 0, sizeof(data));
+    data.timestamp = 1000 + k * 10;
+    data.measurement_count = k + 1;
+    data.channel_count = LOG_CHANNELS;
+    for (uint8_t i = 0; i < LOG_CHANNELS; i++) {
+        data.channels[i] = 10.0f * i + k * 0.001f;
+        data.metadata[i] = (uint8_t)((k + i) % 32);
+    }
+    switch (k) {
+        case 7:  data.channels[0] = NAN; break;
+        case 8:  data.channels[1] = -0.0f; break;
+        case 9:  data.channels[2] = INFINITY; data.channels[3] = -INFINITY; break;
+        case 10: data.channels[0] = floatFromBits(0x00000001); break;
+        case 20:
+            data.channels[1] = floatFromBits(0x434E5953);  // Bytes "SYNC"
+            data.channels[2] = floatFromBits(0x4120FFFF);  // Its count field points before the file
+            break;
+    }
+    if (k % 50 == 0) {
+        data.status_flags = 1 << 2;              // Failed channel, logged as NaN
+        data.channels[2] = NAN;
+    }
+    return data;
+}
+
+static std::string readFile(const std::string& path) {
+    std::ifstream in(path.c_str(), std::ios::binary);
+    std::ostringstream bytes;
+    bytes << in.rdbuf();
+    return bytes.str();
+}
+
+static void writeFile(const std::string& path, const std::string& bytes) {
+    std::ofstream out(path.c_str(), std::ios::binary | std::ios::trunc);
+    out.write(bytes.data(), bytes.size());
+}
+
+static bool sameAsSample(const HostLogRecord& record, uint32_t k) {
+    uint8_t expected[SENSYTHING_LOG_RECORD_MAX_SIZE];
+    size_t size = sensythingEncodeLogRecord(expected, testSample(k), LOG_CHANNELS);
+    return memcmp(record.bytes, expected, size) == 0;
+}
+
+/**
+ * Write the test log through the SD card sink
+ * @return Path of the log on the host
+ */
+static std::string writeTestLog() {
+    mkdir(logDir.c_str(), 0755);
+    remove((logDir + "/" + SENSYTHING_SD_FILE_PREFIX + "1.bin").c_str());
+    SD_MMC.setRoot(logDir);
+
+    hostSerialSetOutput(HOST_SERIAL_DISCARD);
+    SensythingSDCard* card = new SensythingSDCard();
+    CHECK(card->init());
+    card->setFormat(SENSYTHING_SD_BINARY);
+    for (uint32_t k = 0; k < LOG_RECORDS; k++) {
+        card->logData(testSample(k), TEST_CONFIG);
+        if (k + 1 == LOG_FLUSH_AT) {
+            card->flush();
+        }
+        if (k % SENSYTHING_SD_BINARY_SYNC_RECORDS == 0) {
+            delay(1);                            // Samples arrive over time; let the writer keep up
+        }
+    }
+    SinkStats stats = card->getSinkStats();
+    String fileName = card->getCurrentFileName();
+    delete card;                                 // Writes the last block and closes the file
+    hostSerialSetOutput(HOST_SERIAL_STDOUT);
+
+    CHECK_EQ(stats.samplesDelivered, LOG_RECORDS);
+    CHECK_EQ(stats.samplesDropped, 0);
+    return logDir + "/" + fileName.c_str();
+}
+
+static std::string intactLog;
+static std::vector<SyncPoint> syncPoints;
+
+static void testRoundTrip() {
+    intactLog = readFile(writeTestLog());
+    size_t recordSize = sensythingLogRecordSize(LOG_CHANNELS);
+
+    std::vector<HostLogRecord> records;
+    CHECK(hostDecodeLog(intactLog, records));
+    CHECK_EQ(records.size(), LOG_RECORDS);
+    uint32_t mismatched = 0;
+    uint32_t unverified = 0;
+    for (size_t k = 0; k < records.size(); k++) {
+        mismatched += sameAsSample(records[k], k) ? 0 : 1;
+        unverified += records[k].verified ? 0 : 1;
+    }
+    CHECK_EQ(mismatched, 0);
+    CHECK_EQ(unverified, 0);
+
+    // Header as documented
+    uint16_t headerSize;
+    memcpy(&headerSize, &intactLog[8], 2);
+    CHECK_EQ(intactLog[4], SENSYTHING_LOG_VERSION);
+    CHECK_EQ(intactLog[6], LOG_CHANNELS);
+    CHECK_EQ((uint8_t)intactLog[7], recordSize);
+    CHECK_EQ(headerSize, 44 + LOG_CHANNELS * 48 + 2);
+
+    // Walk the trailers: full blocks, the short block closed by flush(), and the last one
+    syncPoints.clear();
+    size_t pos = headerSize;
+    uint32_t total = 0;
+    while (pos < intactLog.size()) {
+        size_t marker = intactLog.find(SENSYTHING_LOG_SYNC_MARKER, pos);
+        while (marker != std::string::npos && (marker - pos) % recordSize != 0) {
+            marker = intactLog.find(SENSYTHING_LOG_SYNC_MARKER, marker + 1);
+        }
+        if (marker == std::string::npos) {
+            break;
+        }
+        uint16_t count;
+        memcpy(&count, &intactLog[marker + 4], 2);
+        CHECK_EQ(count * recordSize, marker - pos);
+        total += count;
+        pos = marker + SENSYTHING_LOG_SYNC_SIZE;
+        SyncPoint point = {pos, total};
+        syncPoints.push_back(point);
+    }
+    CHECK_EQ(pos, intactLog.size());
+    CHECK_EQ(total, LOG_RECORDS);
+    CHECK(syncPoints.size() >= LOG_RECORDS / SENSYTHING_SD_BINARY_SYNC_RECORDS + 1);
+    printf("  %u records, %u sync blocks, %u bytes\n", LOG_RECORDS, (unsigned)syncPoints.size(),
+           (unsigned)intactLog.size());
+}
+
+/**
+ * Records a log cut to `length` bytes must still yield: those of the
+ * complete blocks (verified), then the whole records after them
+ */
+static void expectedAfterCut(size_t length, uint32_t& verified, uint32_t& unverified) {
+    uint16_t headerSize;
+    memcpy(&headerSize, &intactLog[8], 2);
+    size_t pos = headerSize;
+    verified = 0;
+    for (size_t i = 0; i < syncPoints.size() && syncPoints[i].end <= length; i++) {
+        pos = syncPoints[i].end;
+        verified = syncPoints[i].records;
+    }
+    unverified = (uint32_t)((length - pos) / sensythingLogRecordSize(LOG_CHANNELS));
+    if (verified + unverified > LOG_RECORDS) {
+        unverified = LOG_RECORDS - verified;
+    }
+}
+
+static void testTruncation() {
+    uint16_t headerSize;
+    memcpy(&headerSize, &intactLog[8], 2);
+
+    // A cut header is rejected, not misread
+    for (size_t length = 0; length < headerSize; length++) {
+        std::vector<HostLogRecord> records;
+        CHECK(!hostDecodeLog(intactLog.substr(0, length), records));
+    }
+
+    uint32_t cuts = 0;
+    uint32_t wrong = 0;
+    for (size_t length = headerSize; length <= intactLog.size(); length += CUT_STRIDE) {
+        std::vector<HostLogRecord> records;
+        uint32_t verified;
+        uint32_t unverified;
+        expectedAfterCut(length, verified, unverified);
+        CHECK(hostDecodeLog(intactLog.substr(0, length), records));
+
+        bool ok = records.size() == verified + unverified;
+        for (size_t k = 0; ok && k < records.size(); k++) {
+            ok = sameAsSample(records[k], k) && records[k].verified == (k < verified);
+        }
+        wrong += ok ? 0 : 1;
+        cuts++;
+    }
+    CHECK_EQ(wrong, 0);
+    printf("  %u cut points, every surviving record intact\n", cuts);
+}
+
+/**
+ * Rows of the converter's CSV: count column and verified column
+ */
+static bool runConverter(const std::string& input, std::vector<std::pair<uint32_t, bool> >& rows) {
+    std::string output = input + ".csv";
+    std::string command = python + " -B \"" + converter + "\" \"" + input + "\" --output \"" + output +
+                          "\" 2>/dev/null";
+    if (system(command.c_str()) != 0) {
+        return false;
+    }
+    std::istringstream lines(readFile(output));
+    std::string line;
+    std::getline(lines, line);                   // Column names
+    while (std::getline(lines, line)) {
+        size_t firstComma = line.find(',');
+        size_t lastComma = line.rfind(',');
+        rows.push_back(std::make_pair((uint32_t)strtoul(line.c_str() + firstComma + 1, nullptr, 10),
+                                      line.substr(lastComma + 1) == "1"));
+    }
+    return true;
+}
+
+static void testConverterTruncation() {
+    if (converter.empty()) {
+        printf("  skipped: no --converter given\n");
+        return;
+    }
+
+    // The intact file, then cuts inside a record, inside a trailer and just past one
+    size_t recordSize = sensythingLogRecordSize(LOG_CHANNELS);
+    size_t cuts[CONVERTER_CUTS] = {
+        intactLog.size(),
+        syncPoints[3].end + 5 * recordSize + 11,
+        syncPoints[4].end - 3,
+        syncPoints[4].end,
+        syncPoints[syncPoints.size() - 2].end + 1,
+        intactLog.size() - 1,
+    };
+    for (int i = 0; i < CONVERTER_CUTS; i++) {
+        std::string path = logDir + "/cut_" + std::to_string(cuts[i]) + ".bin";
+        writeFile(path, intactLog.substr(0, cuts[i]));
+
+        std::vector<std::pair<uint32_t, bool> > rows;
+        uint32_t verified;
+        uint32_t unverified;
+        expectedAfterCut(cuts[i], verified, unverified);
+        CHECK(runConverter(path, rows));
+        CHECK_EQ(rows.size(), verified + unverified);
+        uint32_t wrong = 0;
+        for (size_t k = 0; k < rows.size(); k++) {
+            if (rows[k].first != k + 1 || rows[k].second != (k < verified)) {
+                wrong++;
+            }
+        }
+        CHECK_EQ(wrong, 0);
+    }
+    printf("  %d files converted by %s\n", CONVERTER_CUTS, converter.c_str());
+}
+
+int main(int argc, char** argv) {
+    logDir = hostOption(argc, argv, "--dir", logDir.c_str());
+    converter = hostOption(argc, argv, "--converter", "");
+    python = hostOption(argc, argv, "--python", python.c_str());
+
+    RUN_TEST(testRoundTrip);
+    RUN_TEST(testTruncation);
+    RUN_TEST(testConverterTruncation);
+    return hostCheckResult();
+}
@@ -0,0 +1,176 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Host Build - Decimator Tests
+//
+//    Feeds SensythingDecimator white noise on a large offset (AFE4400-sized
+//    counts) and checks that each ratio lowers the noise by sqrt(ratio)
+//    without losing resolution, that blocks come out at the right cadence
+//    and timestamp, and that failed channel reads are left out of the
+//    average instead of dragging it towards the 0.0 placeholder.
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#include <SensythingCore.h>
+#include <dsp/SensythingDecimator.h>
+#include "HostCheck.h"
+
+#define NOISE_OFFSET 2000000.0                   // 22-bit AFE4400 counts
+#define NOISE_SIGMA 4.0
+#define NOISE_OUTPUTS 20000                      // Output samples per ratio
+
+static uint64_t noiseState = 0x9E3779B97F4A7C15ULL;
+
+// Uniform in (0, 1) from a 64-bit xorshift
+static double uniform() {
+    noiseState ^= noiseState << 13;
+    noiseState ^= noiseState >> 7;
+    noiseState ^= noiseState << 17;
+    return ((noiseState >> 11) + 0.5) / 9007199254740992.0;
+}
+
+// Standard normal (Box-Muller)
+static double gaussian() {
+    return sqrt(-2.0 * log(uniform())) * cos(2.0 * M_PI * uniform());
+}
+
+static MeasurementData read(uint32_t timestamp, float channel0, float channel1, uint8_t flags) {
+    MeasurementData data;
+    memset(&data, 0, sizeof(data));
+    data.timestamp = timestamp;
+    data.channel_count = 2;
+    data.channels[0] = channel0;
+    data.channels[1] = channel1;
+    data.status_flags = flags;
+    return data;
+}
+
+static void testNoiseFallsBySqrtRatio() {
+    const uint8_t ratios[] = {1, 2, 4, 8, 16, 32};
+    for (size_t r = 0; r < sizeof(ratios); r++) {
+        SensythingDecimator decimator;
+        decimator.setRatio(ratios[r]);
+
+        double sum = 0.0;
+        double squares = 0.0;
+        double worstRounding = 0.0;
+        double blockSum = 0.0;
+        uint32_t outputs = 0;
+        uint32_t reads = 0;
+        while (outputs < NOISE_OUTPUTS) {
+            float x = (float)(NOISE_OFFSET + NOISE_SIGMA * gaussian());
+            MeasurementData data = read(reads++, x, 0.0f, 0);
+            blockSum += x;
+            if (!decimator.push(data)) {
+                continue;
+            }
+
+            // Each output is the exact block mean to within float resolution
+            double exact = blockSum / ratios[r];
+            double rounding = fabs(data.channels[0] - exact);
+            worstRounding = rounding > worstRounding ? rounding : worstRounding;
+            blockSum = 0.0;
+
+            double deviation = data.channels[0] - NOISE_OFFSET;
+            sum += deviation;
+            squares += deviation * deviation;
+            outputs++;
+        }
+        CHECK_EQ(reads, (uint32_t)NOISE_OUTPUTS * ratios[r]);
+
+        double mean = sum / outputs;
+        double sigma = sqrt(squares / outputs - mean * mean);
+        double expected = NOISE_SIGMA / sqrt((double)ratios[r]);
+        CHECK_NEAR(sigma / expected, 1.0, 0.05);
+        CHECK_NEAR(mean, 0.0, 5.0 * expected / sqrt((double)outputs) + 0.125);
+        CHECK(worstRounding <= 0.125);           // One float step at 2^21
+        printf("  ratio %2u: noise %.3f (expected %.3f), worst rounding %.4f\n",
+               ratios[r], sigma, expected, worstRounding);
+    }
+}
+
+static void testCadenceAndTimestamp() {
+    SensythingDecimator decimator;
+    decimator.setRatio(4);
+    uint32_t outputs = 0;
+    for (uint32_t n = 0; n < 40; n++) {
+        MeasurementData data = read(1000 + n * 10, (float)n, 0.0f, 0);
+        bool ready = decimator.push(data);
+        CHECK_EQ(ready, n % 4 == 3);
+        if (ready) {
+            uint32_t first = n - 3;
+            CHECK_EQ(data.timestamp, 1000 + first * 10 + 15);  // Middle of the block
+            CHECK_NEAR(data.channels[0], first + 1.5f, 0.0f);
+            outputs++;
+        }
+    }
+    CHECK_EQ(outputs, 10);
+
+    // A new ratio drops the partial block
+    MeasurementData partial = read(0, 100.0f, 0.0f, 0);
+    decimator.push(partial);
+    decimator.setRatio(2);
+    MeasurementData a = read(0, 1.0f, 0.0f, 0);
+    MeasurementData b = read(10, 3.0f, 0.0f, 0);
+    CHECK(!decimator.push(a));
+    CHECK(decimator.push(b));
+    CHECK_NEAR(b.channels[0], 2.0f, 0.0f);
+
+    // Ratio 1 (and 0) passes samples through untouched
+    decimator.setRatio(0);
+    CHECK_EQ(decimator.getRatio(), 1);
+    MeasurementData raw = read(5, 7.25f, -1.5f, SENSYTHING_STATUS_CH1_FAIL);
+    MeasurementData copy = raw;
+    CHECK(decimator.push(raw));
+    CHECK(memcmp(&raw, &copy, sizeof(raw)) == 0);
+}
+
+static void testFailedReadsLeftOut() {
+    SensythingDecimator decimator;
+    decimator.setRatio(4);
+
+    // Channel 0 fails on two reads (0.0 placeholders); channel 1 on all four
+    MeasurementData reads[4] = {
+        read(0, 10.0f, 0.0f, SENSYTHING_STATUS_CH1_FAIL),
+        read(1, 0.0f, 0.0f, SENSYTHING_STATUS_CH0_FAIL | SENSYTHING_STATUS_CH1_FAIL),
+        read(2, 14.0f, 0.0f, SENSYTHING_STATUS_CH1_FAIL | SENSYTHING_STATUS_NO_SIGNAL),
+        read(3, 0.0f, 0.0f, SENSYTHING_STATUS_CH0_FAIL | SENSYTHING_STATUS_CH1_FAIL),
+    };
+    for (int n = 0; n < 3; n++) {
+        CHECK(!decimator.push(reads[n]));
+    }
+    CHECK(decimator.push(reads[3]));
+    CHECK_NEAR(reads[3].channels[0], 12.0f, 0.0f);     // Mean of the two good reads
+    CHECK_NEAR(reads[3].channels[1], 0.0f, 0.0f);
+    CHECK_EQ(reads[3].status_flags, SENSYTHING_STATUS_CH1_FAIL | SENSYTHING_STATUS_NO_SIGNAL);
+
+    // The next block starts clean: no fail bit or board flag carries over
+    for (int n = 0; n < 4; n++) {
+        MeasurementData data = read(10 + n, 20.0f + n, 30.0f, 0);
+        if (decimator.push(data)) {
+            CHECK_EQ(data.status_flags, 0);
+            CHECK_NEAR(data.channels[0], 21.5f, 0.0f);
+            CHECK_NEAR(data.channels[1], 30.0f, 0.0f);
+        }
+    }
+
+    // The first valid read anchors the sum even when it is not the block's first
+    MeasurementData late[2] = {
+        read(0, 0.0f, 5.0f, SENSYTHING_STATUS_CH0_FAIL),
+        read(1, 2000000.5f, 5.0f, 0),
+    };
+    decimator.setRatio(2);
+    CHECK(!decimator.push(late[0]));
+    CHECK(decimator.push(late[1]));
+    CHECK_NEAR(late[1].channels[0], 2000000.5f, 0.0f);
+    CHECK_EQ(late[1].status_flags, 0);
+}
+
+int main() {
+    RUN_TEST(testNoiseFallsBySqrtRatio);
+    RUN_TEST(testCadenceAndTimestamp);
+    RUN_TEST(testFailedReadsLeftOut);
+    return hostCheckResult();
+}
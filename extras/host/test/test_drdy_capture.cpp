@@ -0,0 +1,171 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Host Build - OX DRDY Capture Tests
+//
+//    A source thread plays the AFE4400: it starts a conversion, then raises
+//    the DRDY edge, which runs the board's ISR. The AFE44XX stand-in reports
+//    the conversion number as IR, so the captured CSV shows exactly which
+//    conversions were streamed. Every conversion must be streamed once or
+//    counted as an overrun, never both and never twice.
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#include <SensythingCore.h>
+#include <protocentral_afe44xx.h>
+#include <atomic>
+#include <sstream>
+#include <thread>
+#include "HostCheck.h"
+
+#define OX_DRDY_PIN 14                           // SensythingOX::PIN_AFE_DRDY
+#define PACED_EDGES 1000                         // At the AFE4400's 1 ms conversion period
+#define FLOOD_EDGES 20000                        // Back to back, faster than any reader
+#define SETTLE_TIMEOUT_MS 3000
+
+/**
+ * Raise `edges` DRDY edges, each after a fresh conversion
+ * @param periodUs Time between edges; a paced source also waits until the
+ *                 board has taken the previous edge, standing in for a reader
+ *                 that keeps up (0 = flood, as fast as possible)
+ */
+static void runSource(SensythingOX& ox, uint32_t edges, uint32_t periodUs, std::atomic<bool>& done) {
+    int64_t next = esp_timer_get_time();
+    for (uint32_t i = 0; i < edges; i++) {
+        if (periodUs) {
+            uint32_t start = millis();
+            while (ox.getDataReadyCount() + ox.getDataReadyOverruns() < i && millis() - start < SETTLE_TIMEOUT_MS) {
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+            }
+            next += periodUs;
+            while (esp_timer_get_time() < next) {
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+            }
+        }
+        hostAfe44xxConvert(OX_DRDY_PIN);
+        if (!periodUs) {
+            std::this_thread::yield();           // Let the reader interleave with the edges
+        }
+    }
+    done = true;
+}
+
+/**
+ * IR values (conversion numbers) and timestamps of the captured CSV data lines
+ */
+static void capturedConversions(std::vector<uint32_t>& conversions, std::vector<uint32_t>& timestamps) {
+    std::istringstream lines(hostSerialTakeOutput());
+    std::string line;
+    while (std::getline(lines, line)) {
+        if (line.find(",0x") == std::string::npos) {
+            continue;
+        }
+        size_t firstComma = line.find(',');
+        size_t digits = line.find_last_not_of("0123456789", firstComma - 1) + 1;
+        timestamps.push_back((uint32_t)strtoul(line.c_str() + digits, nullptr, 10));
+        conversions.push_back((uint32_t)strtod(line.c_str() + firstComma + 1, nullptr));
+    }
+}
+
+/**
+ * Capture `edges` conversions in DRDY mode and check the accounting
+ * @return Overruns reported by the board
+ */
+static uint32_t captureRun(bool burst, uint32_t edges, uint32_t periodUs) {
+    hostSerialSetOutput(HOST_SERIAL_DISCARD);
+    SensythingOX ox;
+    CHECK(ox.initPlatform());
+    ox.setBurstRead(burst);
+    ox.update();                                 // Switches the read path
+    CHECK(ox.enableDataReadyMode(true));
+    hostSerialTakeOutput();
+    hostSerialSetOutput(HOST_SERIAL_CAPTURE);
+
+    uint32_t first = hostAfe44xxLatest() + 1;
+    std::atomic<bool> done(false);
+    std::thread source(runSource, std::ref(ox), edges, periodUs, std::ref(done));
+    while (!done) {
+        ox.update();
+        delayMicroseconds(100);                  // On the board the higher-priority task preempts loop()
+    }
+    source.join();
+
+    // Let the task take every notification before it is stopped
+    uint32_t start = millis();
+    while (ox.getDataReadyCount() + ox.getDataReadyOverruns() < edges && millis() - start < SETTLE_TIMEOUT_MS) {
+        ox.update();
+    }
+    for (int i = 0; i < 10; i++) {
+        ox.update();
+    }
+    CHECK(ox.enableDataReadyMode(false));
+    ox.stopMeasurements();
+    for (int i = 0; i < 10; i++) {
+        ox.update();
+    }
+
+    std::vector<uint32_t> conversions;
+    std::vector<uint32_t> timestamps;
+    capturedConversions(conversions, timestamps);
+    hostSerialSetOutput(HOST_SERIAL_STDOUT);
+
+    uint32_t duplicatesOrReordered = 0;
+    uint32_t outOfRange = 0;
+    uint32_t timeReversals = 0;
+    for (size_t i = 0; i < conversions.size(); i++) {
+        if (conversions[i] < first || conversions[i] >= first + edges) {
+            outOfRange++;
+        }
+        if (i > 0 && conversions[i] <= conversions[i - 1]) {
+            duplicatesOrReordered++;
+        }
+        if (i > 0 && timestamps[i] < timestamps[i - 1]) {
+            timeReversals++;
+        }
+    }
+
+    uint32_t overruns = ox.getDataReadyOverruns();
+    CHECK_EQ(duplicatesOrReordered, 0);
+    CHECK_EQ(outOfRange, 0);
+    CHECK_EQ(timeReversals, 0);
+    CHECK_EQ(conversions.size() + overruns, edges);  // Each conversion streamed or counted, once
+    CHECK_EQ(ox.getDroppedSampleCount(), 0);
+    printf("  %s path: %u edges, %u streamed, %u overruns\n",
+           burst ? "burst" : "library", edges, (unsigned)conversions.size(), overruns);
+    return overruns;
+}
+
+static void testPacedLibraryRead() {
+    CHECK_EQ(captureRun(false, PACED_EDGES, 1000), 0);
+}
+
+static void testPacedBurstRead() {
+    CHECK_EQ(captureRun(true, PACED_EDGES, 1000), 0);
+}
+
+static void testFloodCountsOverruns() {
+    captureRun(false, FLOOD_EDGES, 0);
+}
+
+static void testRefusedWhileThreaded() {
+    hostSerialSetOutput(HOST_SERIAL_DISCARD);
+    SensythingOX ox;
+    CHECK(ox.initPlatform());
+    CHECK(ox.enableThreadedAcquisition(true));
+    CHECK(!ox.enableDataReadyMode(true));        // Two tasks would share the SPI bus
+    CHECK(!ox.isDataReadyDriven());
+    CHECK(ox.enableThreadedAcquisition(false));
+    CHECK(ox.enableDataReadyMode(true));
+    CHECK(ox.enableDataReadyMode(false));
+    hostSerialSetOutput(HOST_SERIAL_STDOUT);
+}
+
+int main() {
+    RUN_TEST(testPacedLibraryRead);
+    RUN_TEST(testPacedBurstRead);
+    RUN_TEST(testFloodCountsOverruns);
+    RUN_TEST(testRefusedWhileThreaded);
+    return hostCheckResult();
+}
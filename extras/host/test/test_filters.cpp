@@ -0,0 +1,234 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Host Build - Streaming Filter Tests
+//
+//    Feeds synthetic sines, steps and ramps through SensythingFilterChain and
+//    measures the steady-state gain of each stage against its design: the
+//    band-pass passes its centre and rejects both sides, the notch removes
+//    mains hum and keeps the signal, the moving average is exact and does not
+//    drift, and the DC block removes an offset. The filter bank must hold a
+//    channel's state across a failed read.
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#include <SensythingCore.h>
+#include <dsp/SensythingFilter.h>
+#include "HostCheck.h"
+
+#define SETTLE_SECONDS 20.0f                     // Longer than any stage's time constant here
+#define MEASURE_SECONDS 10.0f
+#define MEASURE_PERIODS 3                        // At least this many periods of slow sines
+
+/**
+ * Steady-state amplitude gain of a chain for a sine
+ * @param offset DC added to the input
+ */
+static float sineGain(SensythingFilterChain& chain, float rateHz, float hz, float offset = 0.0f) {
+    chain.setSampleRate(rateHz);                 // Clears the state
+    uint32_t settle = (uint32_t)(SETTLE_SECONDS * rateHz);
+    float seconds = MEASURE_PERIODS / hz > MEASURE_SECONDS ? MEASURE_PERIODS / hz : MEASURE_SECONDS;
+    uint32_t measure = (uint32_t)(seconds * rateHz);
+    double inputSquares = 0.0;
+    double outputSquares = 0.0;
+    for (uint32_t n = 0; n < settle + measure; n++) {
+        float x = sinf(2.0f * (float)M_PI * hz * n / rateHz);
+        float y = chain.process(offset + x);
+        if (n >= settle) {
+            inputSquares += (double)x * x;
+            outputSquares += (double)y * y;
+        }
+    }
+    return (float)sqrt(outputSquares / inputSquares);
+}
+
+/**
+ * Gain of the analog second-order band-pass the biquad is designed from
+ */
+static float bandPassPrototype(float lowHz, float highHz, float hz) {
+    float center = sqrtf(lowHz * highHz);
+    float q = center / (highHz - lowHz);
+    float detune = q * (hz / center - center / hz);
+    return 1.0f / sqrtf(1.0f + detune * detune);
+}
+
+static void testBandPass() {
+    SensythingFilterChain chain;
+    chain.setSampleRate(100.0f);
+    CHECK(chain.addBandPass(0.5f, 5.0f));
+
+    float center = sqrtf(0.5f * 5.0f);
+    CHECK_NEAR(sineGain(chain, 100.0f, center), 1.0f, 0.02f);
+    CHECK_NEAR(sineGain(chain, 100.0f, 0.5f), 0.707f, 0.03f);    // -3 dB at the corners
+    CHECK_NEAR(sineGain(chain, 100.0f, 5.0f), 0.707f, 0.03f);
+    CHECK_NEAR(sineGain(chain, 100.0f, 0.1f), bandPassPrototype(0.5f, 5.0f, 0.1f), 0.01f);
+    CHECK(sineGain(chain, 100.0f, 40.0f) < bandPassPrototype(0.5f, 5.0f, 40.0f));  // Warped towards Nyquist
+    CHECK(sineGain(chain, 100.0f, center, 500.0f) < 1.02f);      // A DC offset is removed
+}
+
+static void testNotchRemovesHum() {
+    SensythingFilterChain chain;
+    chain.setSampleRate(500.0f);
+    CHECK(chain.addNotch(50.0f));
+
+    CHECK(sineGain(chain, 500.0f, 50.0f) < 0.01f);
+    CHECK_NEAR(sineGain(chain, 500.0f, 5.0f), 1.0f, 0.01f);
+    CHECK_NEAR(sineGain(chain, 500.0f, 100.0f), 1.0f, 0.01f);
+    CHECK_NEAR(sineGain(chain, 500.0f, 50.0f + 25.0f / SENSYTHING_FILTER_NOTCH_Q), 0.707f, 0.03f);  // Band edge
+
+    // A 5 Hz signal under strong hum comes out as the signal
+    chain.setSampleRate(500.0f);
+    float worst = 0.0f;
+    for (uint32_t n = 0; n < 10000; n++) {
+        float signal = sinf(2.0f * (float)M_PI * 5.0f * n / 500.0f);
+        float hum = 3.0f * sinf(2.0f * (float)M_PI * 50.0f * n / 500.0f);
+        float y = chain.process(signal + hum);
+        if (n >= 5000 && fabsf(y - signal) > worst) {
+            worst = fabsf(y - signal);
+        }
+    }
+    CHECK(worst < 0.05f);
+}
+
+static void testMovingAverage() {
+    SensythingFilterChain chain;
+    CHECK(chain.addMovingAverage(4));
+
+    // Averages what it has until the window fills, then the last four
+    const float ramp[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+    const float expected[8] = {1.0f, 1.5f, 2.0f, 2.5f, 3.5f, 4.5f, 5.5f, 6.5f};
+    for (int n = 0; n < 8; n++) {
+        CHECK_NEAR(chain.process(ramp[n]), expected[n], 1e-6f);
+    }
+
+    // A million samples on a large offset: the running sum must not drift
+    SensythingFilterChain longRun;
+    CHECK(longRun.addMovingAverage(SENSYTHING_FILTER_MA_MAX_LENGTH));
+    double window[SENSYTHING_FILTER_MA_MAX_LENGTH] = {0};
+    float worst = 0.0f;
+    uint32_t seed = 1;
+    for (uint32_t n = 0; n < 1000000; n++) {
+        seed = seed * 1664525u + 1013904223u;
+        float x = 1000.0f + (float)(seed >> 8) / (1 << 24);
+        window[n % SENSYTHING_FILTER_MA_MAX_LENGTH] = x;
+        float y = longRun.process(x);
+        if (n >= SENSYTHING_FILTER_MA_MAX_LENGTH) {
+            double sum = 0.0;
+            for (int k = 0; k < SENSYTHING_FILTER_MA_MAX_LENGTH; k++) {
+                sum += window[k];
+            }
+            float error = fabsf(y - (float)(sum / SENSYTHING_FILTER_MA_MAX_LENGTH));
+            worst = error > worst ? error : worst;
+        }
+    }
+    CHECK(worst < 1e-3f);
+
+    CHECK(!chain.addMovingAverage(1));
+    CHECK(!chain.addMovingAverage(SENSYTHING_FILTER_MA_MAX_LENGTH + 1));
+}
+
+static void testDCBlock() {
+    SensythingFilterChain chain;
+    chain.setSampleRate(100.0f);
+    CHECK(chain.addDCBlock(SENSYTHING_FILTER_DC_CUTOFF_HZ));
+
+    // Starts settled: a constant input gives zero from the first sample
+    float worst = 0.0f;
+    for (int n = 0; n < 1000; n++) {
+        float y = fabsf(chain.process(1234.5f));
+        worst = y > worst ? y : worst;
+    }
+    CHECK(worst < 1e-3f);
+
+    CHECK_NEAR(sineGain(chain, 100.0f, 5.0f, 1000.0f), 1.0f, 0.02f);  // One pole: 2 / (1 + R) at Nyquist
+    CHECK_NEAR(sineGain(chain, 100.0f, SENSYTHING_FILTER_DC_CUTOFF_HZ), 0.707f, 0.05f);
+    CHECK(sineGain(chain, 100.0f, 0.01f) < 0.05f);
+}
+
+static void testNyquistBypass() {
+    SensythingFilterChain chain;
+    chain.setSampleRate(100.0f);
+    CHECK(!chain.addBandPass(1.0f, 60.0f));      // Corner above Nyquist
+    CHECK(!chain.addNotch(50.0f));               // At Nyquist
+    CHECK(!chain.addBandPass(5.0f, 1.0f));
+    CHECK_EQ(chain.getStageCount(), 0);
+
+    // A stage pushed over Nyquist by a rate change is kept but passes the input through
+    chain.setSampleRate(500.0f);
+    CHECK(chain.addNotch(50.0f));
+    chain.setSampleRate(80.0f);
+    CHECK_EQ(chain.getStageCount(), 1);
+    CHECK_NEAR(chain.process(0.25f), 0.25f, 0.0f);
+    CHECK(sineGain(chain, 500.0f, 50.0f) < 0.01f);
+
+    for (int i = 1; i < SENSYTHING_FILTER_MAX_STAGES; i++) {
+        CHECK(chain.addMovingAverage(2));
+    }
+    CHECK(!chain.addMovingAverage(2));           // Chain full
+}
+
+static void testBankHoldsFailedChannel() {
+    SensythingFilterBank bank;
+    bank.setSampleRate(100.0f);
+    CHECK(bank.getChain(0).addBandPass(0.5f, 5.0f));
+    CHECK(bank.getChain(1).addDCBlock(0.5f));
+    bank.refresh();
+    CHECK(bank.isActive());
+
+    // The reference chains never see the failed samples
+    SensythingFilterChain reference[2];
+    for (int i = 0; i < 2; i++) {
+        reference[i].setSampleRate(100.0f);
+    }
+    CHECK(reference[0].addBandPass(0.5f, 5.0f));
+    CHECK(reference[1].addDCBlock(0.5f));
+
+    uint32_t mismatched = 0;
+    uint32_t failedTouched = 0;
+    for (uint32_t n = 0; n < 2000; n++) {
+        MeasurementData data;
+        memset(&data, 0, sizeof(data));
+        data.channel_count = 2;
+        data.channels[0] = sinf(2.0f * (float)M_PI * 1.5f * n / 100.0f);
+        data.channels[1] = 500.0f + data.channels[0];
+        if (n % 17 == 5) {
+            data.status_flags = SENSYTHING_STATUS_CH0_FAIL;
+            data.channels[0] = 0.0f;             // Placeholder of a failed read
+        }
+        if (n % 23 == 7) {
+            data.status_flags |= SENSYTHING_STATUS_CH1_FAIL;
+            data.channels[1] = 0.0f;
+        }
+
+        MeasurementData expected = data;
+        for (int i = 0; i < 2; i++) {
+            if (!(data.status_flags & (1 << i))) {
+                expected.channels[i] = reference[i].process(data.channels[i]);
+            }
+        }
+        bank.process(data);
+        for (int i = 0; i < 2; i++) {
+            if (data.status_flags & (1 << i)) {
+                failedTouched += data.channels[i] == 0.0f ? 0 : 1;
+            } else if (data.channels[i] != expected.channels[i]) {
+                mismatched++;
+            }
+        }
+        CHECK_EQ(data.status_flags, expected.status_flags);
+    }
+    CHECK_EQ(failedTouched, 0);
+    CHECK_EQ(mismatched, 0);
+    CHECK(bank.getCyclesPerSample() > 0);
+}
+
+int main() {
+    RUN_TEST(testBandPass);
+    RUN_TEST(testNotchRemovesHum);
+    RUN_TEST(testMovingAverage);
+    RUN_TEST(testDCBlock);
+    RUN_TEST(testNyquistBypass);
+    RUN_TEST(testBankHoldsFailedChannel);
+    return hostCheckResult();
+}
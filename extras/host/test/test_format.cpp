@@ -0,0 +1,168 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Host Build - Text Formatting Tests
+//
+//    Compares SensythingTextWriter::appendFixed with snprintf("%.*f") for
+//    every precision: the special values, exact ties in both rounding
+//    directions, the extremes of the float range, random bit patterns and
+//    random values the size of sensor readings. Also checks the writer's
+//    integer conversions and that text beyond the buffer is dropped whole.
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#include <SensythingCore.h>
+#include <core/SensythingFormat.h>
+#include "HostCheck.h"
+
+#define RANDOM_PATTERNS 200000                   // Per precision
+#define RANDOM_READINGS 200000
+
+static uint64_t randomState = 0x2545F4914F6CDD1DULL;
+
+static uint32_t random32() {
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 7;
+    randomState ^= randomState << 17;
+    return (uint32_t)(randomState >> 32);
+}
+
+static float fromBits(uint32_t bits) {
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+static uint32_t mismatches = 0;
+
+/**
+ * Format with both and count (and show the first few) differences
+ */
+static void compare(float value, uint8_t decimals) {
+    char expected[64];
+    char actual[64];
+    snprintf(expected, sizeof(expected), "%.*f", decimals, (double)value);
+    SensythingTextWriter out(actual, sizeof(actual));
+    out.appendFixed(value, decimals);
+    if (strcmp(expected, actual) != 0) {
+        uint32_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        if (mismatches++ < 10) {
+            printf("  0x%08x at %u decimals: printf \"%s\", appendFixed \"%s\"\n",
+                   bits, decimals, expected, actual);
+        }
+    }
+}
+
+static void testSpecialValues() {
+    const uint32_t patterns[] = {
+        0x00000000, 0x80000000,                  // +0, -0
+        0x7F800000, 0xFF800000,                  // +inf, -inf
+        0x7FC00000, 0xFFC00000, 0x7F800001,      // nan, -nan, signalling nan
+        0x00000001, 0x80000001, 0x007FFFFF,      // Subnormals
+        0x00800000, 0x7F7FFFFF, 0xFF7FFFFF,      // Smallest normal, largest finite
+        0x4F7FFFFF, 0x4F800000, 0x5F800000,      // Around 2^32 and 2^64
+        0x4B7FFFFF, 0x4B800000, 0x4B800001,      // Around 2^24, where floats stop holding fractions
+    };
+    mismatches = 0;
+    for (size_t i = 0; i < sizeof(patterns) / sizeof(patterns[0]); i++) {
+        for (uint8_t decimals = 0; decimals <= 9; decimals++) {
+            compare(fromBits(patterns[i]), decimals);
+        }
+    }
+    CHECK_EQ(mismatches, 0);
+
+    char buffer[64];
+    SensythingTextWriter out(buffer, sizeof(buffer));
+    out.appendFixed(-0.00004f, 4).append(' ').appendFixed(-NAN, 2).append(' ').appendFixed(1.0f, 12);
+    CHECK(strcmp(buffer, "-0.0000 -nan 1.000000000") == 0);       // More than 9 decimals gives 9
+}
+
+static void testTies() {
+    // Exactly representable halves round to even, at every position
+    const float ties[] = {0.5f, 1.5f, 2.5f, -2.5f, 0.125f, 0.375f, 1.0625f, 0.03125f,
+                          8388607.5f, 4194304.25f, 1.00048828125f};
+    mismatches = 0;
+    for (size_t i = 0; i < sizeof(ties) / sizeof(ties[0]); i++) {
+        for (uint8_t decimals = 0; decimals <= 9; decimals++) {
+            compare(ties[i], decimals);
+        }
+    }
+    CHECK_EQ(mismatches, 0);
+
+    char buffer[32];
+    SensythingTextWriter out(buffer, sizeof(buffer));
+    out.appendFixed(0.125f, 2).append(' ').appendFixed(0.375f, 2).append(' ').appendFixed(2.5f, 0);
+    CHECK(strcmp(buffer, "0.12 0.38 2") == 0);
+
+    // Nines carry into the whole part
+    out.reset();
+    out.appendFixed(9.99995f, 4).append(' ').appendFixed(-0.99999f, 3);
+    CHECK(strcmp(buffer, "10.0000 -1.000") == 0);
+}
+
+static void testRandomPatterns() {
+    mismatches = 0;
+    for (uint8_t decimals = 0; decimals <= 9; decimals++) {
+        for (uint32_t i = 0; i < RANDOM_PATTERNS; i++) {
+            compare(fromBits(random32()), decimals);
+        }
+    }
+    printf("  %u patterns x 10 precisions, %u mismatches\n", RANDOM_PATTERNS, mismatches);
+    CHECK_EQ(mismatches, 0);
+}
+
+static void testRandomReadings() {
+    // Values like the boards produce: pF, SpO2, raw counts and small signals
+    const float scales[] = {1e-3f, 1.0f, 100.0f, 2.0e6f};
+    mismatches = 0;
+    for (uint32_t i = 0; i < RANDOM_READINGS; i++) {
+        float scale = scales[i % 4];
+        float value = scale * ((float)random32() / 4294967296.0f * 2.0f - 1.0f);
+        compare(value, SENSYTHING_CSV_PRECISION);
+        compare(value, 2);
+        compare(value, 6);
+    }
+    printf("  %u readings at 2, %u and 6 decimals, %u mismatches\n", RANDOM_READINGS,
+           SENSYTHING_CSV_PRECISION, mismatches);
+    CHECK_EQ(mismatches, 0);
+}
+
+static void testIntegersAndOverflow() {
+    char buffer[16];
+    SensythingTextWriter out(buffer, sizeof(buffer));
+    out.appendUInt(0).append(',').appendUInt(4294967295UL);
+    CHECK(strcmp(buffer, "0,4294967295") == 0);
+    out.reset();
+    out.appendUInt64(18446744073709551615ULL);
+    CHECK(strcmp(buffer, "") == 0);              // 20 digits do not fit in 15: none are written
+    CHECK(out.overflowed());
+    out.reset();
+    out.appendHex(0).append(',').appendHex(0xDEADBEEF);
+    CHECK(strcmp(buffer, "0,deadbeef") == 0);
+    CHECK(!out.overflowed());
+
+    // The widest float a CSV line may hold
+    char line[SENSYTHING_CSV_LINE_SIZE];
+    SensythingTextWriter csv(line, sizeof(line));
+    csv.appendUInt(4294967295UL).append(',').appendUInt(4294967295UL);
+    for (int i = 0; i < SENSYTHING_MAX_CHANNELS; i++) {
+        csv.append(',').appendFixed(-3.4028235e38f, SENSYTHING_CSV_PRECISION);
+    }
+    for (int i = 0; i < SENSYTHING_MAX_CHANNELS; i++) {
+        csv.append(',').appendUInt(255);
+    }
+    csv.append(',').appendHex(0xFF).append("\r\n");
+    CHECK(!csv.overflowed());
+}
+
+int main() {
+    RUN_TEST(testSpecialValues);
+    RUN_TEST(testTies);
+    RUN_TEST(testRandomPatterns);
+    RUN_TEST(testRandomReadings);
+    RUN_TEST(testIntegersAndOverflow);
+    return hostCheckResult();
+}
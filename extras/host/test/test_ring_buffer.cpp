@@ -0,0 +1,179 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Host Build - Sample Ring Buffer Tests
+//
+//    Single-threaded contract checks, then a producer and a consumer thread
+//    moving millions of records through the ring: every record must arrive
+//    once, in order and untorn.
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#include <SensythingCore.h>
+#include <atomic>
+#include <thread>
+#include "HostCheck.h"
+
+#define STRESS_SMALL_RECORDS 4000000             // uint32_t records through an 8-slot ring
+#define STRESS_SAMPLE_RECORDS 1000000            // MeasurementData records through the sample ring
+
+static void testFifoOrder() {
+    SensythingRingBuffer<uint32_t, 4> ring;
+    uint32_t value = 0;
+
+    CHECK(ring.isEmpty());
+    CHECK(!ring.pop(value));
+    for (uint32_t i = 0; i < 4; i++) {
+        CHECK(ring.push(i));
+    }
+    CHECK(ring.isFull());
+    CHECK(!ring.push(99));                       // Full: rejected, not overwritten
+    CHECK_EQ(ring.size(), 4);
+
+    for (uint32_t i = 0; i < 4; i++) {
+        CHECK(ring.pop(value));
+        CHECK_EQ(value, i);
+    }
+    CHECK(!ring.pop(value));
+}
+
+static void testWrapAround() {
+    // Many passes over the slots with the fill level changing each time
+    SensythingRingBuffer<uint32_t, 8> ring;
+    uint32_t next = 0;
+    uint32_t expected = 0;
+    for (uint32_t round = 0; round < 10000; round++) {
+        uint32_t pushes = round % 9;
+        for (uint32_t i = 0; i < pushes && ring.push(next); i++) {
+            next++;
+        }
+        uint32_t pops = (round * 7) % 9;
+        uint32_t value;
+        for (uint32_t i = 0; i < pops && ring.pop(value); i++) {
+            CHECK_EQ(value, expected);
+            expected++;
+        }
+        CHECK(ring.size() <= ring.capacity());
+    }
+}
+
+static void testClear() {
+    SensythingRingBuffer<uint32_t, 4> ring;
+    ring.push(1);
+    ring.push(2);
+    ring.clear();
+    CHECK(ring.isEmpty());
+    uint32_t value = 0;
+    CHECK(ring.push(3));
+    CHECK(ring.pop(value));
+    CHECK_EQ(value, 3);
+}
+
+static void testTwoThreadsSmallRecords() {
+    static SensythingRingBuffer<uint32_t, 8> ring;
+    std::atomic<uint32_t> sizeViolations(0);
+
+    std::thread producer([&sizeViolations]() {
+        for (uint32_t i = 0; i < STRESS_SMALL_RECORDS; i++) {
+            while (!ring.push(i)) {
+                std::this_thread::yield();
+            }
+            if (ring.size() > ring.capacity()) {
+                sizeViolations++;
+            }
+        }
+    });
+
+    uint32_t expected = 0;
+    uint32_t outOfOrder = 0;
+    while (expected < STRESS_SMALL_RECORDS) {
+        uint32_t value;
+        if (!ring.pop(value)) {
+            std::this_thread::yield();
+            continue;
+        }
+        if (value != expected) {
+            outOfOrder++;
+        }
+        expected = value + 1;
+    }
+    producer.join();
+
+    CHECK_EQ(outOfOrder, 0);
+    CHECK_EQ(sizeViolations.load(), 0);
+    CHECK(ring.isEmpty());
+}
+
+// Every field derived from the sequence number, so a torn copy is detectable
+static void fillRecord(MeasurementData& data, uint32_t sequence) {
+    data.timestamp = sequence;
+    data.measurement_count = sequence ^ 0xA5A5A5A5;
+    data.channel_count = SENSYTHING_MAX_CHANNELS;
+    data.status_flags = (uint8_t)sequence;
+    for (uint8_t i = 0; i < SENSYTHING_MAX_CHANNELS; i++) {
+        data.channels[i] = (float)(sequence % 100000) + i;
+        data.channel_time_us[i] = sequence + i;
+    }
+    for (uint8_t i = 0; i < SENSYTHING_MAX_METADATA; i++) {
+        data.metadata[i] = (uint8_t)(sequence + i);
+    }
+}
+
+static bool recordIntact(const MeasurementData& data) {
+    MeasurementData expected;
+    memset(&expected, 0, sizeof(expected));
+    fillRecord(expected, data.timestamp);
+    return data.measurement_count == expected.measurement_count &&
+           data.status_flags == expected.status_flags &&
+           memcmp(data.channels, expected.channels, sizeof(data.channels)) == 0 &&
+           memcmp(data.channel_time_us, expected.channel_time_us, sizeof(data.channel_time_us)) == 0 &&
+           memcmp(data.metadata, expected.metadata, sizeof(data.metadata)) == 0;
+}
+
+static void testTwoThreadsSampleRecords() {
+    static SensythingRingBuffer<MeasurementData, SENSYTHING_SAMPLE_RING_SIZE> ring;
+
+    std::thread producer([]() {
+        MeasurementData data;
+        memset(&data, 0, sizeof(data));
+        for (uint32_t i = 0; i < STRESS_SAMPLE_RECORDS; i++) {
+            fillRecord(data, i);
+            while (!ring.push(data)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    uint32_t expected = 0;
+    uint32_t outOfOrder = 0;
+    uint32_t torn = 0;
+    MeasurementData data;
+    while (expected < STRESS_SAMPLE_RECORDS) {
+        if (!ring.pop(data)) {
+            std::this_thread::yield();
+            continue;
+        }
+        if (data.timestamp != expected) {
+            outOfOrder++;
+        }
+        if (!recordIntact(data)) {
+            torn++;
+        }
+        expected = data.timestamp + 1;
+    }
+    producer.join();
+
+    CHECK_EQ(outOfOrder, 0);
+    CHECK_EQ(torn, 0);
+}
+
+int main() {
+    RUN_TEST(testFifoOrder);
+    RUN_TEST(testWrapAround);
+    RUN_TEST(testClear);
+    RUN_TEST(testTwoThreadsSmallRecords);
+    RUN_TEST(testTwoThreadsSampleRecords);
+    return hostCheckResult();
+}
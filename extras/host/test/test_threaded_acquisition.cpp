@@ -0,0 +1,149 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Host Build - Threaded Acquisition Tests
+//
+//    Runs SensythingSim with the acquisition task on a host thread, woken by
+//    the esp_timer stand-in, while the main thread calls update() as loop()
+//    would. The USB sink's CSV is captured and every measurement number must
+//    reach it once and in order. The stop path is cycled hundreds of times;
+//    the FreeRTOS stand-in aborts if a timer callback notifies the task after
+//    it was deleted.
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#include <SensythingCore.h>
+#include <sstream>
+#include "HostCheck.h"
+
+#define STEADY_RUN_MS 1000                       // Threaded run at 1 kHz
+#define STOP_START_CYCLES 300
+
+static void runUpdates(SensythingSim& sim, uint32_t ms) {
+    uint32_t start = millis();
+    while (millis() - start < ms) {
+        sim.update();
+    }
+}
+
+// Stop acquiring and hand every queued sample to the sinks
+static void stopAndDrain(SensythingSim& sim) {
+    sim.stopMeasurements();
+    for (int i = 0; i < 10; i++) {
+        sim.update();
+    }
+}
+
+/**
+ * Measurement numbers from the captured CSV (the last field of each data line)
+ */
+static std::vector<uint32_t> capturedCounts() {
+    std::vector<uint32_t> counts;
+    std::istringstream lines(hostSerialTakeOutput());
+    std::string line;
+    while (std::getline(lines, line)) {
+        size_t comma = line.rfind(',');
+        if (line.find(",0x") == std::string::npos || comma == std::string::npos) {
+            continue;
+        }
+        counts.push_back((uint32_t)strtoul(line.c_str() + comma + 1, nullptr, 10));
+    }
+    return counts;
+}
+
+static void checkConsecutive(const std::vector<uint32_t>& counts, uint32_t expectedTotal) {
+    uint32_t gaps = 0;
+    for (size_t i = 0; i < counts.size(); i++) {
+        if (counts[i] != i + 1) {
+            gaps++;
+        }
+    }
+    CHECK_EQ(gaps, 0);
+    CHECK_EQ(counts.size(), expectedTotal);
+}
+
+static void testSteadyRate() {
+    hostSerialSetOutput(HOST_SERIAL_DISCARD);
+    SensythingSim sim(SENSYTHING_SIM_CAP);
+    CHECK(sim.initPlatform());
+    CHECK(sim.setSampleRate(1));
+    hostSerialTakeOutput();
+    hostSerialSetOutput(HOST_SERIAL_CAPTURE);
+
+    uint32_t tasksBefore = hostLiveTaskCount();
+    CHECK(sim.enableThreadedAcquisition(true));
+    CHECK_EQ(hostLiveTaskCount(), tasksBefore + 1);
+    runUpdates(sim, STEADY_RUN_MS);
+    CHECK(sim.enableThreadedAcquisition(false));
+    CHECK_EQ(hostLiveTaskCount(), tasksBefore);
+    AcquisitionStats stats = sim.getAcquisitionStats();
+    stopAndDrain(sim);
+
+    std::vector<uint32_t> counts = capturedCounts();
+    SensythingMetrics metrics;
+    sim.getMetrics(metrics);
+    hostSerialSetOutput(HOST_SERIAL_STDOUT);
+
+    // The timer keeps an absolute schedule, so ticks are neither lost nor gained
+    uint32_t periods = stats.timerTicks + stats.timerOverruns;
+    CHECK(stats.samplesAcquired >= STEADY_RUN_MS * 9 / 10);
+    CHECK(stats.samplesAcquired <= STEADY_RUN_MS * 11 / 10);
+    CHECK(periods + 1 >= stats.samplesAcquired);
+    CHECK_EQ(metrics.samplesDropped, 0);
+    checkConsecutive(counts, sim.getMeasurementCount());
+
+    printf("  %u samples in %u ms, jitter mean %.1f us, max %u us, %u overruns\n",
+           stats.samplesAcquired, STEADY_RUN_MS,
+           stats.timerTicks ? (double)stats.totalJitterUs / stats.timerTicks : 0.0,
+           stats.maxJitterUs, stats.timerOverruns);
+}
+
+static void testStopStartCycles() {
+    hostSerialSetOutput(HOST_SERIAL_DISCARD);
+    SensythingSim sim(SENSYTHING_SIM_CAP);
+    CHECK(sim.initPlatform());
+    CHECK(sim.setSampleRate(1));
+    hostSerialTakeOutput();
+    hostSerialSetOutput(HOST_SERIAL_CAPTURE);
+
+    uint32_t tasksBefore = hostLiveTaskCount();
+    uint32_t lateSamples = 0;
+    for (uint32_t cycle = 0; cycle < STOP_START_CYCLES; cycle++) {
+        CHECK(sim.enableThreadedAcquisition(true));
+        runUpdates(sim, cycle % 4);
+
+        // Stopping must leave no task and no tick behind to read the sensor
+        CHECK(sim.enableThreadedAcquisition(false));
+        uint32_t acquired = sim.getAcquisitionStats().samplesAcquired;
+        delayMicroseconds(1500);
+        if (sim.getAcquisitionStats().samplesAcquired != acquired) {
+            lateSamples++;
+        }
+        CHECK_EQ(hostLiveTaskCount(), tasksBefore);
+
+        // Polled acquisition takes over between threaded runs
+        runUpdates(sim, 1);
+        if (hostCheckFailures) {
+            break;
+        }
+    }
+    stopAndDrain(sim);
+
+    std::vector<uint32_t> counts = capturedCounts();
+    SensythingMetrics metrics;
+    sim.getMetrics(metrics);
+    hostSerialSetOutput(HOST_SERIAL_STDOUT);
+
+    CHECK_EQ(lateSamples, 0);
+    CHECK_EQ(metrics.samplesDropped, 0);
+    checkConsecutive(counts, sim.getMeasurementCount());
+    printf("  %u stop/start cycles, %u samples streamed in order\n", STOP_START_CYCLES, (unsigned)counts.size());
+}
+
+int main() {
+    RUN_TEST(testSteadyRate);
+    RUN_TEST(testStopStartCycles);
+    return hostCheckResult();
+}
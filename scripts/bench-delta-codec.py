@@ -0,0 +1,279 @@
+#!/usr/bin/env python3
+
+################################################################################
+#
+#  SensythingCore - Delta Codec Benchmark
+#
+#  Runs the firmware's delta encoder (src/core/SensythingDeltaCodec.h) over a
+#  recording and reports how well it compresses. The encoding is done by the
+#  host build's bench_delta_codec program, which compiles the library's own
+#  SensythingDeltaEncoder; its records are decoded again with the reference
+#  decoder from decode-usb-stream.py and checked to round-trip exactly. Sizes
+#  are compared with the uncompressed binary record (10 + 5 bytes per
+#  channel) and with the USB binary frame that carries it.
+#
+#  Recordings are binary SD logs (sd_format binary) or CSV files written by
+#  convert-sd-log.py or decode-usb-stream.py; CSV files are converted to a
+#  binary log first. Without a recording the Sim board's OX profile is used.
+#  For OX boards record the raw IR/RED counts; filtered or oversampled values
+#  are not whole numbers and are sent as floats.
+#
+#  The encode time is the host's and only useful for comparing recordings;
+#  the firmware's cost per record is the delta_encode stage of the on-device
+#  benchmark (run-benchmark.py).
+#
+#  Prerequisites:
+#    - Python 3.7+
+#    - The host build (see README, "Host build"):
+#        cmake -S extras/host -B build/host && cmake --build build/host
+#
+#  Usage:
+#    python3 bench-delta-codec.py sensything_1.bin
+#    python3 bench-delta-codec.py capture.csv --keyframe 16,64,256
+#    python3 bench-delta-codec.py --sim 60000
+#
+#  Options:
+#    --encoder PATH     bench_delta_codec program (default: build/host/bench_delta_codec)
+#    --sim N            Samples of the Sim OX profile when no recording is given
+#                       (default: 60000)
+#    --keyframe LIST    Keyframe intervals to compare (default: 64)
+#    --json             Print the results as one line of JSON
+#
+#  Exit Codes:
+#    0 - Recording encoded and decoded losslessly
+#    1 - Round trip mismatch, or the encoder allocated or did not compress
+#    2 - Prerequisites not met, invalid arguments or unreadable recording
+#
+################################################################################
+
+import os
+import sys
+import json
+import math
+import struct
+import argparse
+import tempfile
+import subprocess
+import importlib.util
+from typing import Dict, List, NamedTuple
+
+# Python 3.7+ compatibility
+if sys.version_info < (3, 7):
+    print("Error: Python 3.7 or higher required")
+    sys.exit(2)
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+DEFAULT_ENCODER = os.path.join(SCRIPT_DIR, "..", "build", "host", "bench_delta_codec")
+USB_FRAME_OVERHEAD = 6   # sync(2) + type(1) + length(1) + CRC(2)
+DEFAULT_KEYFRAME_INTERVAL = 64
+DEFAULT_SIM_SAMPLES = 60000
+LOG_VERSION = 1
+BOARD_TYPE_OX = 2
+
+
+def load_script(name: str):
+    """Import a sibling script (their file names are not module names)"""
+    path = os.path.join(SCRIPT_DIR, name)
+    spec = importlib.util.spec_from_file_location(name.replace("-", "_")[:-3], path)
+    module = importlib.util.module_from_spec(spec)
+    spec.loader.exec_module(module)
+    return module
+
+
+usb_stream = load_script("decode-usb-stream.py")
+sd_log = load_script("convert-sd-log.py")
+
+
+class Sample(NamedTuple):
+    sequence: int
+    timestamp: int
+    flags: int
+    channels: List[float]
+    metadata: List[int]
+
+
+# =============================================================================
+# RECORDINGS
+# =============================================================================
+
+def to_float32(value: float) -> float:
+    return struct.unpack("<f", struct.pack("<f", value))[0]
+
+
+def read_binary_log(path: str) -> List[Sample]:
+    with open(path, "rb") as f:
+        data = f.read()
+    header = sd_log.parse_header(data)
+    return [Sample(r.count, r.timestamp, r.flags, list(r.values), list(r.metadata))
+            for r in sd_log.LogDecoder(header).decode(data)]
+
+
+def read_csv(path: str) -> List[Sample]:
+    with open(path) as f:
+        columns = f.readline().strip().split(",")
+        rows = [line.strip().split(",") for line in f if line.strip()]
+
+    index = {name: i for i, name in enumerate(columns)}
+    for required in ("count", "timestamp", "status_flags"):
+        if required not in index:
+            raise ValueError("missing '%s' column" % required)
+
+    skip = {"count", "timestamp", "status_flags", "verified"}
+    metadata = [i for i, name in enumerate(columns) if name.startswith("meta") or name.endswith("_capdac")]
+    channels = [i for i, name in enumerate(columns) if name not in skip and i not in metadata]
+
+    samples = []
+    for row in rows:
+        samples.append(Sample(
+            int(row[index["count"]]),
+            int(row[index["timestamp"]]),
+            int(row[index["status_flags"]], 16),
+            [to_float32(float(row[i])) for i in channels],
+            [int(row[i]) for i in metadata] or [0] * len(channels)))
+    return samples
+
+
+def write_binary_log(path: str, samples: List[Sample]) -> None:
+    """Write samples as one block with no trailer (SensythingLogFormat.h)"""
+    n = len(samples[0].channels)
+    header = bytearray(sd_log.MAGIC)
+    header += struct.pack("<BBBBHH", LOG_VERSION, BOARD_TYPE_OX, n, 10 + 5 * n, 44 + 48 * n + 2, 0)
+    header += b"CSV recording".ljust(32, b"\0")
+    for i in range(n):
+        header += ("CH%d" % i).encode().ljust(32, b"\0") + bytes(16)
+    header += struct.pack("<H", sd_log.crc16_ccitt(bytes(header)))
+
+    record = struct.Struct("<II%df%dBB" % (n, n))
+    with open(path, "wb") as f:
+        f.write(header)
+        for s in samples:
+            f.write(record.pack(s.timestamp, s.sequence, *s.channels, *s.metadata, s.flags))
+
+
+# =============================================================================
+# BENCHMARK
+# =============================================================================
+
+def same_value(a: float, b: float) -> bool:
+    return a == b or (math.isnan(a) and math.isnan(b))
+
+
+def read_records(path: str) -> List[bytes]:
+    """Split bench_delta_codec --output into records (each after its length byte)"""
+    with open(path, "rb") as f:
+        data = f.read()
+    records, pos = [], 0
+    while pos < len(data):
+        records.append(data[pos + 1:pos + 1 + data[pos]])
+        pos += 1 + data[pos]
+    return records
+
+
+def lossless(samples: List[Sample], records: List[bytes]) -> bool:
+    if len(records) != len(samples):
+        return False
+    decoder = usb_stream.DeltaState()
+    for sample, record in zip(samples, records):
+        frame = decoder.decode(record)
+        if (frame is None or frame.sequence != sample.sequence or frame.timestamp != sample.timestamp or
+                frame.flags != sample.flags or frame.metadata != list(sample.metadata) or
+                not all(same_value(a, b) for a, b in zip(frame.channels, sample.channels))):
+            return False
+    return True
+
+
+def run(encoder: str, source: List[str], samples: List[Sample], keyframe_interval: int,
+        workdir: str) -> Dict:
+    output = os.path.join(workdir, "records_%d.bin" % keyframe_interval)
+    result = subprocess.run([encoder] + source + ["--keyframe", str(keyframe_interval),
+                                                  "--output", output, "--json"],
+                            stdout=subprocess.PIPE, universal_newlines=True)
+    if result.returncode == 2 or not result.stdout:
+        raise OSError("%s failed (exit %d)" % (encoder, result.returncode))
+    r = json.loads(result.stdout)["results"][0]
+
+    n = len(samples[0].channels)
+    usb_raw = r["raw_bytes"] + len(samples) * USB_FRAME_OVERHEAD
+    usb_delta = r["encoded_bytes"] + len(samples) * USB_FRAME_OVERHEAD
+    r.update({
+        "samples": len(samples),
+        "channels": n,
+        "usb_frame_ratio": usb_raw / usb_delta,
+        "lossless": lossless(samples, read_records(output)),
+        "encoder_ok": result.returncode == 0,
+    })
+    return r
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Measure the firmware delta codec's compression on a recording"
+    )
+    parser.add_argument("input", nargs="?", help="Binary SD log (.bin) or CSV recording")
+    parser.add_argument("--encoder", default=DEFAULT_ENCODER,
+                        help="bench_delta_codec program from the host build")
+    parser.add_argument("--sim", type=int, default=DEFAULT_SIM_SAMPLES,
+                        help="Sim OX samples when no recording is given (default: %d)" % DEFAULT_SIM_SAMPLES)
+    parser.add_argument("--keyframe", default=str(DEFAULT_KEYFRAME_INTERVAL),
+                        help="Comma-separated keyframe intervals (default: %d)" % DEFAULT_KEYFRAME_INTERVAL)
+    parser.add_argument("--json", action="store_true", help="Print the results as one line of JSON")
+
+    args = parser.parse_args()
+
+    try:
+        intervals = [int(k) for k in args.keyframe.split(",")]
+    except ValueError:
+        print("Error: --keyframe takes a comma-separated list of integers", file=sys.stderr)
+        sys.exit(2)
+    if not os.access(args.encoder, os.X_OK):
+        print("Error: %s not found; build extras/host first or pass --encoder" % args.encoder,
+              file=sys.stderr)
+        sys.exit(2)
+
+    with tempfile.TemporaryDirectory() as workdir:
+        recording = os.path.join(workdir, "recording.bin")
+        try:
+            if args.input is None:
+                # Generate the Sim recording once; every interval then encodes the same samples
+                subprocess.run([args.encoder, "--samples", str(args.sim), "--recording", recording],
+                               stdout=subprocess.DEVNULL)
+            elif args.input.endswith(".bin"):
+                recording = args.input
+            else:
+                write_binary_log(recording, read_csv(args.input))
+            samples = read_binary_log(recording)
+        except (OSError, ValueError, IndexError) as e:
+            print("Error: cannot read %s (%s)" % (args.input or recording, e), file=sys.stderr)
+            sys.exit(2)
+        if not samples:
+            print("Error: %s holds no samples" % (args.input or recording), file=sys.stderr)
+            sys.exit(2)
+
+        try:
+            results = [run(args.encoder, ["--input", recording], samples, k, workdir) for k in intervals]
+        except (OSError, ValueError, KeyError) as e:
+            print("Error: %s" % e, file=sys.stderr)
+            sys.exit(2)
+
+    name = args.input or "Sim OX profile"
+    if args.json:
+        print(json.dumps({"input": os.path.basename(name), "results": results}))
+    else:
+        whole = sum(usb_stream.is_whole(v) for s in samples for v in s.channels)
+        print("%s: %d samples, %d channels, %.0f%% of values delta coded"
+              % (name, len(samples), results[0]["channels"],
+                 100.0 * whole / (len(samples) * results[0]["channels"])))
+        print("%-9s %10s %10s %9s %7s %9s %10s %7s %9s"
+              % ("keyframe", "raw", "encoded", "B/sample", "ratio", "usb ratio", "ns/sample", "allocs",
+                 "lossless"))
+        for r in results:
+            print("%-9d %10d %10d %9.2f %6.2f:1 %7.2f:1 %10.1f %7d %9s"
+                  % (r["keyframe_interval"], r["raw_bytes"], r["encoded_bytes"], r["bytes_per_sample"],
+                     r["ratio"], r["usb_frame_ratio"], r["encode_ns_per_sample"], r["allocations"],
+                     "yes" if r["lossless"] else "NO"))
+
+    sys.exit(0 if all(r["lossless"] and r["encoder_ok"] for r in results) else 1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,148 @@
+#!/usr/bin/env python3
+
+################################################################################
+#
+#  SensythingCore - Dashboard Asset Builder
+#
+#  Minifies src/assets/dashboard.html, gzips it and writes the result as a
+#  PROGMEM byte array (src/assets/SensythingDashboard.h) that SensythingWiFi
+#  serves from flash with Content-Encoding: gzip. The ETag is derived from
+#  the compressed bytes, so browsers revalidate with a 304 until the
+#  dashboard actually changes.
+#
+#  Run this after every edit to dashboard.html and commit both files.
+#
+#  Prerequisites:
+#    - Python 3.7+
+#
+#  Usage:
+#    python3 build-dashboard.py [--input FILE] [--output FILE] [--check]
+#
+#  Options:
+#    --input FILE       Dashboard source (default: src/assets/dashboard.html)
+#    --output FILE      Generated header (default: src/assets/SensythingDashboard.h)
+#    --check            Only verify that the generated header is up to date
+#
+#  Exit Codes:
+#    0 - Header written (or up to date with --check)
+#    1 - Header out of date (--check)
+#    2 - Prerequisites not met or invalid arguments
+#
+################################################################################
+
+import os
+import re
+import sys
+import gzip
+import hashlib
+import argparse
+
+# Python 3.7+ compatibility
+if sys.version_info < (3, 7):
+    print("Error: Python 3.7 or higher required")
+    sys.exit(2)
+
+REPO_ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+DEFAULT_INPUT = os.path.join(REPO_ROOT, "src", "assets", "dashboard.html")
+DEFAULT_OUTPUT = os.path.join(REPO_ROOT, "src", "assets", "SensythingDashboard.h")
+
+
+def minify(html: str) -> str:
+    """Conservative minification: line structure is kept so JavaScript's
+    automatic semicolon insertion behaves exactly as in the source"""
+    html = re.sub(r"<!--.*?-->", "", html, flags=re.S)
+    lines = []
+    for line in html.splitlines():
+        line = line.strip()
+        if not line or line.startswith("//"):
+            continue
+        lines.append(line)
+    return "\n".join(lines) + "\n"
+
+
+def compress(data: bytes) -> bytes:
+    # Fixed mtime keeps the output (and the ETag) reproducible
+    return gzip.compress(data, compresslevel=9, mtime=0)
+
+
+def render_header(source: str, raw_size: int, min_size: int, gz: bytes) -> str:
+    etag = hashlib.sha256(gz).hexdigest()[:16]
+    rows = []
+    for i in range(0, len(gz), 16):
+        rows.append("    " + ", ".join("0x%02x" % b for b in gz[i:i + 16]) + ",")
+
+    return "\n".join([
+        "//////////////////////////////////////////////////////////////////////////////////////////",
+        "//    (c) 2025 Protocentral Electronics",
+        "//",
+        "//    Sensything Platform - Web Dashboard (gzip)",
+        "//    GENERATED by scripts/build-dashboard.py from %s - do not edit" % source,
+        "//",
+        "//    Source: %d bytes, minified: %d bytes, gzip: %d bytes" % (raw_size, min_size, len(gz)),
+        "//",
+        "//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).",
+        "//",
+        "//////////////////////////////////////////////////////////////////////////////////////////",
+        "",
+        "#ifndef SENSYTHING_DASHBOARD_H",
+        "#define SENSYTHING_DASHBOARD_H",
+        "",
+        "#include <Arduino.h>",
+        "",
+        "#define SENSYTHING_DASHBOARD_ETAG \"\\\"%s\\\"\"" % etag,
+        "#define SENSYTHING_DASHBOARD_SIZE %d" % len(gz),
+        "",
+        "const uint8_t SENSYTHING_DASHBOARD_GZ[SENSYTHING_DASHBOARD_SIZE] PROGMEM = {",
+    ] + rows + [
+        "};",
+        "",
+        "#endif // SENSYTHING_DASHBOARD_H",
+        "",
+    ])
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Build the gzip-compressed SensythingCore web dashboard header"
+    )
+    parser.add_argument("--input", default=DEFAULT_INPUT, help="Dashboard source HTML")
+    parser.add_argument("--output", default=DEFAULT_OUTPUT, help="Generated header")
+    parser.add_argument("--check", action="store_true", help="Only verify the header is up to date")
+
+    args = parser.parse_args()
+
+    if not os.path.isfile(args.input):
+        print("Error: %s not found" % args.input, file=sys.stderr)
+        sys.exit(2)
+
+    with open(args.input, "r", encoding="utf-8") as f:
+        html = f.read()
+
+    raw = html.encode("utf-8")
+    minified = minify(html).encode("utf-8")
+    gz = compress(minified)
+    source = os.path.relpath(args.input, REPO_ROOT).replace(os.sep, "/")
+    header = render_header(source, len(raw), len(minified), gz)
+
+    if args.check:
+        current = ""
+        if os.path.isfile(args.output):
+            with open(args.output, "r", encoding="utf-8") as f:
+                current = f.read()
+        if current != header:
+            print("Error: %s is out of date, run scripts/build-dashboard.py" % args.output, file=sys.stderr)
+            sys.exit(1)
+        print("%s is up to date" % args.output)
+        sys.exit(0)
+
+    with open(args.output, "w", encoding="utf-8", newline="\n") as f:
+        f.write(header)
+
+    print("Dashboard: %d bytes source, %d minified, %d gzip (%.1f%%)"
+          % (len(raw), len(minified), len(gz), 100.0 * len(gz) / len(raw)))
+    print("Wrote %s" % args.output)
+    sys.exit(0)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,266 @@
+#!/usr/bin/env python3
+
+################################################################################
+#
+#  SensythingCore - Binary SD Log Converter
+#
+#  Converts binary log files written with 'sd_format binary' (see
+#  src/core/SensythingLogFormat.h) to CSV, or to Parquet when pyarrow is
+#  installed. Sync blocks are verified with CRC-16/CCITT-FALSE; a truncated
+#  or damaged file is recovered by scanning for the next valid sync marker.
+#
+#  Prerequisites:
+#    - Python 3.7+
+#    - pyarrow (only for --format parquet): pip install pyarrow
+#
+#  Usage:
+#    python3 convert-sd-log.py sensything_1.bin [--output sensything_1.csv]
+#    python3 convert-sd-log.py sensything_1.bin --format parquet
+#
+#  Options:
+#    --output FILE      Output file (default: input name with .csv/.parquet)
+#    --format FORMAT    csv (default) or parquet
+#    --verified-only    Drop records not covered by a valid sync trailer
+#
+#  Exit Codes:
+#    0 - Log converted (recovered damage is reported, not fatal)
+#    1 - Not a valid Sensything binary log
+#    2 - Prerequisites not met or invalid arguments
+#
+################################################################################
+
+import os
+import sys
+import struct
+import argparse
+from typing import Iterator, List, NamedTuple, Tuple
+
+# Python 3.7+ compatibility
+if sys.version_info < (3, 7):
+    print("Error: Python 3.7 or higher required")
+    sys.exit(2)
+
+MAGIC = b"STLG"
+SYNC_MARKER = b"SYNC"
+SYNC_SIZE = 8
+BOARD_TYPE_CAP = 1
+
+
+def crc16_ccitt(data: bytes, crc: int = 0xFFFF) -> int:
+    """CRC-16/CCITT-FALSE, matching sensythingCRC16() on the device"""
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if (crc & 0x8000) else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+class LogHeader(NamedTuple):
+    version: int
+    board_type: int
+    board_name: str
+    channels: int
+    record_size: int
+    header_size: int
+    sync_records: int
+    labels: List[str]
+    units: List[str]
+
+
+class Record(NamedTuple):
+    timestamp: int
+    count: int
+    values: Tuple[float, ...]
+    metadata: Tuple[int, ...]
+    flags: int
+    verified: bool
+
+
+def field(raw: bytes) -> str:
+    return raw.split(b"\0", 1)[0].decode("utf-8", errors="replace")
+
+
+def parse_header(data: bytes) -> LogHeader:
+    if len(data) < 14 or data[:4] != MAGIC:
+        raise ValueError("missing STLG magic")
+
+    version, board_type, channels, record_size, header_size, sync_records = \
+        struct.unpack_from("<BBBBHH", data, 4)
+    if len(data) < header_size:
+        raise ValueError("file shorter than its header")
+    (crc,) = struct.unpack_from("<H", data, header_size - 2)
+    if crc16_ccitt(data[:header_size - 2]) != crc:
+        raise ValueError("header CRC mismatch")
+
+    labels, units = [], []
+    offset = 44
+    for _ in range(channels):
+        labels.append(field(data[offset:offset + 32]))
+        units.append(field(data[offset + 32:offset + 48]))
+        offset += 48
+
+    return LogHeader(version, board_type, field(data[12:44]), channels, record_size,
+                     header_size, sync_records, labels, units)
+
+
+class LogDecoder:
+    """Walks sync blocks, recovering from truncation and corruption"""
+
+    def __init__(self, header: LogHeader):
+        self.header = header
+        self.record = struct.Struct("<II%df%dBB" % (header.channels, header.channels))
+        self.verified = 0
+        self.unverified = 0
+        self.corrupt_blocks = 0
+        self.skipped_bytes = 0
+
+    def _records(self, data: bytes, start: int, end: int, verified: bool) -> Iterator[Record]:
+        n = self.header.channels
+        for offset in range(start, end, self.header.record_size):
+            fields = self.record.unpack_from(data, offset)
+            if verified:
+                self.verified += 1
+            else:
+                self.unverified += 1
+            yield Record(fields[0], fields[1], fields[2:2 + n], fields[2 + n:2 + 2 * n],
+                         fields[-1], verified)
+
+    def _loose(self, data: bytes, start: int, end: int) -> Iterator[Record]:
+        """Bytes not covered by a trailer: whole records if they fit, else skipped"""
+        size = self.header.record_size
+        length = end - start
+        if length % size == 0 or end == len(data):
+            whole = length - length % size
+            self.skipped_bytes += length - whole
+            yield from self._records(data, start, start + whole, False)
+        else:
+            self.skipped_bytes += length
+
+    def decode(self, data: bytes) -> Iterator[Record]:
+        size = self.header.record_size
+        pos = self.header.header_size
+        search = pos
+
+        while True:
+            marker = data.find(SYNC_MARKER, search)
+            if marker < 0 or marker + SYNC_SIZE > len(data):
+                # Truncated tail after the last trailer
+                yield from self._loose(data, pos, len(data))
+                return
+
+            count, crc = struct.unpack_from("<HH", data, marker + 4)
+            block = marker - count * size
+            if block < pos:
+                search = marker + 1  # Marker bytes inside record data
+                continue
+
+            if crc16_ccitt(data[block:marker]) == crc:
+                yield from self._loose(data, pos, block)
+                yield from self._records(data, block, marker, True)
+            elif block == pos:
+                # Framing is intact but the records are damaged
+                self.corrupt_blocks += 1
+                self.skipped_bytes += marker - block
+            else:
+                search = marker + 1
+                continue
+
+            pos = marker + SYNC_SIZE
+            search = pos
+
+
+def column_names(header: LogHeader) -> List[str]:
+    names = ["timestamp", "count"]
+    for label in header.labels:
+        names.append(label)
+        if header.board_type == BOARD_TYPE_CAP:
+            names.append(label + "_capdac")
+    names += ["status_flags", "verified"]
+    return names
+
+
+def write_csv(records: Iterator[Record], header: LogHeader, path: str) -> None:
+    with open(path, "w") as out:
+        out.write(",".join(column_names(header)) + "\n")
+        for r in records:
+            values = [str(r.timestamp), str(r.count)]
+            for i in range(header.channels):
+                # Same convention as the CSV logger: failed channels are NaN
+                values.append("NaN" if r.flags & (1 << i) else "%.4f" % r.values[i])
+                if header.board_type == BOARD_TYPE_CAP:
+                    values.append(str(r.metadata[i]))
+            values += ["%x" % r.flags, "1" if r.verified else "0"]
+            out.write(",".join(values) + "\n")
+
+
+def write_parquet(records: Iterator[Record], header: LogHeader, path: str) -> None:
+    try:
+        import pyarrow as pa
+        import pyarrow.parquet as pq
+    except ImportError:
+        print("Error: pyarrow is required for --format parquet (pip install pyarrow)", file=sys.stderr)
+        sys.exit(2)
+
+    rows = list(records)
+    columns = {
+        "timestamp": pa.array([r.timestamp for r in rows], pa.uint32()),
+        "count": pa.array([r.count for r in rows], pa.uint32()),
+    }
+    for i, label in enumerate(header.labels):
+        columns[label] = pa.array(
+            [None if r.flags & (1 << i) else r.values[i] for r in rows], pa.float32())
+        if header.board_type == BOARD_TYPE_CAP:
+            columns[label + "_capdac"] = pa.array([r.metadata[i] for r in rows], pa.uint8())
+    columns["status_flags"] = pa.array([r.flags for r in rows], pa.uint8())
+    columns["verified"] = pa.array([r.verified for r in rows], pa.bool_())
+
+    metadata = {
+        "board_name": header.board_name,
+        "board_type": str(header.board_type),
+        "units": ",".join(header.units),
+    }
+    table = pa.table(columns).replace_schema_metadata(metadata)
+    pq.write_table(table, path)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Convert SensythingCore binary SD logs to CSV or Parquet"
+    )
+    parser.add_argument("input", help="Binary log file (.bin)")
+    parser.add_argument("--output", help="Output file (default: input name with new extension)")
+    parser.add_argument("--format", choices=["csv", "parquet"], default="csv", help="Output format (default: csv)")
+    parser.add_argument("--verified-only", action="store_true", help="Drop records not covered by a valid sync trailer")
+
+    args = parser.parse_args()
+
+    with open(args.input, "rb") as f:
+        data = f.read()
+
+    try:
+        header = parse_header(data)
+    except ValueError as e:
+        print("Error: %s is not a valid Sensything binary log (%s)" % (args.input, e), file=sys.stderr)
+        sys.exit(1)
+
+    output = args.output or os.path.splitext(args.input)[0] + "." + args.format
+    decoder = LogDecoder(header)
+    records = decoder.decode(data)
+    if args.verified_only:
+        records = (r for r in records if r.verified)
+
+    if args.format == "parquet":
+        write_parquet(records, header, output)
+    else:
+        write_csv(records, header, output)
+
+    print("%s: %s, %d channels -> %s" % (args.input, header.board_name, header.channels, output), file=sys.stderr)
+    print("Records: %d verified, %d unverified; %d corrupt blocks, %d bytes skipped"
+          % (decoder.verified, decoder.unverified, decoder.corrupt_blocks, decoder.skipped_bytes),
+          file=sys.stderr)
+    sys.exit(0)
+
+
+if __name__ == "__main__":
+    main()
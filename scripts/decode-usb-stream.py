@@ -0,0 +1,332 @@
+#!/usr/bin/env python3
+
+################################################################################
+#
+#  SensythingCore - USB Binary Stream Decoder
+#
+#  Reference host-side decoder for the binary frame format selected with the
+#  'usb_format binary' command (see src/communication/SensythingUSB.h),
+#  including delta-encoded frames ('encoding usb delta', records described in
+#  src/core/SensythingDeltaCodec.h). Frames are validated with
+#  CRC-16/CCITT-FALSE and converted to CSV. Gaps in the sequence number are
+#  reported so captures can be checked for loss; after a damaged delta frame
+#  records are skipped until the next keyframe.
+#  Text printed by the board between frames (command replies) is passed
+#  through to stderr.
+#
+#  Prerequisites:
+#    - Python 3.7+
+#    - pyserial (only when reading from a serial port): pip install pyserial
+#
+#  Usage:
+#    python3 decode-usb-stream.py --port /dev/ttyACM0 [--output capture.csv]
+#    python3 decode-usb-stream.py --port /dev/ttyACM0 --delta [--output capture.csv]
+#    python3 decode-usb-stream.py --input capture.bin [--output capture.csv]
+#
+#  Options:
+#    --port PORT        Serial port to read from (sends 'usb_format binary')
+#    --delta            With --port, also request delta frames ('encoding usb delta')
+#    --baud BAUD        Serial baud rate (default: 115200)
+#    --input FILE       Raw byte capture to decode instead of a serial port
+#    --output FILE      CSV output file (default: stdout)
+#    --quiet            Do not echo board text to stderr
+#
+#  Exit Codes:
+#    0 - Stream decoded (gaps/CRC errors are reported, not fatal)
+#    2 - Prerequisites not met or invalid arguments
+#
+################################################################################
+
+import sys
+import struct
+import argparse
+from typing import Iterator, List, Optional, TextIO
+
+# Python 3.7+ compatibility
+if sys.version_info < (3, 7):
+    print("Error: Python 3.7 or higher required")
+    sys.exit(2)
+
+SYNC = b"\xA5\x5A"
+FRAME_MEASUREMENT = 0x01
+FRAME_DELTA = 0x02
+HEADER_SIZE = 4          # sync(2) + type(1) + length(1)
+CRC_SIZE = 2
+MIN_PAYLOAD = 10         # seq(4) + timestamp(4) + channel count(1) + flags(1)
+MIN_DELTA_PAYLOAD = 4    # header(1) + two varints(2) + flags(1)
+
+DELTA_KEYFRAME = 0x80
+DELTA_METADATA = 0x40
+DELTA_EXACT_LIMIT = 1 << 24
+
+
+def crc16_ccitt(data: bytes, crc: int = 0xFFFF) -> int:
+    """CRC-16/CCITT-FALSE, matching sensythingCRC16() on the device"""
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if (crc & 0x8000) else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+class Frame:
+    """Decoded measurement frame"""
+
+    def __init__(self, sequence: int, timestamp: int, flags: int,
+                 channels: List[float], metadata: List[int]):
+        self.sequence = sequence
+        self.timestamp = timestamp
+        self.flags = flags
+        self.channels = channels
+        self.metadata = metadata
+
+
+def is_whole(value: float) -> bool:
+    """Channels the device delta codes: whole numbers a float holds exactly"""
+    return value == value and abs(value) <= DELTA_EXACT_LIMIT and value == int(value)
+
+
+class DeltaState:
+    """Running state of a delta-encoded stream (mirrors SensythingDeltaEncoder)"""
+
+    def __init__(self):
+        self.synced = False
+        self.sequence = 0
+        self.timestamp = 0
+        self.reference: List[int] = []
+        self.metadata: List[int] = []
+
+    def decode(self, payload: bytes) -> Optional[Frame]:
+        """Decode one record; None if it is malformed or no keyframe was seen yet"""
+        try:
+            return self._decode(payload)
+        except (IndexError, struct.error):
+            self.synced = False
+            return None
+
+    def _decode(self, payload: bytes) -> Optional[Frame]:
+        head = payload[0]
+        if head & DELTA_KEYFRAME:
+            n = head & 0x0F
+            self.sequence, self.timestamp, flags = struct.unpack_from("<IIB", payload, 1)
+            channels = list(struct.unpack_from("<%df" % n, payload, 10))
+            self.metadata = list(payload[10 + 4 * n:10 + 5 * n])
+            if len(payload) != 10 + 5 * n:
+                raise IndexError
+            self.reference = [int(v) if is_whole(v) else 0 for v in channels]
+            self.synced = True
+            return Frame(self.sequence, self.timestamp, flags, channels, list(self.metadata))
+
+        if not self.synced:
+            return None
+
+        pos = 1
+
+        def varint() -> int:
+            nonlocal pos
+            value, shift = 0, 0
+            while True:
+                byte = payload[pos]
+                pos += 1
+                value |= (byte & 0x7F) << shift
+                shift += 7
+                if not byte & 0x80:
+                    return value
+
+        self.sequence = (self.sequence + varint()) & 0xFFFFFFFF
+        self.timestamp = (self.timestamp + varint()) & 0xFFFFFFFF
+        flags = payload[pos]
+        pos += 1
+
+        channels = []
+        for i in range(len(self.reference)):
+            if head & (1 << i):
+                (value,) = struct.unpack_from("<f", payload, pos)
+                pos += 4
+                channels.append(value)
+            else:
+                z = varint()
+                self.reference[i] += (z >> 1) ^ -(z & 1)
+                channels.append(float(self.reference[i]))
+
+        if head & DELTA_METADATA:
+            self.metadata = list(payload[pos:pos + len(self.reference)])
+            pos += len(self.reference)
+        if pos != len(payload):
+            raise IndexError
+        return Frame(self.sequence, self.timestamp, flags, channels, list(self.metadata))
+
+
+class FrameDecoder:
+    """Incremental decoder that resynchronises on the sync word"""
+
+    def __init__(self, text_sink: Optional[TextIO] = None):
+        self.buffer = bytearray()
+        self.text_sink = text_sink
+        self.frames = 0
+        self.crc_errors = 0
+        self.gaps = 0
+        self.missing = 0
+        self.last_sequence: Optional[int] = None
+        self.delta = DeltaState()
+        self.delta_skipped = 0
+
+    def _emit_text(self, data: bytes) -> None:
+        if self.text_sink and data:
+            self.text_sink.write(data.decode("utf-8", errors="replace"))
+
+    def feed(self, data: bytes) -> Iterator[Frame]:
+        self.buffer.extend(data)
+
+        while True:
+            start = self.buffer.find(SYNC)
+            if start < 0:
+                # Keep a trailing 0xA5 in case the sync word is split
+                keep = 1 if self.buffer.endswith(SYNC[:1]) else 0
+                self._emit_text(bytes(self.buffer[:len(self.buffer) - keep]))
+                del self.buffer[:len(self.buffer) - keep]
+                return
+
+            if start > 0:
+                self._emit_text(bytes(self.buffer[:start]))
+                del self.buffer[:start]
+
+            if len(self.buffer) < HEADER_SIZE:
+                return
+
+            frame_type = self.buffer[2]
+            length = self.buffer[3]
+            total = HEADER_SIZE + length + CRC_SIZE
+            min_payload = MIN_DELTA_PAYLOAD if frame_type == FRAME_DELTA else MIN_PAYLOAD
+            if frame_type not in (FRAME_MEASUREMENT, FRAME_DELTA) or length < min_payload:
+                # Not a frame after all; skip the sync byte and rescan
+                self._emit_text(bytes(self.buffer[:1]))
+                del self.buffer[:1]
+                continue
+
+            if len(self.buffer) < total:
+                return
+
+            body = bytes(self.buffer[2:HEADER_SIZE + length])
+            (crc,) = struct.unpack_from("<H", self.buffer, HEADER_SIZE + length)
+            if crc16_ccitt(body) != crc:
+                self.crc_errors += 1
+                self.delta.synced = False  # The lost record may have been a delta
+                del self.buffer[:1]
+                continue
+
+            payload = bytes(self.buffer[HEADER_SIZE:HEADER_SIZE + length])
+            del self.buffer[:total]
+            if frame_type == FRAME_DELTA:
+                frame = self.delta.decode(payload)
+                if frame is None:
+                    self.delta_skipped += 1
+                    continue
+            else:
+                frame = self._parse(payload)
+                if frame is None:
+                    self.crc_errors += 1
+                    continue
+
+            self._track_sequence(frame.sequence)
+            self.frames += 1
+            yield frame
+
+    def _parse(self, payload: bytes) -> Optional[Frame]:
+        sequence, timestamp, count, flags = struct.unpack_from("<IIBB", payload, 0)
+        if len(payload) != MIN_PAYLOAD + 5 * count:
+            return None
+        channels = list(struct.unpack_from("<%df" % count, payload, MIN_PAYLOAD))
+        metadata = list(payload[MIN_PAYLOAD + 4 * count:])
+        return Frame(sequence, timestamp, flags, channels, metadata)
+
+    def _track_sequence(self, sequence: int) -> None:
+        if self.last_sequence is not None and sequence != self.last_sequence + 1:
+            if sequence > self.last_sequence:
+                self.gaps += 1
+                self.missing += sequence - self.last_sequence - 1
+            # A lower sequence means the counter was reset on the device
+        self.last_sequence = sequence
+
+
+def write_csv(frames: Iterator[Frame], out: TextIO) -> None:
+    header_written = False
+    for frame in frames:
+        if not header_written:
+            n = len(frame.channels)
+            columns = ["count", "timestamp"]
+            columns += ["ch%d" % i for i in range(n)]
+            columns += ["meta%d" % i for i in range(n)]
+            columns += ["status_flags"]
+            out.write(",".join(columns) + "\n")
+            header_written = True
+
+        values = [str(frame.sequence), str(frame.timestamp)]
+        values += ["%.4f" % v for v in frame.channels]
+        values += [str(m) for m in frame.metadata]
+        values += ["0x%02x" % frame.flags]
+        out.write(",".join(values) + "\n")
+        out.flush()
+
+
+def read_chunks(source) -> Iterator[bytes]:
+    while True:
+        chunk = source.read(4096)
+        if not chunk:
+            return
+        yield chunk
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Decode SensythingCore binary USB frames to CSV"
+    )
+    group = parser.add_mutually_exclusive_group(required=True)
+    group.add_argument("--port", help="Serial port to read from")
+    group.add_argument("--input", help="Raw byte capture to decode")
+    parser.add_argument("--baud", type=int, default=115200, help="Serial baud rate (default: 115200)")
+    parser.add_argument("--output", help="CSV output file (default: stdout)")
+    parser.add_argument("--quiet", action="store_true", help="Do not echo board text to stderr")
+    parser.add_argument("--delta", action="store_true", help="With --port, request delta-encoded frames")
+
+    args = parser.parse_args()
+
+    decoder = FrameDecoder(text_sink=None if args.quiet else sys.stderr)
+    out = open(args.output, "w") if args.output else sys.stdout
+
+    if args.port:
+        try:
+            import serial
+        except ImportError:
+            print("Error: pyserial is required for --port (pip install pyserial)", file=sys.stderr)
+            sys.exit(2)
+        source = serial.Serial(args.port, args.baud, timeout=0.1)
+        source.write(b"usb_format binary\n")
+        source.write(b"encoding usb delta\n" if args.delta else b"encoding usb raw\n")
+        chunks = iter(lambda: source.read(4096), None)
+    else:
+        source = open(args.input, "rb")
+        chunks = read_chunks(source)
+
+    def frames() -> Iterator[Frame]:
+        for chunk in chunks:
+            yield from decoder.feed(chunk)
+
+    try:
+        write_csv(frames(), out)
+    except KeyboardInterrupt:
+        pass
+    finally:
+        source.close()
+        if out is not sys.stdout:
+            out.close()
+
+    print("Frames: %d, CRC errors: %d, gaps: %d (%d samples missing), delta records skipped: %d"
+          % (decoder.frames, decoder.crc_errors, decoder.gaps, decoder.missing, decoder.delta_skipped),
+          file=sys.stderr)
+    sys.exit(0)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,151 @@
+#!/usr/bin/env python3
+
+################################################################################
+#
+#  SensythingCore - Hot Path Benchmark Runner
+#
+#  Sends the 'bench' command to a board over USB serial, captures the JSON
+#  report (see src/core/SensythingBenchmark.h) and prints it as a table.
+#  The board compares each stage against the baseline stored in its NVS;
+#  with --baseline the report is also compared against a JSON file saved
+#  from an earlier run, so a bench rig can keep its reference in version
+#  control. The acquire_static and acquire_virtual stages (Sim board) are
+#  also compared with each other: their difference is the per-sample cost of
+#  reading through the vtable.
+#
+#  Prerequisites:
+#    - Python 3.7+
+#    - pyserial: pip install pyserial
+#
+#  Usage:
+#    python3 run-benchmark.py --port /dev/ttyACM0 [--output results.json]
+#    python3 run-benchmark.py --port /dev/ttyACM0 --baseline results.json
+#    python3 run-benchmark.py --port /dev/ttyACM0 --save
+#
+#  Options:
+#    --port PORT        Serial port of the board
+#    --baud BAUD        Serial baud rate (default: 115200)
+#    --output FILE      Write the JSON report to FILE
+#    --baseline FILE    Compare against a report saved with --output
+#    --tolerance PCT    Allowed slowdown for --baseline (default: 20)
+#    --save             Store this run as the board's NVS baseline
+#    --timeout SEC      Seconds to wait for the report (default: 60)
+#
+#  Exit Codes:
+#    0 - All stages within tolerance
+#    1 - A stage regressed (on the board or against --baseline)
+#    2 - Prerequisites not met, invalid arguments or no report received
+#
+################################################################################
+
+import sys
+import json
+import time
+import argparse
+from typing import Dict, List
+
+# Python 3.7+ compatibility
+if sys.version_info < (3, 7):
+    print("Error: Python 3.7 or higher required")
+    sys.exit(2)
+
+REPORT_PREFIX = '{"benchmark":'
+
+
+def read_report(port: str, baud: int, save: bool, timeout: float) -> Dict:
+    try:
+        import serial
+    except ImportError:
+        print("Error: pyserial is required (pip install pyserial)", file=sys.stderr)
+        sys.exit(2)
+
+    with serial.Serial(port, baud, timeout=0.5) as link:
+        link.reset_input_buffer()
+        link.write(b"bench save\n" if save else b"bench\n")
+
+        deadline = time.time() + timeout
+        while time.time() < deadline:
+            line = link.readline().decode("utf-8", errors="replace").strip()
+            if line.startswith(REPORT_PREFIX):
+                return json.loads(line)["benchmark"]
+
+    print("Error: no benchmark report within %d s" % timeout, file=sys.stderr)
+    sys.exit(2)
+
+
+def compare(report: Dict, baseline: Dict, tolerance: float) -> List[str]:
+    reference = {s["stage"]: s["mean_ns"] for s in baseline["stages"]}
+    regressed = []
+    for stage in report["stages"]:
+        base = reference.get(stage["stage"])
+        stage["file_baseline_ns"] = base
+        if base and stage["mean_ns"] > base * (1 + tolerance / 100.0):
+            regressed.append(stage["stage"])
+    return regressed
+
+
+def print_table(report: Dict) -> None:
+    print("%s @ %d MHz" % (report["board"], report["cpu_mhz"]))
+    print("%-16s %10s %10s %10s %10s %10s  %s" %
+          ("stage", "mean_ns", "min_ns", "heap_peak", "heap_net", "baseline", "status"))
+    for s in report["stages"]:
+        baseline = s.get("file_baseline_ns") or s["baseline_ns"] or "-"
+        status = "REGRESSED" if s["regressed"] else "ok"
+        print("%-16s %10d %10d %10d %10d %10s  %s" %
+              (s["stage"], s["mean_ns"], s["min_ns"], s["heap_peak_bytes"],
+               s["heap_net_bytes"], baseline, status))
+
+
+def print_dispatch(report: Dict) -> None:
+    """Per-sample cost of reading through the vtable (SensythingCoreT boards)"""
+    stages = {s["stage"]: s for s in report["stages"]}
+    if "acquire_static" not in stages or "acquire_virtual" not in stages:
+        return
+    static = stages["acquire_static"]["mean_ns"]
+    virtual = stages["acquire_virtual"]["mean_ns"]
+    print("Acquire dispatch: static %d ns, virtual %d ns per sample (%+d ns)" %
+          (static, virtual, virtual - static))
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Run the SensythingCore hot path benchmark on a connected board"
+    )
+    parser.add_argument("--port", required=True, help="Serial port of the board")
+    parser.add_argument("--baud", type=int, default=115200, help="Serial baud rate (default: 115200)")
+    parser.add_argument("--output", help="Write the JSON report to this file")
+    parser.add_argument("--baseline", help="Compare against a previously saved report")
+    parser.add_argument("--tolerance", type=float, default=20.0, help="Allowed slowdown in percent (default: 20)")
+    parser.add_argument("--save", action="store_true", help="Store this run as the board's NVS baseline")
+    parser.add_argument("--timeout", type=float, default=60.0, help="Seconds to wait for the report")
+
+    args = parser.parse_args()
+
+    report = read_report(args.port, args.baud, args.save, args.timeout)
+
+    regressed = [s["stage"] for s in report["stages"] if s["regressed"]]
+    if args.baseline:
+        with open(args.baseline) as f:
+            baseline = json.load(f)
+        for stage in compare(report, baseline.get("benchmark", baseline), args.tolerance):
+            if stage not in regressed:
+                regressed.append(stage)
+        for s in report["stages"]:
+            s["regressed"] = s["regressed"] or s["stage"] in regressed
+
+    print_table(report)
+    print_dispatch(report)
+
+    if args.output:
+        with open(args.output, "w") as f:
+            json.dump({"benchmark": report}, f, indent=2)
+        print("Report written to %s" % args.output)
+
+    if regressed:
+        print("Regressed: %s" % ", ".join(regressed), file=sys.stderr)
+        sys.exit(1)
+    sys.exit(0)
+
+
+if __name__ == "__main__":
+    main()
@@ -23,6 +23,8 @@
 #include "core/SensythingCore.h"
 #include "boards/SensythingCap.h"
 #include "boards/SensythingOX.h"
+#include "boards/SensythingSim.h"
+#include "boards/SensythingReplay.h"
 
 // Communication modules
 #include "communication/SensythingUSB.h"
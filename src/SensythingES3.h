@@ -27,6 +27,8 @@
 #include "core/SensythingCore.h"
 #include "boards/SensythingCap.h"
 #include "boards/SensythingOX.h"
+#include "boards/SensythingSim.h"
+#include "boards/SensythingReplay.h"
 
 #define SENSYTHING_ES3_VERSION SENSYTHING_ES3_NAME
 
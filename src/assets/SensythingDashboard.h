@@ -0,0 +1,663 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Platform - Web Dashboard (gzip)
+//    GENERATED by scripts/build-dashboard.py from src/assets/dashboard.html - do not edit
+//
+//    Source: 56069 bytes, minified: 34984 bytes, gzip: 10213 bytes
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SENSYTHING_DASHBOARD_H
+#define SENSYTHING_DASHBOARD_H
+
+#include <Arduino.h>
+
+#define SENSYTHING_DASHBOARD_ETAG "\"60af77431a9bb62e\""
+#define SENSYTHING_DASHBOARD_SIZE 10213
+
+const uint8_t SENSYTHING_DASHBOARD_GZ[SENSYTHING_DASHBOARD_SIZE] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x7d, 0xdb, 0x8e, 0xe3, 0x48,
+    0x76, 0xe0, 0x7b, 0x7e, 0x45, 0xb4, 0x66, 0x7b, 0x24, 0x55, 0x89, 0x4c, 0x5e, 0x74, 0xa1, 0x32,
+    0x2b, 0xd3, 0xce, 0xca, 0xaa, 0x9a, 0xca, 0x75, 0x55, 0x65, 0xa2, 0x32, 0xab, 0x2f, 0x53, 0x68,
+    0x8c, 0x29, 0x92, 0x4a, 0xd1, 0x45, 0x91, 0x32, 0x49, 0xe5, 0xa5, 0x7b, 0xea, 0xc5, 0xf0, 0x83,
+    0x61, 0xd8, 0x68, 0xef, 0x78, 0xb0, 0xc6, 0x1a, 0x06, 0xc6, 0xfb, 0xb8, 0x4f, 0xfb, 0xb6, 0xf0,
+    0x02, 0x8b, 0x7d, 0xd8, 0x4f, 0xe9, 0x1f, 0xd8, 0xf9, 0x84, 0x3d, 0xe7, 0x44, 0x04, 0x19, 0xbc,
+    0x48, 0x99, 0x75, 0x31, 0xec, 0x01, 0x76, 0x72, 0xba, 0x44, 0xc5, 0xe5, 0xc4, 0xb9, 0xc7, 0x89,
+    0x88, 0x13, 0xd4, 0xa3, 0x2f, 0x9e, 0x9c, 0x1e, 0x5f, 0x7c, 0x7b, 0xf6, 0x94, 0x2d, 0xf2, 0x65,
+    0x74, 0xb8, 0xf3, 0x48, 0x7e, 0x04, 0xae, 0x0f, 0x1f, 0xcb, 0x20, 0x77, 0x99, 0xb7, 0x70, 0xd3,
+    0x2c, 0xc8, 0x0f, 0x3a, 0x6f, 0x2e, 0x9e, 0x69, 0x4e, 0x47, 0x16, 0xc7, 0xee, 0x32, 0x38, 0xe8,
+    0x5c, 0x85, 0xc1, 0xf5, 0x2a, 0x49, 0xf3, 0x0e, 0xf3, 0x92, 0x38, 0x0f, 0x62, 0x68, 0x76, 0x1d,
+    0xfa, 0xf9, 0xe2, 0xc0, 0x0f, 0xae, 0x42, 0x2f, 0xd0, 0xe8, 0xcb, 0x80, 0x85, 0x71, 0x98, 0x87,
+    0x6e, 0xa4, 0x65, 0x9e, 0x1b, 0x05, 0x07, 0xa6, 0x6e, 0x20, 0x98, 0x3c, 0xcc, 0xa3, 0xe0, 0xf0,
+    0x3c, 0x88, 0xb3, 0xdb, 0x7c, 0x11, 0xc6, 0x97, 0xec, 0x2c, 0x72, 0xf3, 0x79, 0x92, 0x2e, 0x99,
+    0xc6, 0x5e, 0x84, 0x57, 0x01, 0x7b, 0xe2, 0x66, 0x8b, 0x59, 0xe2, 0xa6, 0xfe, 0xa3, 0x5d, 0xde,
+    0x76, 0xe7, 0x51, 0x96, 0xdf, 0xe2, 0xe7, 0x03, 0xf6, 0xc3, 0xce, 0x2c, 0xb9, 0xd1, 0xb2, 0xf0,
+    0x7b, 0xe8, 0xb8, 0xc7, 0x66, 0x49, 0xea, 0x07, 0xa9, 0x06, 0x45, 0xfb, 0x3b, 0xef, 0xa1, 0xc6,
+    0xbf, 0x85, 0x06, 0x73, 0xc0, 0x48, 0x9b, 0xbb, 0xcb, 0x30, 0xba, 0xdd, 0x63, 0x9a, 0xbb, 0x5a,
+    0x45, 0x81, 0x96, 0xdd, 0x66, 0x79, 0xb0, 0x1c, 0xb0, 0xc7, 0x51, 0x18, 0xbf, 0x7b, 0xe9, 0x7a,
+    0xe7, 0xf4, 0xfd, 0x19, 0xb4, 0x1c, 0xb0, 0xce, 0x79, 0x70, 0x99, 0x04, 0xec, 0xcd, 0x49, 0x67,
+    0xc0, 0x5e, 0x27, 0xb3, 0x24, 0x4f, 0xa0, 0xec, 0x79, 0x10, 0x5d, 0x05, 0x79, 0xe8, 0xb9, 0xec,
+    0x55, 0xb0, 0x0e, 0xa0, 0xe6, 0x28, 0x05, 0x42, 0x06, 0x2c, 0x73, 0xe3, 0x4c, 0xcb, 0x82, 0x34,
+    0x9c, 0xef, 0xef, 0x2c, 0xdd, 0xf4, 0x32, 0x8c, 0xf7, 0x98, 0xb1, 0xbf, 0xb3, 0x72, 0x7d, 0x9f,
+    0x30, 0x32, 0x8d, 0x15, 0xe0, 0x32, 0x73, 0xbd, 0x77, 0x97, 0x69, 0xb2, 0x8e, 0xfd, 0x3d, 0xf6,
+    0x33, 0x83, 0xfe, 0xb7, 0xbf, 0xe3, 0x25, 0x51, 0x92, 0xc2, 0x77, 0xdb, 0xb6, 0x11, 0x5b, 0x1d,
+    0x39, 0xe7, 0x86, 0x71, 0x90, 0x02, 0xce, 0x4b, 0xf7, 0x86, 0xf3, 0x0c, 0x20, 0x8c, 0x0d, 0x82,
+    0x51, 0x40, 0x67, 0xee, 0x3a, 0x4f, 0xaa, 0x30, 0xaf, 0x17, 0x61, 0x1e, 0x40, 0x11, 0x27, 0x3f,
+    0x75, 0xfd, 0x70, 0x9d, 0x41, 0x4f, 0x0b, 0xfb, 0x15, 0xa8, 0x58, 0x1c, 0x15, 0x64, 0xd7, 0xc2,
+    0xf5, 0x93, 0x6b, 0x04, 0x85, 0xe8, 0xb1, 0x21, 0xfe, 0x93, 0x5e, 0xce, 0xdc, 0x9e, 0x31, 0xa0,
+    0x3f, 0xdd, 0xea, 0x13, 0x46, 0x28, 0x7e, 0x42, 0xc7, 0x0f, 0xb3, 0x55, 0xe4, 0x02, 0xfb, 0xe6,
+    0x51, 0x00, 0x30, 0xfe, 0x6c, 0x9d, 0xe5, 0xe1, 0xfc, 0x56, 0x13, 0xb2, 0xde, 0x63, 0xd9, 0xca,
+    0x05, 0x21, 0xcf, 0x82, 0xfc, 0x3a, 0x08, 0xe2, 0xfd, 0x1d, 0x37, 0x0a, 0x2f, 0x63, 0x0d, 0x50,
+    0x5a, 0x02, 0x16, 0x1e, 0xb4, 0x08, 0x52, 0x89, 0x3f, 0xc8, 0x26, 0xcf, 0x93, 0x25, 0x20, 0x37,
+    0x52, 0x90, 0xab, 0x95, 0x16, 0x62, 0xe4, 0x85, 0x40, 0x06, 0xcb, 0x92, 0x28, 0xf4, 0xd9, 0xcf,
+    0x02, 0x03, 0xff, 0x10, 0xb9, 0x85, 0x49, 0x6c, 0x2a, 0x38, 0x2e, 0xb9, 0x39, 0x1e, 0x4f, 0x82,
+    0xc0, 0xdd, 0xe7, 0x52, 0x07, 0xbd, 0x08, 0xa0, 0xbf, 0xb3, 0x22, 0x7d, 0xd0, 0xb3, 0xf5, 0x8c,
+    0x14, 0x68, 0x53, 0xcf, 0x71, 0xa5, 0x9b, 0x69, 0xcb, 0x6e, 0xb9, 0x9b, 0xaf, 0xb3, 0x26, 0x1b,
+    0x2e, 0xdd, 0x95, 0xc4, 0xb8, 0x95, 0xe2, 0xa2, 0x2b, 0x55, 0x34, 0xfb, 0xb7, 0x76, 0x22, 0xa0,
+    0xe3, 0x8a, 0xe0, 0xe0, 0x9b, 0x90, 0x65, 0x45, 0x8f, 0xe6, 0x23, 0xfc, 0x6b, 0x48, 0x9d, 0x8b,
+    0x79, 0x33, 0x1d, 0x9a, 0x9f, 0xe4, 0x80, 0x8b, 0xd0, 0x2e, 0x62, 0xcd, 0x22, 0x08, 0x2f, 0x17,
+    0xb9, 0xf8, 0x52, 0x03, 0x37, 0x32, 0xbe, 0xac, 0x8d, 0x3b, 0xf4, 0xdc, 0xf9, 0x08, 0xf8, 0xe6,
+    0xc6, 0xe1, 0xd2, 0xcd, 0xc3, 0x04, 0xb8, 0xb8, 0x5a, 0x47, 0x59, 0xc0, 0xac, 0x0c, 0x0c, 0x7c,
+    0x8e, 0x36, 0x1e, 0xe0, 0x78, 0x7f, 0xfc, 0x2e, 0xb8, 0x9d, 0xa7, 0xe0, 0x1e, 0x32, 0x51, 0xff,
+    0xc3, 0x8e, 0xf1, 0xe5, 0x00, 0x54, 0xce, 0xf8, 0x92, 0xfd, 0xc0, 0x12, 0x50, 0x99, 0x30, 0x07,
+    0x5e, 0x98, 0xfb, 0xec, 0xfd, 0xce, 0xa8, 0x5a, 0x66, 0xe8, 0x23, 0x2c, 0x7d, 0xbf, 0xb3, 0xfb,
+    0x80, 0x1d, 0xe0, 0xff, 0xd8, 0xc5, 0xe9, 0xe9, 0x8b, 0xc7, 0x47, 0xaf, 0xd9, 0xf9, 0xd3, 0xe3,
+    0x8b, 0x93, 0xd3, 0x57, 0xa2, 0xf4, 0xc1, 0xee, 0x8e, 0x9e, 0x27, 0x49, 0x34, 0x73, 0x51, 0x4b,
+    0xab, 0xdc, 0x71, 0xe6, 0xd3, 0xb9, 0x2b, 0xc9, 0x81, 0x61, 0x9a, 0x4a, 0x54, 0xa3, 0xd4, 0xa9,
+    0x30, 0x9d, 0x33, 0xbc, 0x55, 0x69, 0x5b, 0xd5, 0xc0, 0xda, 0xa8, 0x06, 0xd8, 0x4a, 0xbb, 0x4e,
+    0xb1, 0x15, 0xfe, 0x4b, 0xa2, 0x10, 0x48, 0x6b, 0x91, 0x3b, 0x0b, 0x22, 0xe9, 0xa3, 0x84, 0xb8,
+    0xac, 0x42, 0x7e, 0xd7, 0x42, 0x2e, 0x63, 0xa3, 0xaa, 0xe0, 0xfb, 0x3b, 0x79, 0x70, 0x93, 0x6b,
+    0x79, 0x0a, 0xce, 0x07, 0x1d, 0xe5, 0x1e, 0x5b, 0xaf, 0x56, 0x41, 0xea, 0xb9, 0x19, 0x30, 0x3e,
+    0x0a, 0x72, 0x18, 0x56, 0x43, 0x93, 0x24, 0x42, 0x80, 0x97, 0x44, 0x09, 0x90, 0x21, 0x65, 0x6e,
+    0x08, 0x85, 0x90, 0x58, 0xf8, 0xe1, 0x55, 0xc8, 0x0d, 0x5d, 0xfa, 0x1c, 0x55, 0x2b, 0xac, 0x61,
+    0x43, 0xf5, 0x7c, 0xdf, 0xaf, 0x00, 0xc0, 0x8a, 0xd5, 0x06, 0x03, 0x71, 0xb6, 0xd9, 0x87, 0x04,
+    0x90, 0x05, 0x51, 0xe0, 0xa1, 0x5a, 0x56, 0x95, 0xde, 0x28, 0x15, 0xb2, 0x22, 0x41, 0x1a, 0xbf,
+    0x26, 0xbe, 0x61, 0x5d, 0xed, 0x1b, 0x16, 0x23, 0xbc, 0xa4, 0xb7, 0x4e, 0x33, 0xe4, 0xe4, 0x2a,
+    0x09, 0x85, 0x67, 0x2a, 0x59, 0x63, 0x5a, 0x75, 0xde, 0x70, 0xcc, 0xf6, 0xe6, 0x89, 0x47, 0x2e,
+    0x20, 0x59, 0xe7, 0x30, 0x65, 0x00, 0xf8, 0x38, 0x89, 0x4b, 0x8f, 0x5b, 0x77, 0x3e, 0x55, 0x27,
+    0x8b, 0x7f, 0x96, 0x74, 0xb1, 0xa6, 0x61, 0x81, 0x0d, 0x58, 0xe3, 0x01, 0xb3, 0xec, 0xe1, 0x00,
+    0xa4, 0x63, 0xf6, 0x2b, 0xe3, 0xcd, 0xf2, 0xb8, 0xc1, 0x06, 0xeb, 0x43, 0xd9, 0xd0, 0x46, 0xb5,
+    0x3a, 0xdb, 0x34, 0x58, 0xb0, 0x5d, 0xff, 0x46, 0xa8, 0x7f, 0xa4, 0x6d, 0x21, 0xb7, 0x77, 0x37,
+    0x8a, 0x00, 0x73, 0x2b, 0xdb, 0xdf, 0x21, 0xe8, 0xa4, 0x6c, 0xc4, 0x93, 0x86, 0x82, 0x03, 0x39,
+    0x7b, 0x8b, 0xe4, 0x2a, 0x68, 0xda, 0xa7, 0x81, 0x7f, 0x0d, 0x0e, 0xce, 0x66, 0xb3, 0x7a, 0x7f,
+    0xdd, 0xf5, 0x72, 0x0c, 0x03, 0x6a, 0x00, 0x24, 0xaf, 0x45, 0xcf, 0xea, 0x14, 0x58, 0x17, 0x48,
+    0x15, 0xa2, 0x96, 0x2d, 0x55, 0x1e, 0x8f, 0x0a, 0x55, 0x53, 0xd9, 0x60, 0x0a, 0x45, 0xb8, 0x0e,
+    0x63, 0x90, 0x23, 0xcd, 0x75, 0x69, 0x12, 0x6d, 0x50, 0xf2, 0xf1, 0x36, 0x25, 0x17, 0x10, 0xae,
+    0xdc, 0x68, 0x4d, 0x53, 0x4f, 0xa9, 0x6e, 0x43, 0x1a, 0x95, 0x8c, 0x99, 0x3a, 0x2b, 0x4e, 0x63,
+    0x9b, 0xfd, 0x0b, 0x92, 0x0a, 0xe7, 0x78, 0xfc, 0xfc, 0xe8, 0xf5, 0x45, 0x8b, 0x6b, 0xc4, 0x90,
+    0x2d, 0xd7, 0xd4, 0xb8, 0x62, 0x95, 0x48, 0x11, 0xa6, 0x01, 0x44, 0x59, 0xc0, 0xd6, 0xd2, 0xce,
+    0x47, 0x6a, 0x9c, 0x51, 0x9f, 0x91, 0x37, 0x05, 0x1b, 0xf7, 0x76, 0xac, 0xa8, 0x03, 0xf3, 0x08,
+    0x0d, 0x62, 0x11, 0xfa, 0x3e, 0x46, 0x09, 0xef, 0x77, 0x7e, 0x46, 0x08, 0x1e, 0xbb, 0xf1, 0x95,
+    0x9b, 0x29, 0xce, 0xc7, 0xc0, 0x29, 0x47, 0x62, 0xc5, 0xbf, 0x29, 0xc4, 0x9e, 0x9f, 0x3c, 0x79,
+    0xaa, 0x3d, 0xfe, 0x56, 0xc3, 0x4f, 0xf6, 0xe2, 0xe8, 0xdb, 0xd3, 0x37, 0x17, 0xec, 0xd9, 0xe9,
+    0x6b, 0xf6, 0xe4, 0xe9, 0xf9, 0x9f, 0x5c, 0x9c, 0x9e, 0xa9, 0xe4, 0xf3, 0xf0, 0x84, 0x7c, 0xef,
+    0xaa, 0x1a, 0xc7, 0x5c, 0xa6, 0x21, 0x98, 0x0e, 0xfe, 0xab, 0x81, 0xb8, 0xa0, 0x0c, 0x94, 0x18,
+    0x18, 0xbc, 0x5e, 0xc6, 0x18, 0x37, 0xcd, 0x53, 0xfc, 0x6f, 0xf3, 0x04, 0x0f, 0x13, 0x69, 0x9a,
+    0xf3, 0x98, 0x8d, 0x38, 0x9c, 0x81, 0x87, 0x00, 0xa6, 0x36, 0x75, 0x83, 0x5c, 0xbf, 0x1f, 0xa6,
+    0xbc, 0x1e, 0xa4, 0x4b, 0x43, 0x54, 0xa6, 0x0c, 0x00, 0x92, 0x22, 0xa5, 0xda, 0xca, 0x8d, 0x83,
+    0xe8, 0xa3, 0x40, 0x48, 0xd6, 0x6a, 0xd0, 0x89, 0xc7, 0x86, 0x18, 0x3e, 0x2e, 0x4a, 0xe5, 0x51,
+    0x23, 0xad, 0x54, 0x99, 0xea, 0x89, 0xab, 0xe7, 0x1e, 0xa8, 0x35, 0xcd, 0xa0, 0x18, 0x54, 0x63,
+    0xfc, 0x0d, 0x53, 0x0a, 0xa3, 0x66, 0x8c, 0xe3, 0x84, 0xbc, 0x54, 0x70, 0xdc, 0xdb, 0x03, 0xc5,
+    0x9c, 0xbd, 0x0b, 0x81, 0xee, 0xa2, 0x6b, 0x21, 0xbc, 0x71, 0x93, 0xa6, 0x96, 0xf6, 0x38, 0x75,
+    0x79, 0xef, 0x1a, 0x2e, 0xc1, 0xc4, 0xbf, 0x66, 0x18, 0x6b, 0xdc, 0x13, 0xe6, 0x62, 0xbd, 0x9c,
+    0xd5, 0x61, 0x7a, 0x9e, 0xf7, 0x69, 0x00, 0xdb, 0xbd, 0xd7, 0x74, 0x3a, 0x15, 0xec, 0x7b, 0x1d,
+    0x64, 0xab, 0x04, 0x1c, 0xe3, 0x15, 0xf8, 0x8c, 0xf3, 0x1c, 0xa9, 0x02, 0x45, 0xc8, 0x96, 0xe0,
+    0x21, 0xa1, 0x17, 0xc0, 0x82, 0x80, 0x38, 0x43, 0x0e, 0xfe, 0xf1, 0x32, 0xf0, 0x43, 0x97, 0xf5,
+    0xd4, 0xc8, 0xde, 0x42, 0xd1, 0xf4, 0x01, 0x76, 0x8b, 0xaa, 0x6e, 0xd6, 0x4d, 0x45, 0xf1, 0x54,
+    0xd3, 0x96, 0xf2, 0x1e, 0x1a, 0x46, 0xab, 0x5e, 0xa9, 0x3a, 0xc1, 0x27, 0xaf, 0xf7, 0x35, 0x1f,
+    0xf2, 0xea, 0xd5, 0xd3, 0x17, 0xec, 0xab, 0xa3, 0x17, 0x6f, 0x9e, 0x9e, 0xb3, 0x5f, 0xbc, 0x3e,
+    0x79, 0xa2, 0x98, 0x12, 0xc4, 0x75, 0x89, 0x86, 0x28, 0xdd, 0xdb, 0x88, 0xd2, 0x60, 0x15, 0xb8,
+    0x79, 0x0f, 0x27, 0xbb, 0x79, 0xda, 0xaf, 0xe8, 0x6b, 0xab, 0x87, 0x21, 0x54, 0x9e, 0x55, 0x35,
+    0x0f, 0x96, 0x57, 0x8b, 0xe4, 0x9a, 0x79, 0xb0, 0xf4, 0xc3, 0xd0, 0x92, 0x59, 0x37, 0x16, 0x0d,
+    0x5a, 0xd7, 0x48, 0x56, 0xc1, 0xef, 0x9e, 0x08, 0xbd, 0x6f, 0x15, 0xc9, 0xb0, 0x10, 0xc9, 0xfd,
+    0x41, 0xa2, 0xcd, 0x69, 0xf3, 0x10, 0x96, 0x8e, 0xe0, 0xda, 0x01, 0x58, 0x8f, 0xa2, 0x08, 0x3e,
+    0x4e, 0x9f, 0xb3, 0x99, 0x43, 0x43, 0x42, 0xd4, 0x89, 0xa7, 0x19, 0xa2, 0x60, 0x6c, 0x41, 0xf1,
+    0x14, 0xa8, 0x2a, 0xe8, 0x43, 0xcf, 0xb4, 0x47, 0x7e, 0x70, 0x39, 0x00, 0xdb, 0x98, 0xe2, 0x1f,
+    0xc3, 0x00, 0x5a, 0x4c, 0x9d, 0xe4, 0x19, 0xfb, 0xed, 0xce, 0x56, 0x94, 0x45, 0xc1, 0x3c, 0xa7,
+    0x88, 0x40, 0x3a, 0xe8, 0x32, 0x3e, 0xe1, 0x7d, 0x84, 0x8b, 0x6d, 0x7a, 0xf0, 0xb6, 0x29, 0xa9,
+    0x1a, 0xd4, 0x60, 0x40, 0x33, 0xac, 0xaf, 0x1b, 0x8d, 0x51, 0xbf, 0x3d, 0x50, 0x60, 0x01, 0xc5,
+    0xa6, 0x2a, 0x23, 0x4a, 0xc3, 0xaa, 0xc0, 0x1d, 0x8a, 0x80, 0x67, 0x53, 0xb4, 0x54, 0x8c, 0xc0,
+    0x03, 0x5f, 0x7a, 0x44, 0xa9, 0x7c, 0xdb, 0xd3, 0xa0, 0x57, 0xbf, 0x1c, 0xa3, 0x2d, 0xb4, 0xa6,
+    0x39, 0x5d, 0x4e, 0xa4, 0x8e, 0xe3, 0x34, 0x74, 0x71, 0x58, 0xcc, 0xc7, 0xed, 0xc1, 0x75, 0x73,
+    0x5a, 0xde, 0x10, 0x6e, 0x4b, 0x2c, 0xe4, 0xa4, 0xaf, 0x2e, 0x47, 0x87, 0x8d, 0x00, 0x6b, 0x96,
+    0x44, 0x7e, 0x73, 0x86, 0x47, 0x65, 0x28, 0x4c, 0xd6, 0xd4, 0xad, 0x12, 0xea, 0x1a, 0xd6, 0x58,
+    0x35, 0xd2, 0x0c, 0x95, 0x34, 0x72, 0x4f, 0x82, 0xb4, 0x3c, 0x59, 0xd1, 0x12, 0xba, 0x1a, 0x31,
+    0x9c, 0xbe, 0x7a, 0x76, 0xf2, 0x8b, 0x37, 0xaf, 0x8f, 0x28, 0x62, 0x38, 0x3b, 0x42, 0xcb, 0xef,
+    0x1d, 0x9f, 0xbe, 0x78, 0x71, 0x74, 0x76, 0x7e, 0xf2, 0xf8, 0xc5, 0xd3, 0x7e, 0x75, 0x1a, 0x9d,
+    0x87, 0x97, 0x85, 0x1f, 0xf9, 0xc0, 0x79, 0xbf, 0xea, 0xe1, 0x49, 0x8b, 0x1b, 0x5c, 0x37, 0xda,
+    0xc2, 0x83, 0xa6, 0xba, 0x39, 0xad, 0xea, 0xf6, 0xbe, 0xc0, 0xb0, 0xd8, 0xae, 0xf8, 0x28, 0x03,
+    0xe3, 0x46, 0x45, 0x06, 0x16, 0x38, 0xf8, 0x57, 0x33, 0xb0, 0xc2, 0x5d, 0x35, 0xe9, 0x6e, 0x84,
+    0xd3, 0x9f, 0x63, 0xbf, 0x64, 0x9d, 0x05, 0xc5, 0xea, 0xa3, 0x70, 0xd8, 0x55, 0x52, 0xdb, 0xe7,
+    0x26, 0x8e, 0x7d, 0x0b, 0x63, 0x16, 0x76, 0x75, 0xe3, 0x43, 0x55, 0x9f, 0xa1, 0xaa, 0x3e, 0x4a,
+    0xd4, 0x2c, 0x20, 0xe4, 0xc9, 0xe5, 0x65, 0x54, 0xd3, 0x63, 0x93, 0xe4, 0xab, 0x5a, 0x7b, 0x61,
+    0x33, 0x60, 0x05, 0x76, 0xd6, 0xec, 0x0f, 0xdf, 0xa2, 0xc8, 0x5d, 0x65, 0x01, 0x7a, 0x41, 0xc5,
+    0xc0, 0xd2, 0x24, 0x07, 0x0b, 0xee, 0x69, 0x53, 0x03, 0x64, 0x51, 0x11, 0xa9, 0xe0, 0x58, 0x45,
+    0xa6, 0xd5, 0x35, 0xf8, 0x7d, 0x26, 0xa1, 0x86, 0x83, 0xb6, 0x46, 0xaa, 0x83, 0x56, 0xc2, 0x3c,
+    0x75, 0x92, 0x04, 0xf1, 0x1b, 0xed, 0xe1, 0x95, 0x4a, 0x73, 0xd9, 0x83, 0x88, 0x1e, 0xc8, 0x4d,
+    0x8c, 0x06, 0x0b, 0x04, 0x29, 0x3a, 0xd7, 0xef, 0xda, 0x84, 0xac, 0x6e, 0x19, 0xa2, 0x35, 0x14,
+    0x1b, 0x21, 0x0a, 0xa5, 0x75, 0x1d, 0x68, 0xdf, 0x54, 0xda, 0x1a, 0x2f, 0x4a, 0xd7, 0x24, 0x20,
+    0x7c, 0xc4, 0xee, 0x03, 0x2d, 0x1f, 0x3f, 0x7c, 0xf7, 0x41, 0xc1, 0x3a, 0x5e, 0xad, 0x41, 0x10,
+    0xf2, 0x6b, 0x73, 0xe1, 0xef, 0x7c, 0xf2, 0xc2, 0xdf, 0x6e, 0x19, 0x91, 0x2f, 0xe0, 0xeb, 0xe3,
+    0xfe, 0xeb, 0x2f, 0xeb, 0xc5, 0x70, 0xb3, 0x35, 0x38, 0x8f, 0x38, 0xdb, 0xb6, 0x45, 0xd2, 0xb6,
+    0x4d, 0x54, 0xdb, 0x0c, 0x20, 0xd6, 0x0c, 0x55, 0xd6, 0x54, 0xd0, 0xdd, 0xb8, 0x05, 0xb0, 0x61,
+    0xad, 0xfc, 0xa9, 0xbb, 0x00, 0xe5, 0x10, 0x77, 0x6c, 0x06, 0x6c, 0xdc, 0x04, 0x18, 0x8d, 0xc6,
+    0x8e, 0x6f, 0x17, 0x6d, 0x80, 0x37, 0xee, 0x2c, 0x22, 0xef, 0xd0, 0x0c, 0xe2, 0x25, 0xb6, 0x71,
+    0x82, 0x91, 0x09, 0xd8, 0x63, 0xe0, 0xcb, 0x8e, 0x5a, 0xb6, 0xf6, 0xbc, 0x20, 0xcb, 0xea, 0xfd,
+    0x86, 0xce, 0x6c, 0x36, 0x71, 0xea, 0xad, 0xda, 0x51, 0xb1, 0x1d, 0xd7, 0x1c, 0x4f, 0x8b, 0xb6,
+    0xbe, 0x1b, 0x5f, 0xb6, 0x6c, 0x5a, 0x8c, 0xc6, 0xf0, 0x57, 0x6b, 0xb4, 0xc1, 0x0b, 0x8f, 0xec,
+    0xc0, 0x0e, 0xca, 0xb1, 0x97, 0xed, 0x9b, 0x5b, 0x6d, 0x3b, 0x0e, 0x85, 0xde, 0xce, 0x93, 0x36,
+    0xe3, 0xac, 0xec, 0x57, 0xab, 0x93, 0xbc, 0x53, 0xdd, 0xe7, 0x9d, 0xb9, 0xfe, 0x65, 0xa0, 0x6a,
+    0x5c, 0x18, 0x53, 0x44, 0x31, 0x8b, 0x12, 0xef, 0x9d, 0xe2, 0x6f, 0xec, 0x9a, 0xc1, 0xd5, 0xce,
+    0x0f, 0x1a, 0x18, 0x36, 0x9d, 0x03, 0xd2, 0x88, 0x83, 0x6d, 0x92, 0x83, 0x37, 0x9e, 0x8f, 0xfd,
+    0x51, 0x89, 0xb9, 0x65, 0x8d, 0x86, 0xb6, 0xaf, 0xf4, 0xbb, 0x76, 0xd3, 0x18, 0x57, 0x9e, 0x75,
+    0x76, 0x07, 0xc1, 0xcc, 0x73, 0xca, 0x7e, 0x13, 0xcf, 0xf2, 0x4d, 0x4b, 0xe9, 0x27, 0x58, 0x54,
+    0xe9, 0x34, 0x0b, 0x02, 0x7b, 0xae, 0x74, 0xb2, 0xbc, 0x91, 0xe5, 0xf0, 0x4e, 0xf3, 0x24, 0xc9,
+    0xc5, 0xf1, 0x4a, 0xc9, 0xb5, 0xea, 0x41, 0x84, 0x52, 0x24, 0xb8, 0xc1, 0x4b, 0xee, 0x17, 0x22,
+    0x6f, 0x3c, 0x4a, 0xa8, 0xc7, 0x5f, 0xa7, 0xdf, 0xb0, 0xc7, 0xa7, 0x47, 0xaf, 0x9f, 0xb0, 0xf3,
+    0xb3, 0xa7, 0xc7, 0x27, 0xcf, 0x4e, 0x8e, 0xd9, 0xf9, 0xc5, 0xb7, 0x2f, 0x60, 0xdd, 0x55, 0x84,
+    0x5d, 0xd0, 0x14, 0x1a, 0x7d, 0x15, 0xe6, 0x6e, 0x94, 0xb1, 0xe3, 0x62, 0x9d, 0x87, 0x01, 0x19,
+    0x78, 0xa1, 0x2b, 0x2a, 0xaf, 0xac, 0xff, 0x3e, 0x6d, 0x46, 0x34, 0xc7, 0xcd, 0x19, 0x71, 0xdc,
+    0xb2, 0x58, 0x93, 0xfb, 0xa3, 0x0a, 0x7a, 0xec, 0x18, 0x97, 0x35, 0x1a, 0x7b, 0x01, 0x2d, 0x03,
+    0xe6, 0x82, 0x37, 0x38, 0x4b, 0x13, 0x00, 0x8b, 0xf3, 0xb6, 0x8a, 0x6e, 0x63, 0xf9, 0x63, 0x19,
+    0x77, 0x6c, 0x2d, 0x59, 0x77, 0x86, 0x98, 0x9c, 0xb1, 0x6d, 0xa2, 0xb8, 0xe7, 0xb4, 0xd8, 0x08,
+    0xcd, 0x64, 0xff, 0xf6, 0x33, 0x2c, 0xe0, 0x44, 0x11, 0x1e, 0x38, 0x2d, 0xe7, 0x69, 0xed, 0x61,
+    0xaa, 0xd3, 0xba, 0x2a, 0x12, 0xe1, 0x41, 0x85, 0x3d, 0xf7, 0x5a, 0x14, 0x49, 0xb8, 0xa6, 0x38,
+    0xa6, 0x2b, 0x20, 0xb4, 0x2c, 0x36, 0x86, 0xce, 0x1d, 0x8b, 0x0d, 0x9a, 0xd0, 0xab, 0x2b, 0x8d,
+    0xf2, 0xac, 0x91, 0xc6, 0x34, 0xaa, 0x83, 0xb4, 0xac, 0x3d, 0x9c, 0xc6, 0xda, 0xa3, 0x39, 0x71,
+    0xa8, 0x20, 0x8a, 0x03, 0xb5, 0x8d, 0xdb, 0xdc, 0x6d, 0xa7, 0x59, 0x15, 0x97, 0xb3, 0xc1, 0xa9,
+    0x35, 0x6c, 0xae, 0xcd, 0x3f, 0x22, 0x6b, 0xb9, 0x8b, 0x8c, 0x21, 0x7c, 0x71, 0xa3, 0xba, 0x07,
+    0xf1, 0x87, 0x81, 0xef, 0x97, 0xb3, 0xe5, 0xcf, 0xcc, 0xd1, 0x68, 0x62, 0x0d, 0x6b, 0x5d, 0x37,
+    0xb9, 0xac, 0xf9, 0xdc, 0xf6, 0x14, 0xf6, 0x3a, 0xa3, 0xf1, 0xd0, 0xa8, 0xf7, 0xf5, 0xd2, 0x10,
+    0x8f, 0x92, 0xa3, 0xe6, 0x99, 0x95, 0x3f, 0x51, 0x07, 0x9e, 0x58, 0xa6, 0xc7, 0x07, 0xe6, 0xe6,
+    0x76, 0x76, 0xf6, 0x0b, 0x76, 0x2e, 0xf6, 0x1a, 0x85, 0x65, 0xad, 0x56, 0x97, 0xca, 0xf6, 0x63,
+    0xab, 0xb1, 0x96, 0x91, 0xf3, 0x78, 0xe3, 0x82, 0x6c, 0xf3, 0x26, 0x42, 0xab, 0xef, 0x7b, 0x5f,
+    0x8c, 0x4d, 0xfb, 0x50, 0xca, 0xee, 0x13, 0x45, 0xd6, 0xec, 0x8b, 0x70, 0x89, 0xd9, 0x00, 0x6e,
+    0x9c, 0x0b, 0xe4, 0x8f, 0x8f, 0xce, 0xd8, 0x2f, 0x70, 0x2f, 0xe5, 0xc8, 0x47, 0x8b, 0x5b, 0x4a,
+    0xdf, 0xe0, 0xb9, 0xab, 0xfb, 0xed, 0xb1, 0x0c, 0xb7, 0x6f, 0xdb, 0x28, 0x3b, 0x69, 0xf7, 0x85,
+    0xa8, 0x6c, 0x04, 0xb5, 0xc2, 0x9c, 0x8c, 0x9d, 0x7b, 0x83, 0x94, 0xbb, 0x72, 0xed, 0x9e, 0x79,
+    0x7b, 0xa7, 0xf7, 0x3b, 0x8f, 0x76, 0x45, 0x3a, 0xc3, 0xa3, 0x5d, 0x91, 0x70, 0x81, 0x99, 0x0b,
+    0xf0, 0xe1, 0x87, 0x57, 0xcc, 0x8b, 0xdc, 0x2c, 0x3b, 0xe8, 0x14, 0xf0, 0x3a, 0xd5, 0x72, 0xbe,
+    0xb4, 0x93, 0x85, 0x04, 0xe7, 0xa0, 0x53, 0xf5, 0x7d, 0xac, 0xcd, 0x95, 0xb1, 0x72, 0x3f, 0x0e,
+    0x3b, 0x67, 0x57, 0x97, 0x8c, 0x27, 0x6c, 0x74, 0x80, 0x97, 0x1d, 0xc6, 0xc5, 0x79, 0xd0, 0xb1,
+    0xe1, 0x19, 0x73, 0x3b, 0x1e, 0x27, 0x37, 0x07, 0x1d, 0x0c, 0x78, 0xc7, 0x63, 0x53, 0x37, 0x4c,
+    0x88, 0xb1, 0x47, 0xfa, 0xa8, 0xc3, 0x6e, 0x96, 0x51, 0x8c, 0x48, 0xe4, 0xf9, 0x6a, 0x6f, 0x77,
+    0xf7, 0xfa, 0xfa, 0x5a, 0xbf, 0xb6, 0xf5, 0x24, 0xbd, 0xdc, 0x05, 0x79, 0x18, 0xbb, 0x00, 0xb4,
+    0x53, 0xe6, 0x6a, 0xe8, 0x1e, 0xb0, 0xc5, 0x64, 0x3f, 0xb0, 0x79, 0x18, 0x45, 0x18, 0x20, 0xd9,
+    0x86, 0x6d, 0xba, 0x78, 0xcc, 0x4b, 0x35, 0x56, 0x59, 0x03, 0x06, 0x03, 0x7f, 0x58, 0x53, 0x72,
+    0x66, 0xe5, 0xe6, 0x8b, 0x82, 0x17, 0x08, 0xa8, 0xc3, 0xfc, 0x83, 0xce, 0x4b, 0x7b, 0xaa, 0x5b,
+    0xe6, 0xc0, 0x76, 0x74, 0x73, 0xec, 0xd9, 0xfa, 0x68, 0xac, 0x39, 0xfa, 0x68, 0x38, 0x98, 0xe8,
+    0x96, 0x66, 0x8e, 0x74, 0x08, 0xc4, 0x4d, 0x43, 0x9f, 0x5a, 0x9a, 0x05, 0xce, 0xd6, 0x19, 0xd8,
+    0xfa, 0xc4, 0xd4, 0x46, 0xba, 0x81, 0xf5, 0x8e, 0x05, 0x2d, 0xc7, 0xe3, 0x81, 0x69, 0xe9, 0xb6,
+    0xad, 0x41, 0x2b, 0x67, 0x32, 0x18, 0xea, 0x23, 0xcd, 0x42, 0x70, 0x53, 0x7d, 0x62, 0x6b, 0xb6,
+    0x6e, 0x9b, 0x03, 0x00, 0x32, 0x9e, 0xf0, 0x47, 0x4b, 0x9f, 0x4e, 0xc0, 0xeb, 0x02, 0xd4, 0x91,
+    0x6e, 0x21, 0x08, 0x13, 0xe0, 0x59, 0x57, 0xa6, 0xe3, 0x69, 0xfa, 0x50, 0xd3, 0x8d, 0xa9, 0x86,
+    0x23, 0xe9, 0xe6, 0x44, 0x33, 0x11, 0x0f, 0xdd, 0x82, 0x2f, 0xe3, 0x11, 0x54, 0x8c, 0xa0, 0xc0,
+    0x82, 0x02, 0x03, 0x6b, 0x1c, 0xfe, 0x30, 0xd4, 0x9d, 0xd1, 0xc0, 0x00, 0x14, 0xa6, 0xce, 0x00,
+    0x9a, 0x3b, 0x1a, 0xe0, 0x31, 0x04, 0x04, 0x26, 0xa3, 0x4c, 0x1b, 0xeb, 0x93, 0xf1, 0x00, 0xc8,
+    0x98, 0x22, 0x5a, 0xb0, 0xaa, 0x30, 0xc7, 0xba, 0x35, 0x89, 0x34, 0xd3, 0xd4, 0x87, 0xc3, 0x81,
+    0x05, 0xa4, 0x59, 0x9e, 0x86, 0xa4, 0x42, 0x9b, 0xe1, 0x48, 0x03, 0x3c, 0x1c, 0x44, 0x13, 0xc7,
+    0x05, 0x2a, 0xa0, 0x05, 0xcc, 0x0b, 0x63, 0x68, 0x00, 0xc4, 0x0d, 0xf5, 0xe9, 0x14, 0x1a, 0x4c,
+    0x2c, 0x04, 0x37, 0xc1, 0x31, 0xb0, 0xad, 0x81, 0xd4, 0x0d, 0xf5, 0xe1, 0x18, 0x48, 0x82, 0x96,
+    0x40, 0xec, 0x08, 0x58, 0x63, 0x0d, 0x91, 0x63, 0xce, 0x54, 0x3c, 0xea, 0x63, 0x07, 0xf0, 0x03,
+    0xc2, 0x91, 0x24, 0x68, 0x0d, 0xd4, 0x59, 0x53, 0x8d, 0x50, 0xd5, 0xcd, 0xa9, 0x86, 0xcc, 0x00,
+    0xb2, 0x11, 0x0e, 0x80, 0x40, 0x3e, 0x68, 0xc0, 0x08, 0x53, 0x07, 0x71, 0x10, 0xa3, 0x61, 0xa8,
+    0x91, 0x03, 0xbc, 0x12, 0x1f, 0x06, 0x10, 0x0b, 0x5c, 0xb5, 0x89, 0x35, 0xc8, 0xf3, 0x09, 0xb2,
+    0x60, 0x8c, 0x2d, 0x87, 0x88, 0xab, 0x69, 0x0d, 0xc6, 0x88, 0x15, 0x50, 0x64, 0x41, 0x3b, 0x07,
+    0x51, 0x99, 0x9a, 0x11, 0x91, 0xac, 0x11, 0xc9, 0xbf, 0xec, 0xec, 0xb6, 0x28, 0x81, 0xc5, 0x95,
+    0xc0, 0xb4, 0x80, 0x9c, 0x11, 0x50, 0x06, 0xbd, 0x40, 0x1c, 0xc0, 0x55, 0x13, 0x90, 0x07, 0xbe,
+    0x8d, 0x69, 0x44, 0x53, 0xb3, 0x6c, 0xe4, 0x0f, 0xc8, 0x77, 0x08, 0xdc, 0x1d, 0xa1, 0x6c, 0x0d,
+    0x0b, 0x19, 0x0a, 0x72, 0x9a, 0x20, 0x89, 0x30, 0x9c, 0x41, 0xfc, 0x71, 0xa6, 0xc8, 0x5a, 0x0b,
+    0xb4, 0x04, 0xf8, 0x05, 0xe8, 0x73, 0xa6, 0x4d, 0xc5, 0xe3, 0x14, 0xb5, 0xc4, 0x00, 0x10, 0x8e,
+    0x35, 0x20, 0xb8, 0xd8, 0x03, 0xc5, 0x06, 0x20, 0x4d, 0x07, 0x40, 0x0c, 0x08, 0x30, 0x34, 0xb6,
+    0x51, 0x3f, 0x1c, 0xe0, 0xad, 0x4d, 0xe4, 0x0e, 0x49, 0xc0, 0x36, 0x71, 0x64, 0x4a, 0xa3, 0x0f,
+    0x60, 0x74, 0x7b, 0x4c, 0x28, 0x0d, 0xa0, 0x2b, 0x0c, 0x41, 0x8f, 0x63, 0xdd, 0x1c, 0x02, 0xab,
+    0xa0, 0x72, 0x6c, 0xc3, 0x10, 0xf6, 0x08, 0xa5, 0x3f, 0x74, 0x60, 0x08, 0xc3, 0x1e, 0x90, 0xd2,
+    0x58, 0xfa, 0x78, 0x3a, 0x20, 0xd5, 0x1d, 0x03, 0xb7, 0x07, 0x5c, 0x2b, 0xe0, 0x5f, 0x63, 0x3a,
+    0x40, 0xb6, 0xa2, 0x0e, 0x99, 0x03, 0x94, 0x0a, 0x0a, 0x9a, 0x3a, 0xe1, 0x23, 0x32, 0x06, 0xe1,
+    0xea, 0x16, 0x6a, 0xa4, 0x8d, 0x50, 0x48, 0x11, 0xa1, 0x9a, 0x4a, 0x46, 0x03, 0x21, 0xda, 0x09,
+    0x42, 0x31, 0x35, 0xdd, 0x46, 0x5a, 0x6c, 0x27, 0xd2, 0x86, 0x63, 0x34, 0x18, 0x90, 0xce, 0x04,
+    0xec, 0xcb, 0x9a, 0x0c, 0x38, 0xf1, 0x60, 0x55, 0x53, 0xfc, 0xd7, 0xb2, 0x06, 0xc4, 0x5b, 0xf9,
+    0x4c, 0x0c, 0x02, 0x2a, 0xa7, 0x60, 0x11, 0xb0, 0x16, 0x46, 0xe3, 0x04, 0xed, 0x20, 0xa5, 0x02,
+    0x7d, 0x19, 0xd9, 0x03, 0x84, 0x86, 0xf6, 0x80, 0x2a, 0x09, 0x8c, 0xb7, 0x00, 0xef, 0x2b, 0x20,
+    0x71, 0x34, 0xf6, 0x48, 0xb9, 0xb8, 0x62, 0xa0, 0x96, 0xa2, 0xe4, 0xc1, 0x4c, 0x01, 0x24, 0x70,
+    0x14, 0xb4, 0x19, 0x35, 0x09, 0x0a, 0x0c, 0x32, 0x21, 0x18, 0xcd, 0x84, 0xca, 0xf1, 0x2f, 0x5f,
+    0x9a, 0x48, 0xda, 0x74, 0x30, 0x82, 0xe1, 0x01, 0xc4, 0x10, 0xf9, 0x6d, 0x40, 0xb3, 0x29, 0x0a,
+    0xc8, 0x22, 0x93, 0x18, 0xe3, 0xe8, 0x0e, 0x0e, 0x35, 0x41, 0xe2, 0x40, 0x05, 0x48, 0xf7, 0x91,
+    0x23, 0x1a, 0x69, 0x26, 0xb4, 0xb1, 0x23, 0xcb, 0x41, 0x79, 0x42, 0x7f, 0x30, 0x2e, 0x34, 0x3d,
+    0x52, 0x70, 0x14, 0xa5, 0x3d, 0x82, 0x52, 0xcb, 0x46, 0x3b, 0xb3, 0xd1, 0x3b, 0xa0, 0x46, 0x4d,
+    0xa8, 0xa7, 0xa3, 0x11, 0x17, 0xd1, 0xe1, 0xd0, 0xd3, 0x76, 0x15, 0x1d, 0x4d, 0xc1, 0x1b, 0x0c,
+    0xec, 0xf1, 0xc2, 0x44, 0x25, 0xbf, 0x02, 0xbf, 0x62, 0x79, 0x04, 0x89, 0x1b, 0xbe, 0xc5, 0x07,
+    0x47, 0xcf, 0x85, 0xc0, 0xc1, 0x03, 0xd8, 0xdc, 0x61, 0x0c, 0x91, 0xf9, 0x43, 0x6c, 0xc6, 0x45,
+    0x6a, 0x8d, 0xf8, 0x23, 0xc8, 0xc1, 0x46, 0x89, 0x22, 0x4a, 0xc8, 0xa4, 0x29, 0x6a, 0x8a, 0x39,
+    0x85, 0x72, 0x0b, 0xfb, 0x4e, 0xd1, 0xfa, 0x4d, 0x87, 0x44, 0x81, 0x16, 0x65, 0xf1, 0x27, 0x68,
+    0x33, 0xb5, 0xae, 0x40, 0xa6, 0xce, 0x02, 0xd5, 0xd9, 0x36, 0xaf, 0xb4, 0x21, 0x2a, 0xb8, 0x47,
+    0x5a, 0x6d, 0x6a, 0xb6, 0xf0, 0x23, 0xe0, 0xbc, 0xa6, 0xe0, 0x0d, 0xf9, 0x13, 0xb9, 0x0d, 0x83,
+    0xd8, 0x00, 0x65, 0x63, 0x42, 0x04, 0xb8, 0x95, 0x61, 0x6b, 0xd4, 0x3a, 0xc0, 0xd8, 0xe6, 0x42,
+    0x76, 0x00, 0x36, 0xc8, 0x68, 0x2a, 0x80, 0x7f, 0x65, 0x6f, 0x67, 0x8a, 0x65, 0x83, 0xc2, 0x80,
+    0x1f, 0x1b, 0xa3, 0xd9, 0x02, 0x1f, 0x26, 0xc2, 0x5b, 0xa0, 0xf0, 0x0c, 0x34, 0xa1, 0x31, 0xea,
+    0xa5, 0x8d, 0x62, 0x03, 0xf9, 0x83, 0x37, 0x1f, 0x91, 0x63, 0x81, 0x0a, 0xb0, 0x4f, 0xf2, 0x1d,
+    0x85, 0xb2, 0x0d, 0xb1, 0xf9, 0x10, 0x85, 0x63, 0x67, 0x24, 0x25, 0xd4, 0x9b, 0x01, 0x3d, 0x61,
+    0x3b, 0xa0, 0xcf, 0xd4, 0x4d, 0xd0, 0x74, 0xf2, 0xf0, 0xe8, 0x91, 0x87, 0x53, 0x72, 0xeb, 0x1a,
+    0xba, 0x48, 0x13, 0x9d, 0x34, 0xea, 0x2e, 0xfc, 0x03, 0xf2, 0x06, 0xd9, 0x0c, 0xa1, 0xd2, 0x99,
+    0x46, 0xa8, 0x81, 0x13, 0xd2, 0x17, 0x74, 0xb9, 0x93, 0x31, 0xb2, 0xc2, 0x04, 0x0e, 0x8c, 0x1d,
+    0x0d, 0x7d, 0x35, 0xc8, 0x7e, 0x32, 0x26, 0x6d, 0x23, 0x5e, 0x58, 0xd2, 0xb9, 0xc0, 0x13, 0x1a,
+    0x9f, 0x03, 0xa3, 0x02, 0x76, 0x68, 0xb3, 0x23, 0x2a, 0x99, 0x10, 0xea, 0xc0, 0x60, 0x80, 0x48,
+    0x5e, 0x11, 0x15, 0x7b, 0x84, 0x32, 0x34, 0x6c, 0x68, 0x39, 0x9c, 0xa0, 0xf3, 0x06, 0x6a, 0xf8,
+    0x23, 0xcc, 0x3c, 0x72, 0xbe, 0x31, 0xd1, 0x5c, 0x0c, 0x0b, 0xb5, 0x1b, 0x8b, 0x71, 0xfe, 0x01,
+    0x97, 0x0c, 0x78, 0x72, 0x35, 0x00, 0xfc, 0x9d, 0x2b, 0xf4, 0xde, 0x43, 0x0f, 0x35, 0x11, 0x3d,
+    0x33, 0xd7, 0x6d, 0x0d, 0x65, 0x4a, 0x9a, 0x8b, 0x93, 0x36, 0xf2, 0x84, 0xbb, 0x6f, 0xee, 0xb5,
+    0xc1, 0x15, 0x8d, 0xd1, 0xd9, 0x73, 0x9f, 0x64, 0xa3, 0x6b, 0x03, 0xcd, 0x03, 0x35, 0x74, 0xa8,
+    0xcf, 0x80, 0x38, 0x46, 0x3e, 0x7d, 0x32, 0xa1, 0xbe, 0x50, 0x32, 0xb1, 0xf9, 0x13, 0x70, 0x0b,
+    0x1d, 0x0a, 0xd4, 0xa0, 0xd6, 0x82, 0x3a, 0x0c, 0x51, 0xe5, 0x00, 0x43, 0xe0, 0x1d, 0x1a, 0x9a,
+    0x89, 0x3e, 0xd8, 0xe4, 0x2e, 0x7e, 0x42, 0xae, 0x69, 0x18, 0x4d, 0xf8, 0x24, 0x0b, 0xcc, 0xa4,
+    0x49, 0x7b, 0x44, 0x76, 0x0e, 0x7c, 0x36, 0xd1, 0x7f, 0x01, 0x9b, 0xf8, 0x33, 0xce, 0xd5, 0x00,
+    0x19, 0x98, 0x8c, 0x9a, 0x37, 0xc2, 0xba, 0x09, 0xba, 0x82, 0xd1, 0x80, 0x66, 0x74, 0x0d, 0x05,
+    0x3f, 0x46, 0x77, 0x0a, 0xa6, 0x0b, 0x8c, 0xd2, 0x2c, 0x13, 0x15, 0x12, 0x9f, 0xd0, 0x62, 0xc8,
+    0x3d, 0x03, 0xa9, 0xe0, 0x47, 0x41, 0x3a, 0x0e, 0x69, 0x06, 0x8a, 0xd6, 0x22, 0x2a, 0x01, 0x00,
+    0x30, 0x07, 0x00, 0xa3, 0x6a, 0x11, 0x4f, 0xae, 0x70, 0x9a, 0x98, 0x6c, 0xd5, 0x52, 0x1b, 0xf0,
+    0x22, 0xec, 0xe0, 0xc3, 0x5a, 0xe0, 0x78, 0xf6, 0x34, 0xa2, 0x7f, 0xb5, 0xa1, 0x81, 0x5e, 0xde,
+    0x36, 0x89, 0xdf, 0x30, 0xd1, 0x0e, 0x17, 0x16, 0x50, 0x6a, 0x45, 0xa0, 0xfd, 0x80, 0x93, 0xed,
+    0x90, 0x2a, 0x3b, 0xe8, 0x50, 0xe9, 0x79, 0x01, 0xbd, 0xac, 0x61, 0xa4, 0x81, 0xb7, 0x02, 0x65,
+    0x9e, 0xa2, 0xe2, 0x6c, 0x1f, 0x79, 0x0a, 0x93, 0x02, 0xfa, 0x59, 0xa0, 0xb8, 0x34, 0xd8, 0x11,
+    0x70, 0x7b, 0xb4, 0xd0, 0xd0, 0x9f, 0x10, 0xf6, 0xa6, 0xbd, 0x10, 0xcf, 0x60, 0xa1, 0xe3, 0x08,
+    0x67, 0x13, 0xb4, 0x5e, 0x63, 0xb2, 0x00, 0xce, 0x4c, 0xaf, 0xc0, 0x68, 0x6d, 0x7b, 0x41, 0xb1,
+    0xc1, 0x15, 0x6f, 0xcd, 0x03, 0x85, 0x2b, 0x82, 0xb3, 0x75, 0xfc, 0xa1, 0x49, 0x53, 0x99, 0xb1,
+    0xe0, 0x23, 0x03, 0xb5, 0x20, 0x3b, 0xe1, 0xb4, 0x4c, 0x9a, 0x65, 0x50, 0xdb, 0x41, 0xda, 0x13,
+    0xd4, 0xb5, 0x21, 0x06, 0x48, 0x16, 0x06, 0x41, 0x40, 0x25, 0xce, 0x64, 0x26, 0xc6, 0x3b, 0xe0,
+    0x7c, 0x30, 0xbc, 0x81, 0x87, 0x3f, 0x08, 0x8f, 0x65, 0x6c, 0x67, 0xc8, 0xd4, 0xc0, 0x40, 0x03,
+    0x54, 0x74, 0x34, 0xf5, 0x34, 0xe1, 0x67, 0x4c, 0x44, 0xc2, 0xc6, 0x69, 0xc5, 0xe1, 0x0f, 0x20,
+    0xea, 0x71, 0x66, 0x72, 0x4f, 0x41, 0x31, 0x01, 0x95, 0x99, 0x43, 0x4f, 0x3a, 0x26, 0x54, 0x57,
+    0x03, 0xc3, 0x4a, 0x73, 0x40, 0xb3, 0x07, 0x3c, 0x64, 0x63, 0x0a, 0x37, 0xd1, 0xed, 0x51, 0x04,
+    0x0b, 0x45, 0x9e, 0x64, 0x14, 0x07, 0x81, 0x33, 0xbb, 0xc3, 0x9f, 0x10, 0x58, 0x86, 0x0e, 0x0d,
+    0x8d, 0x68, 0x3a, 0xd2, 0x44, 0xa1, 0x31, 0xe6, 0x38, 0x0d, 0x08, 0xa7, 0x11, 0xef, 0x08, 0xdc,
+    0x91, 0x00, 0x27, 0x18, 0x5b, 0xda, 0x28, 0x15, 0x43, 0x4c, 0x5b, 0x58, 0xf8, 0xcb, 0x97, 0x43,
+    0x07, 0x48, 0xb7, 0x69, 0x6e, 0x22, 0x06, 0x83, 0x83, 0x29, 0xd4, 0xed, 0x2e, 0x17, 0x3e, 0xb2,
+    0x48, 0xec, 0xff, 0x7f, 0x5e, 0x53, 0x99, 0xc2, 0xd7, 0x48, 0x64, 0xb7, 0xd3, 0x89, 0x67, 0x0c,
+    0x28, 0x5c, 0x41, 0xa8, 0x80, 0xe8, 0x04, 0xe3, 0x8e, 0x29, 0xce, 0x57, 0x30, 0x2a, 0x86, 0xa3,
+    0xd6, 0x14, 0x9d, 0x17, 0x5f, 0xaf, 0x58, 0x24, 0x5a, 0x8c, 0x78, 0x4d, 0xfe, 0x84, 0x9c, 0xa4,
+    0x38, 0xdc, 0x41, 0x97, 0x86, 0x13, 0x0c, 0xae, 0x33, 0x6c, 0x9c, 0x88, 0x00, 0x3b, 0x74, 0xde,
+    0xe0, 0x4f, 0x4d, 0x8c, 0xac, 0x50, 0xb4, 0x50, 0x85, 0xc1, 0x11, 0x8e, 0x80, 0x3a, 0x07, 0xf0,
+    0xc1, 0xdb, 0xf1, 0xf9, 0x4b, 0xa3, 0x39, 0x02, 0xdd, 0xc5, 0x74, 0x0a, 0x8a, 0x05, 0xce, 0x0a,
+    0x66, 0x17, 0xb0, 0x6e, 0x9c, 0x60, 0xf9, 0xe4, 0x42, 0x11, 0x20, 0xc5, 0x90, 0x3c, 0x50, 0x05,
+    0x7c, 0xe0, 0x3b, 0x2d, 0x73, 0xe0, 0xd3, 0x14, 0xd3, 0x11, 0xd0, 0x6f, 0x98, 0x3c, 0x82, 0xe2,
+    0x8f, 0x50, 0x6d, 0x4f, 0xaf, 0x70, 0x09, 0xe0, 0x51, 0xd0, 0x84, 0xd3, 0x0f, 0xce, 0x22, 0x03,
+    0x9a, 0x71, 0x1c, 0x3e, 0x3b, 0x60, 0x3b, 0xb1, 0xa4, 0xe0, 0x33, 0x9c, 0x2d, 0xc8, 0x84, 0x89,
+    0x05, 0x79, 0x81, 0x42, 0xb2, 0x89, 0x17, 0x1a, 0x57, 0x05, 0x70, 0x65, 0x40, 0xb1, 0x50, 0x8b,
+    0x11, 0x2e, 0x1a, 0x30, 0xaa, 0x03, 0x56, 0x99, 0xd8, 0x10, 0xc6, 0x84, 0xf0, 0x78, 0x84, 0x82,
+    0x44, 0x1c, 0x70, 0x42, 0x18, 0xa3, 0x6f, 0x77, 0x06, 0xe4, 0xf2, 0xa7, 0x18, 0x68, 0x22, 0xfa,
+    0x16, 0x2d, 0xab, 0x50, 0xa7, 0xc6, 0xa8, 0x68, 0x53, 0x28, 0xa5, 0x58, 0x7d, 0x88, 0x91, 0x33,
+    0x0a, 0x7d, 0xc8, 0x1f, 0x45, 0x24, 0x01, 0x12, 0x76, 0x44, 0x2c, 0xeb, 0x0c, 0x29, 0xc0, 0x98,
+    0x8c, 0xd1, 0xb2, 0x30, 0x94, 0x47, 0x3d, 0x20, 0x74, 0x28, 0x20, 0xe1, 0x26, 0xf2, 0xcb, 0x97,
+    0x63, 0x7b, 0x82, 0x33, 0x39, 0x3a, 0x52, 0x0f, 0xd7, 0x6d, 0x36, 0x2e, 0x3b, 0x2c, 0x3e, 0x77,
+    0x82, 0xd3, 0xe7, 0x9a, 0x3b, 0x42, 0x6b, 0x1c, 0xa2, 0xd5, 0xdb, 0x28, 0x2b, 0x14, 0x21, 0x80,
+    0x9c, 0x0e, 0xf9, 0x13, 0xd2, 0x62, 0x66, 0x38, 0xb1, 0x82, 0x3a, 0x4f, 0x31, 0x2c, 0xb0, 0xb0,
+    0xcc, 0xf4, 0x08, 0x29, 0x8a, 0xad, 0x09, 0x29, 0x8c, 0x37, 0x10, 0x7d, 0xf2, 0xbb, 0x13, 0x8a,
+    0x29, 0x28, 0x3c, 0xd0, 0x90, 0x6c, 0xb2, 0x2e, 0x9c, 0xae, 0xaf, 0x34, 0x8c, 0x16, 0x86, 0x18,
+    0x4c, 0x03, 0x2f, 0xf9, 0x4a, 0x6d, 0xc2, 0xe7, 0xbe, 0x21, 0x45, 0x3b, 0xd6, 0x94, 0x6b, 0x2e,
+    0xae, 0xcd, 0xf1, 0xc3, 0x0f, 0xaf, 0xaa, 0xfb, 0x09, 0x7c, 0x87, 0xaa, 0xd3, 0x56, 0x48, 0x3b,
+    0x08, 0xed, 0x35, 0x7e, 0x92, 0x77, 0x58, 0x08, 0xba, 0x7f, 0x9d, 0x9d, 0x0b, 0x00, 0x12, 0x76,
+    0xb6, 0x72, 0x63, 0x51, 0x75, 0x11, 0xdc, 0xe4, 0x9d, 0xc3, 0xe3, 0x24, 0x8e, 0x71, 0xc3, 0x2a,
+    0xbe, 0xd4, 0x75, 0x1d, 0x10, 0x81, 0xfa, 0x2d, 0x98, 0xc8, 0x41, 0x7f, 0xff, 0xbb, 0xbf, 0xff,
+    0x6b, 0x56, 0x02, 0xcb, 0xdc, 0xe5, 0x2a, 0x0a, 0x8e, 0x93, 0x75, 0x0c, 0x10, 0x0d, 0x01, 0x85,
+    0xf1, 0xd2, 0xac, 0x80, 0x56, 0xfd, 0x50, 0x60, 0x8b, 0x5c, 0xd0, 0x8e, 0xc4, 0xaf, 0x5a, 0xcc,
+    0xcf, 0x45, 0x3b, 0x87, 0x3f, 0xfd, 0xe3, 0x7f, 0xf9, 0xbf, 0xff, 0xf2, 0x23, 0x6d, 0xbe, 0xa7,
+    0x49, 0x94, 0x15, 0xb8, 0x36, 0x01, 0xc9, 0x0c, 0xea, 0x92, 0xec, 0x96, 0x36, 0x94, 0x24, 0x8d,
+    0x43, 0xf2, 0xc3, 0xc0, 0x7a, 0x35, 0x9e, 0xf5, 0x55, 0x73, 0x54, 0x3b, 0x2c, 0x89, 0xbd, 0x28,
+    0xf4, 0xde, 0x01, 0xbd, 0x41, 0xec, 0x1f, 0x27, 0xcb, 0xa5, 0x1b, 0xfb, 0xbd, 0x2e, 0xa5, 0x1f,
+    0xfe, 0xca, 0x8d, 0xa2, 0x6e, 0x1f, 0x90, 0xfc, 0xcf, 0xff, 0x03, 0x91, 0x3c, 0xc7, 0xb2, 0x47,
+    0xbb, 0x1c, 0xf4, 0x67, 0x19, 0x23, 0x59, 0x15, 0x43, 0xfc, 0xf8, 0x3f, 0xf9, 0x10, 0xc9, 0x4a,
+    0x19, 0x61, 0x33, 0xa1, 0x1f, 0xc4, 0x0c, 0x7e, 0x06, 0x2d, 0x36, 0xae, 0xea, 0xdb, 0xb7, 0xac,
+    0xcc, 0x56, 0xe8, 0x1c, 0x9e, 0x93, 0x74, 0xd9, 0x6b, 0x37, 0x0f, 0xf6, 0x1e, 0xed, 0x52, 0x3f,
+    0x94, 0x1f, 0x3f, 0x40, 0xae, 0x81, 0xe7, 0xa5, 0x1d, 0x45, 0x57, 0xb0, 0x1b, 0x11, 0xbb, 0xc0,
+    0x43, 0x3b, 0xa4, 0x36, 0x3f, 0x2f, 0x2a, 0x7a, 0x7d, 0x44, 0x25, 0x59, 0xd1, 0x36, 0x2a, 0xed,
+    0xa2, 0x1f, 0x74, 0x4c, 0xc3, 0xe8, 0x1c, 0x9a, 0x06, 0x7b, 0xfe, 0xfd, 0xa3, 0x5d, 0x5e, 0xd3,
+    0x68, 0x32, 0x82, 0x16, 0xd6, 0xd6, 0x16, 0x16, 0xb4, 0x18, 0x6d, 0x6d, 0x61, 0xd2, 0x28, 0x77,
+    0x00, 0x41, 0x28, 0xdb, 0x11, 0x41, 0x4c, 0xb6, 0x0f, 0x43, 0xe4, 0x54, 0x9b, 0xec, 0x72, 0x36,
+    0xfd, 0x5b, 0x08, 0xf3, 0x6b, 0xca, 0x89, 0x66, 0xe7, 0x58, 0x5d, 0x0a, 0x53, 0x81, 0x5d, 0x4d,
+    0xbb, 0xfe, 0x48, 0xb3, 0xf1, 0x03, 0x2f, 0xc5, 0xcc, 0x33, 0x3e, 0x1a, 0x0e, 0x86, 0x92, 0xfe,
+    0xe9, 0xaf, 0x7e, 0xa3, 0xe8, 0x71, 0x73, 0x4c, 0x62, 0x99, 0xf0, 0x67, 0x54, 0xf2, 0x15, 0x15,
+    0x80, 0x20, 0x0d, 0xc9, 0x84, 0x8f, 0xc0, 0x25, 0x8c, 0xdb, 0x70, 0x79, 0xd8, 0xb4, 0xa8, 0xbb,
+    0x35, 0x9a, 0x63, 0x75, 0x96, 0x06, 0xa0, 0xc4, 0x35, 0x9d, 0xfe, 0x5a, 0xa9, 0x6a, 0xd3, 0xea,
+    0xce, 0x21, 0xaf, 0xcb, 0xb6, 0x69, 0x0a, 0xd7, 0xc8, 0xd5, 0x96, 0x46, 0x16, 0xa9, 0xfe, 0x68,
+    0x7b, 0x23, 0xd2, 0xca, 0xd1, 0x1d, 0x90, 0x84, 0x62, 0x1a, 0x77, 0x0d, 0x48, 0xcd, 0xac, 0x66,
+    0xb3, 0xcf, 0xae, 0xc3, 0xf7, 0x17, 0x2d, 0x8a, 0x62, 0xe5, 0xae, 0xb3, 0xe0, 0x71, 0x1e, 0x2b,
+    0x82, 0xe6, 0xb9, 0x4e, 0x67, 0x58, 0x41, 0xda, 0xf6, 0xe3, 0xbf, 0xa0, 0xf7, 0xa4, 0xef, 0x9f,
+    0xe6, 0xa0, 0xbd, 0x28, 0x70, 0xd3, 0x63, 0x3c, 0x70, 0x41, 0xb8, 0xbf, 0xff, 0xdd, 0x3f, 0xfc,
+    0x27, 0x9a, 0x9e, 0xb0, 0xb4, 0xa9, 0x45, 0x4d, 0x4a, 0x6b, 0x39, 0xc6, 0xb5, 0x99, 0xbc, 0x92,
+    0xc9, 0xde, 0x5a, 0x57, 0x39, 0x82, 0xf0, 0x78, 0xd2, 0x3e, 0xb2, 0x40, 0x49, 0xe2, 0x47, 0x0e,
+    0xf3, 0x9a, 0x6d, 0x88, 0x28, 0x99, 0xbb, 0xb5, 0x81, 0x8a, 0x9c, 0xdb, 0x8e, 0x84, 0x0c, 0xb1,
+    0x42, 0x44, 0xe6, 0x97, 0xb5, 0x4a, 0x4f, 0xcd, 0x4d, 0xec, 0xb4, 0x56, 0x89, 0x03, 0x92, 0xba,
+    0x78, 0x8e, 0xa9, 0xf6, 0x0c, 0xfb, 0x71, 0x33, 0x59, 0xd8, 0xca, 0x7c, 0x0f, 0x55, 0xeb, 0x94,
+    0xee, 0xb6, 0x3d, 0xda, 0x85, 0x8a, 0x6a, 0x94, 0x50, 0x49, 0x69, 0x13, 0x88, 0x52, 0xd1, 0x05,
+    0x2f, 0x81, 0x29, 0xf9, 0x7f, 0x6d, 0x89, 0x6b, 0xaa, 0xe9, 0x60, 0x6a, 0xff, 0x63, 0x51, 0xd4,
+    0xda, 0xbe, 0x25, 0xf8, 0x52, 0xb3, 0xb8, 0x50, 0x1f, 0xfe, 0xe6, 0xef, 0xd8, 0xab, 0x20, 0xbf,
+    0x4e, 0xd2, 0x77, 0xed, 0xae, 0xa4, 0x92, 0xfa, 0x24, 0x3d, 0xc9, 0x3c, 0x3c, 0x3f, 0x3f, 0x79,
+    0xa2, 0x7a, 0x91, 0xf5, 0xca, 0x87, 0x29, 0xf1, 0x0c, 0xba, 0x00, 0x28, 0xbf, 0xdd, 0x89, 0x68,
+    0x1a, 0x3b, 0xe7, 0xb0, 0xc5, 0x88, 0x4c, 0xd3, 0x5a, 0x8d, 0xb2, 0xaa, 0xe6, 0xa8, 0xde, 0xcd,
+    0xb8, 0x03, 0x34, 0x46, 0x40, 0xc9, 0x7a, 0xc1, 0x15, 0x70, 0x80, 0xb4, 0xfb, 0xb7, 0x7f, 0xcb,
+    0xce, 0xa1, 0x66, 0x6b, 0xc4, 0x71, 0x7f, 0xde, 0xfc, 0xf6, 0xef, 0x98, 0xa4, 0x48, 0xc2, 0xa1,
+    0xbc, 0x30, 0x96, 0xdf, 0xae, 0x02, 0x34, 0x63, 0x5e, 0xd7, 0xa9, 0x43, 0xc6, 0x36, 0x25, 0xab,
+    0xce, 0x8a, 0x66, 0xab, 0xc8, 0xf5, 0x82, 0x45, 0x12, 0x81, 0x6e, 0x1d, 0x74, 0x24, 0x0f, 0x0a,
+    0x28, 0xad, 0xb8, 0x88, 0x1c, 0xb0, 0xce, 0x66, 0xae, 0x88, 0xec, 0x99, 0xa6, 0xe1, 0xf3, 0x90,
+    0xf9, 0xeb, 0xf0, 0x59, 0x88, 0xe2, 0x10, 0x11, 0xf4, 0x46, 0x67, 0x22, 0xe1, 0x89, 0x1c, 0xa6,
+    0x06, 0xb8, 0x79, 0x92, 0x5e, 0x06, 0xb9, 0x40, 0x1a, 0x01, 0x3e, 0xa3, 0x82, 0x76, 0x4e, 0x17,
+    0x5a, 0xc2, 0xe3, 0x7a, 0x39, 0xb9, 0xab, 0xe7, 0xea, 0x78, 0xac, 0xcc, 0xea, 0xb3, 0x7d, 0x69,
+    0xae, 0x9f, 0x22, 0x36, 0x08, 0xfa, 0xcf, 0x9f, 0xb0, 0x17, 0x60, 0x58, 0xb0, 0x5e, 0xd8, 0x0c,
+    0xe9, 0xe3, 0x59, 0x5b, 0x09, 0x7a, 0x83, 0x18, 0xd3, 0xcf, 0x7e, 0x95, 0xf9, 0x18, 0xf5, 0x3e,
+    0xa5, 0x2f, 0x1f, 0xcd, 0xe4, 0x0a, 0x60, 0x91, 0xd8, 0x26, 0x20, 0x3f, 0xe1, 0xdf, 0xee, 0xe9,
+    0xb3, 0xef, 0xcb, 0xa9, 0xff, 0xca, 0x50, 0x3f, 0xd8, 0xcb, 0xc4, 0x0f, 0x9a, 0x6b, 0x2f, 0x10,
+    0x20, 0x56, 0x74, 0x6a, 0x8b, 0x2b, 0x9e, 0x22, 0x56, 0xe6, 0x52, 0x75, 0x0e, 0x5f, 0x24, 0xae,
+    0x7f, 0xe7, 0xd2, 0xec, 0x03, 0xb0, 0xfa, 0x5b, 0x5c, 0x99, 0x90, 0xef, 0xe0, 0x0a, 0xd4, 0x40,
+    0x0d, 0x30, 0x91, 0xaa, 0xb5, 0x19, 0x37, 0x91, 0x6c, 0x41, 0xac, 0x13, 0xc6, 0x10, 0xf8, 0x95,
+    0xf5, 0x98, 0x00, 0x75, 0x72, 0xd6, 0xa9, 0x84, 0x9f, 0xf2, 0xda, 0xff, 0x32, 0x89, 0x13, 0xca,
+    0x4b, 0x6c, 0x2a, 0x2a, 0x53, 0x55, 0x19, 0x53, 0x27, 0x99, 0x9a, 0xc5, 0x85, 0xae, 0xee, 0x73,
+    0x88, 0xe7, 0xc7, 0x7f, 0x66, 0x47, 0x67, 0xec, 0xe4, 0xac, 0x6e, 0x5a, 0xee, 0xea, 0x63, 0x50,
+    0xde, 0x84, 0x61, 0xc1, 0x09, 0xf7, 0x2a, 0xf0, 0x8f, 0xd3, 0xc0, 0xcf, 0x4e, 0x50, 0xaa, 0x6d,
+    0x46, 0xeb, 0xd4, 0x8d, 0xd6, 0x6c, 0x02, 0x6e, 0x5f, 0x47, 0xdf, 0xb5, 0xb8, 0xe6, 0x59, 0x76,
+    0xc8, 0x8f, 0x15, 0x04, 0x9b, 0x49, 0x9e, 0x60, 0xca, 0x41, 0xea, 0x46, 0xec, 0x29, 0xce, 0x09,
+    0x69, 0x12, 0x87, 0x5e, 0xc6, 0xfe, 0xcf, 0x7f, 0x63, 0x96, 0x61, 0x8d, 0xd8, 0xaf, 0xd9, 0xd7,
+    0xc1, 0xec, 0x3c, 0xf1, 0xde, 0x05, 0xf9, 0x1e, 0x53, 0x37, 0x0b, 0xde, 0xa4, 0x11, 0x22, 0x40,
+    0x22, 0x7e, 0xb4, 0xbb, 0x6a, 0x0c, 0x28, 0xf3, 0x29, 0xa8, 0x79, 0x72, 0x53, 0xbc, 0x23, 0xa2,
+    0xa3, 0xb0, 0x21, 0xb9, 0xe1, 0xf9, 0x73, 0xe7, 0xad, 0x51, 0x4d, 0x4b, 0xb2, 0xc6, 0x86, 0x16,
+    0x94, 0x9a, 0xb5, 0xa9, 0x4e, 0x88, 0xf8, 0x79, 0x80, 0x89, 0x30, 0xb8, 0x98, 0x6c, 0x61, 0x49,
+    0x35, 0x43, 0xab, 0x23, 0x90, 0x7b, 0xfe, 0x9a, 0x26, 0xd2, 0x6d, 0xed, 0x31, 0xd9, 0xaa, 0x73,
+    0xf8, 0xf8, 0xec, 0xe5, 0xb6, 0x46, 0x22, 0x9d, 0xaa, 0x9e, 0xd6, 0x54, 0x0e, 0x23, 0xf7, 0x64,
+    0x7e, 0xfa, 0xa7, 0xbf, 0x67, 0xaf, 0xa8, 0x6e, 0xb3, 0xf4, 0x3e, 0x84, 0xe6, 0xf3, 0xd5, 0xe9,
+    0x4f, 0x7f, 0xf1, 0x17, 0xf7, 0xa6, 0xf7, 0xfc, 0xec, 0xd4, 0xba, 0x27, 0xc5, 0x5f, 0x7e, 0x02,
+    0xbd, 0x38, 0xcc, 0x9d, 0x14, 0xb7, 0x82, 0x57, 0x92, 0xa9, 0x78, 0x48, 0x58, 0x35, 0x1c, 0x9e,
+    0xf4, 0x2d, 0x72, 0xe2, 0x98, 0x9a, 0x40, 0x47, 0xae, 0xee, 0xaf, 0x28, 0x3f, 0xeb, 0x6b, 0x30,
+    0x3d, 0xcc, 0x8a, 0xcf, 0x44, 0xe4, 0xa8, 0x04, 0xca, 0xc9, 0xcd, 0xb1, 0x12, 0x2a, 0x4b, 0xd8,
+    0xea, 0xad, 0x57, 0x26, 0xd3, 0xa8, 0x6c, 0xba, 0x7a, 0xb0, 0x25, 0x9c, 0xde, 0x95, 0xfa, 0x5f,
+    0x37, 0x05, 0xcf, 0x5d, 0xb5, 0xda, 0x02, 0x94, 0x1f, 0xf3, 0x70, 0x5a, 0x35, 0x87, 0x0f, 0x24,
+    0xf1, 0xaf, 0x99, 0x80, 0xc1, 0x9e, 0xb8, 0xb9, 0x2b, 0x28, 0x54, 0xbd, 0x9e, 0xcc, 0x94, 0xaa,
+    0x07, 0xf2, 0xc5, 0xe0, 0x32, 0x96, 0xdf, 0x46, 0x4f, 0xe6, 0xa5, 0xe1, 0x0a, 0x82, 0xc7, 0x28,
+    0x80, 0xd0, 0x95, 0xb3, 0xef, 0x80, 0xc5, 0xeb, 0x28, 0xda, 0xe7, 0x45, 0xf9, 0x4d, 0xe5, 0xfb,
+    0xd2, 0xbd, 0x41, 0x6c, 0xce, 0x30, 0x8b, 0x1d, 0x5b, 0x8e, 0xc4, 0xb5, 0x2c, 0x46, 0x6b, 0x33,
+    0x1f, 0x4a, 0xe6, 0x60, 0xe4, 0xfc, 0x6e, 0x02, 0x53, 0x36, 0x0e, 0xa1, 0x42, 0x34, 0x14, 0xeb,
+    0x0c, 0x84, 0x02, 0x85, 0x6f, 0xbf, 0xab, 0x94, 0xca, 0xb6, 0x43, 0xcc, 0xcb, 0x8b, 0xb3, 0x9c,
+    0x73, 0x05, 0x07, 0x7a, 0xdb, 0x15, 0x89, 0xf5, 0xdd, 0x01, 0xeb, 0x8a, 0xdc, 0x70, 0x7a, 0xe4,
+    0x79, 0xe7, 0xf4, 0x18, 0xf8, 0xce, 0xd4, 0x1e, 0x77, 0xbf, 0xc3, 0xd4, 0xc4, 0x94, 0xf5, 0x10,
+    0x6e, 0x48, 0x03, 0xc3, 0xc7, 0x23, 0x80, 0xc9, 0xc2, 0x87, 0x0f, 0x31, 0xc9, 0x4c, 0x41, 0x41,
+    0x5f, 0xad, 0xb3, 0x45, 0xef, 0xed, 0x77, 0x94, 0x9a, 0x36, 0x5f, 0xc7, 0x3c, 0xb9, 0x0f, 0x5f,
+    0xab, 0xc1, 0x35, 0xe7, 0x68, 0x0e, 0xee, 0xf5, 0xc9, 0xe9, 0xcb, 0xd7, 0xb0, 0xb2, 0xb9, 0xed,
+    0x51, 0x67, 0xc9, 0x24, 0x3f, 0xf1, 0xd6, 0x98, 0x5b, 0xa7, 0x43, 0x38, 0x07, 0xde, 0x16, 0x1f,
+    0x1f, 0xdf, 0x9e, 0x40, 0x00, 0xa2, 0xac, 0xd1, 0xba, 0x00, 0x37, 0x9c, 0xb3, 0xde, 0x17, 0xbc,
+    0x17, 0xf5, 0x07, 0xba, 0x92, 0x28, 0xd0, 0x83, 0x34, 0x4d, 0xd2, 0x5e, 0x57, 0x5c, 0xc8, 0x0e,
+    0x38, 0x00, 0x4c, 0xb8, 0x87, 0x89, 0x62, 0x1d, 0xfb, 0x5f, 0x60, 0xd7, 0x34, 0xc8, 0xd7, 0x69,
+    0x2c, 0x59, 0xfa, 0x7e, 0x87, 0x4b, 0x83, 0xc3, 0xc2, 0x61, 0x69, 0x11, 0x73, 0x93, 0xf7, 0xba,
+    0x96, 0xcf, 0x9b, 0xe3, 0xf4, 0xc2, 0x21, 0xf6, 0xca, 0xee, 0x79, 0xba, 0x0e, 0x2a, 0xe4, 0x55,
+    0xdb, 0x01, 0x4e, 0x15, 0x14, 0x79, 0xaf, 0x7d, 0x41, 0xa8, 0x4e, 0x26, 0x53, 0x8e, 0x0a, 0x11,
+    0x17, 0xe0, 0xf9, 0x35, 0x16, 0x16, 0x4d, 0xc4, 0x95, 0x9c, 0x5a, 0x9b, 0xe7, 0x54, 0xba, 0xbf,
+    0xe3, 0xa7, 0xee, 0xb5, 0x58, 0x48, 0x23, 0x16, 0x7c, 0x3f, 0x45, 0x77, 0x7d, 0xff, 0x29, 0x2e,
+    0x3f, 0x5e, 0x84, 0x19, 0xac, 0xc3, 0x02, 0xe0, 0x04, 0xc7, 0x0a, 0x04, 0xa9, 0xa2, 0x07, 0x5d,
+    0x14, 0xa9, 0x34, 0x37, 0x75, 0x04, 0x43, 0x41, 0xd7, 0xf2, 0x60, 0x05, 0x18, 0x54, 0xf5, 0xf3,
+    0xf0, 0x80, 0x2e, 0x16, 0xb1, 0x3f, 0x42, 0x3d, 0x65, 0x7b, 0x94, 0x72, 0x58, 0xad, 0x1e, 0x51,
+    0x2d, 0x6e, 0xae, 0x90, 0x57, 0x80, 0xe1, 0x8a, 0x7d, 0x1d, 0x1a, 0xa0, 0xda, 0xe1, 0x21, 0x0d,
+    0x53, 0xd5, 0x95, 0xb6, 0x6d, 0xaf, 0x3b, 0xb0, 0xda, 0x8e, 0x54, 0x0b, 0x4e, 0x28, 0x9f, 0x6a,
+    0x2b, 0x8d, 0x83, 0x26, 0x0a, 0x70, 0xb8, 0x6d, 0x58, 0x6b, 0x25, 0xd6, 0x0a, 0xde, 0xd5, 0x1e,
+    0xc8, 0xf1, 0x12, 0xed, 0x65, 0x18, 0x63, 0x29, 0xd9, 0xb7, 0xb4, 0x44, 0x80, 0x59, 0x94, 0xa1,
+    0xd1, 0x67, 0xfc, 0xcb, 0x4b, 0x37, 0x5f, 0xe8, 0x98, 0xd4, 0x2e, 0xfa, 0x0c, 0x44, 0x49, 0x18,
+    0xf7, 0x44, 0x8f, 0x01, 0x23, 0xe0, 0x7d, 0xba, 0xf0, 0x55, 0x71, 0x1e, 0x58, 0x0e, 0xfa, 0xb1,
+    0xc9, 0x8e, 0x94, 0xfd, 0xc0, 0x6e, 0x5f, 0x47, 0x45, 0x17, 0x8b, 0xf6, 0xfb, 0x76, 0xe5, 0xbb,
+    0x6f, 0xd0, 0x97, 0xe7, 0x6a, 0x1f, 0xb0, 0x6e, 0x77, 0xbf, 0x62, 0xfc, 0xe0, 0x26, 0x9e, 0xba,
+    0xde, 0xa2, 0x27, 0xca, 0xd8, 0xc1, 0xa1, 0x30, 0x06, 0x51, 0xa0, 0x47, 0x41, 0x7c, 0x09, 0xda,
+    0x7f, 0x58, 0x95, 0xa0, 0xe2, 0x43, 0xf4, 0x6c, 0x05, 0x4b, 0x90, 0xa0, 0x67, 0x0c, 0x58, 0xad,
+    0x8f, 0x56, 0xeb, 0x43, 0xec, 0xef, 0x37, 0xcc, 0xa1, 0x29, 0x0f, 0xb9, 0x9f, 0x58, 0x48, 0x63,
+    0x45, 0x05, 0xdb, 0x3c, 0x4e, 0x1b, 0xb9, 0x5c, 0x6b, 0x78, 0xdf, 0xa6, 0x86, 0xac, 0xf0, 0xfd,
+    0x62, 0x27, 0x71, 0x2e, 0x1b, 0xd4, 0xb5, 0xa3, 0x65, 0xe3, 0xa6, 0xc0, 0xc7, 0x2b, 0xa4, 0xb0,
+    0xd9, 0x05, 0xaa, 0x7b, 0x2c, 0xe8, 0x9a, 0x78, 0x4f, 0x71, 0xb3, 0xf1, 0xce, 0x8e, 0x7c, 0x73,
+    0x47, 0xf4, 0xa3, 0x8b, 0x7c, 0x34, 0xe7, 0xa1, 0xaf, 0xd0, 0x39, 0x8c, 0x5e, 0x97, 0x5f, 0xed,
+    0xc3, 0x36, 0xf2, 0xbe, 0x63, 0xa3, 0x49, 0x71, 0x03, 0xb2, 0x4b, 0xe4, 0x71, 0x1c, 0x28, 0xda,
+    0x45, 0x5d, 0xb8, 0xce, 0xf6, 0x76, 0x77, 0xbb, 0x60, 0xd3, 0xc2, 0x23, 0x45, 0x89, 0x47, 0x8b,
+    0x27, 0x7d, 0x91, 0x64, 0x39, 0xbe, 0x69, 0x0d, 0xaa, 0xba, 0x7b, 0x8e, 0xb9, 0xdb, 0xdd, 0xa6,
+    0x68, 0x08, 0xad, 0xa1, 0x9d, 0x54, 0xba, 0x5f, 0x0c, 0x88, 0x33, 0x68, 0x70, 0x5d, 0x06, 0xdf,
+    0x3d, 0xaa, 0x07, 0x9c, 0xae, 0x33, 0x7d, 0x16, 0xc6, 0x6e, 0x7a, 0x7b, 0x71, 0xbb, 0x22, 0xfd,
+    0x74, 0xd3, 0xd4, 0xbd, 0x9d, 0xad, 0xe7, 0xf3, 0x20, 0xed, 0x52, 0x35, 0xac, 0x4b, 0x56, 0x41,
+    0x0c, 0x55, 0xc0, 0x7f, 0xd2, 0xce, 0x2d, 0x98, 0xf0, 0x38, 0x0c, 0x90, 0xa1, 0x28, 0x43, 0x57,
+    0x6e, 0x8c, 0x1d, 0xe0, 0x3c, 0x49, 0x6f, 0x92, 0xda, 0x4e, 0x0b, 0x1e, 0x1a, 0x36, 0x88, 0xe9,
+    0x1e, 0xcb, 0x45, 0x60, 0x77, 0xbf, 0x98, 0xbd, 0xa2, 0xe4, 0xb2, 0xd7, 0x2d, 0x08, 0x62, 0xc5,
+    0x3a, 0x91, 0x38, 0x2d, 0x30, 0xf7, 0xa2, 0x24, 0x0b, 0x3e, 0x07, 0xea, 0xf3, 0xe1, 0xd0, 0x86,
+    0x79, 0xfd, 0x23, 0x50, 0x57, 0x97, 0xb0, 0x9b, 0xb1, 0xf7, 0xd5, 0x56, 0x0a, 0x01, 0x34, 0x45,
+    0x23, 0x01, 0xf4, 0xf0, 0xc9, 0x54, 0xcc, 0xa7, 0x8e, 0xf1, 0x51, 0x02, 0x78, 0x8a, 0xc3, 0x2b,
+    0xe8, 0x8b, 0xd0, 0xa1, 0x24, 0x80, 0x0a, 0xf6, 0x60, 0xea, 0xe4, 0x88, 0x96, 0x14, 0x2c, 0x83,
+    0x2c, 0x73, 0x2f, 0x49, 0x08, 0x7c, 0xb3, 0xaf, 0x74, 0x71, 0x3c, 0x60, 0x2b, 0xa7, 0x7b, 0x2c,
+    0xa3, 0x36, 0xba, 0x8f, 0xa1, 0x59, 0x08, 0xaa, 0xeb, 0xc6, 0x5e, 0x90, 0xcc, 0xd9, 0x11, 0x2a,
+    0xe5, 0x63, 0x52, 0x4a, 0x74, 0x02, 0xe0, 0xe6, 0xfc, 0x28, 0x78, 0x4c, 0x7a, 0xfb, 0x0c, 0x5f,
+    0x39, 0xa6, 0x74, 0x2b, 0x82, 0x0e, 0xb4, 0xb7, 0x3c, 0xbd, 0x2d, 0x7c, 0x86, 0xcf, 0xc3, 0xbd,
+    0xff, 0x78, 0x7e, 0xfa, 0x4a, 0x27, 0xdf, 0x53, 0xed, 0x84, 0x83, 0xe3, 0xa3, 0x9e, 0x93, 0x21,
+    0x1c, 0x00, 0xd1, 0x18, 0x83, 0x75, 0xd5, 0x80, 0x89, 0x84, 0xf6, 0x18, 0x43, 0x6d, 0x98, 0x73,
+    0x73, 0x12, 0x16, 0x92, 0x4c, 0xdd, 0x28, 0x02, 0x07, 0x38, 0x02, 0x37, 0xfc, 0x76, 0x02, 0xfd,
+    0x7b, 0x0d, 0x9c, 0x5a, 0x07, 0x9a, 0x27, 0x34, 0x90, 0x78, 0x61, 0x22, 0xc6, 0x1e, 0xe4, 0x9f,
+    0xa9, 0x9d, 0xf0, 0xea, 0x59, 0x3b, 0x14, 0x6f, 0x81, 0x1d, 0xf9, 0x26, 0x6e, 0xd9, 0x09, 0xda,
+    0x16, 0x45, 0x65, 0x1c, 0x5e, 0xf4, 0x80, 0xb9, 0xb3, 0x0c, 0x8c, 0x1f, 0x3e, 0xdc, 0xa2, 0x10,
+    0x4a, 0xbb, 0xe6, 0x0c, 0x58, 0xd6, 0x91, 0xef, 0x86, 0xe0, 0x2b, 0xf7, 0x16, 0x20, 0xc3, 0x96,
+    0x20, 0xf3, 0x0c, 0x39, 0xae, 0x68, 0x09, 0xf7, 0xf6, 0x4a, 0x68, 0xd5, 0x94, 0xe9, 0xac, 0x90,
+    0xb7, 0x70, 0xdd, 0xdc, 0x43, 0xa1, 0x1f, 0xc3, 0x49, 0xed, 0xab, 0x30, 0xb8, 0x96, 0x6d, 0x10,
+    0xed, 0x37, 0x30, 0xc7, 0x39, 0x3d, 0xa3, 0xf0, 0xf4, 0x22, 0x3b, 0x00, 0x7a, 0x14, 0x8c, 0x36,
+    0x6e, 0x0c, 0x13, 0xe2, 0x1a, 0x88, 0x97, 0x12, 0x3f, 0xe0, 0xc7, 0xc1, 0xd5, 0xa1, 0xf6, 0x76,
+    0xd4, 0xb6, 0x56, 0xd1, 0xf6, 0x49, 0x10, 0xe5, 0x6e, 0xad, 0xa9, 0xb2, 0x70, 0x28, 0xd6, 0x27,
+    0x14, 0xf4, 0xab, 0xc3, 0x33, 0x50, 0x5e, 0x81, 0x08, 0x9f, 0xb2, 0x0b, 0xb6, 0x81, 0x18, 0xf6,
+    0x2b, 0x62, 0xe3, 0xc5, 0x03, 0x1e, 0x6a, 0xf7, 0xa5, 0x8c, 0xb9, 0x78, 0x2b, 0x33, 0x76, 0x9b,
+    0x60, 0xeb, 0x32, 0x65, 0x0f, 0xe5, 0x38, 0x99, 0x88, 0x06, 0x3e, 0x93, 0x8c, 0x2b, 0x51, 0xe7,
+    0x06, 0x2e, 0x4a, 0x81, 0x89, 0xf7, 0x10, 0xb4, 0x8a, 0x6c, 0xc0, 0x20, 0x5e, 0x71, 0x0a, 0x61,
+    0xe1, 0xfc, 0xc2, 0x9b, 0x97, 0xa2, 0x34, 0xfb, 0xe5, 0x12, 0x8c, 0xaf, 0xc9, 0xaa, 0x2d, 0xcc,
+    0x31, 0x5e, 0xea, 0xc1, 0xa5, 0x45, 0xd1, 0x70, 0x1e, 0xa6, 0x59, 0x7e, 0x1e, 0xfc, 0x79, 0xa3,
+    0xad, 0x6d, 0xe1, 0x95, 0xa2, 0x4a, 0x5b, 0x0a, 0x51, 0xe4, 0xc4, 0xf8, 0x2c, 0x4a, 0x5c, 0x68,
+    0x44, 0x7e, 0xa6, 0xc0, 0xd0, 0x81, 0xe9, 0x77, 0xc8, 0x1e, 0xf0, 0xe1, 0x07, 0x02, 0x8b, 0x07,
+    0x2c, 0x6e, 0x51, 0xb1, 0xb7, 0xea, 0x8a, 0x2f, 0xe3, 0x2b, 0xbe, 0x0c, 0x56, 0x7c, 0xd4, 0x07,
+    0x1e, 0xc5, 0xaa, 0x8f, 0x53, 0x83, 0x4a, 0x40, 0x23, 0xe9, 0xf3, 0x34, 0x59, 0xf6, 0x38, 0x22,
+    0xf8, 0xb6, 0x4a, 0x9a, 0x7b, 0x7b, 0x19, 0x8e, 0x31, 0x60, 0x3d, 0x0c, 0xf6, 0xcd, 0x3e, 0x0d,
+    0x38, 0x60, 0x57, 0xe8, 0x36, 0xc3, 0xec, 0x95, 0xfb, 0xaa, 0x77, 0xd5, 0x07, 0xbd, 0x44, 0x7d,
+    0x03, 0x1d, 0xbc, 0x2a, 0xc4, 0x9e, 0xf1, 0x75, 0xe4, 0x0f, 0xcc, 0xc3, 0x6b, 0x8d, 0x05, 0x23,
+    0x60, 0xbd, 0x80, 0x71, 0xe1, 0x1e, 0x8e, 0xfa, 0x9e, 0xb4, 0x4a, 0x2c, 0xc9, 0x44, 0xaf, 0xfd,
+    0xa6, 0x48, 0x5b, 0x94, 0x5d, 0xa2, 0x8e, 0x77, 0x83, 0x36, 0x98, 0xa0, 0x2a, 0x49, 0x6c, 0xb6,
+    0x4d, 0x8e, 0x6a, 0x7d, 0x45, 0x8a, 0xb4, 0x8c, 0x4f, 0x32, 0xbe, 0xfc, 0x26, 0x56, 0x92, 0x2c,
+    0x8b, 0x15, 0x40, 0x1a, 0xcc, 0xc5, 0xf0, 0x5c, 0x52, 0x71, 0x5f, 0xc7, 0x4b, 0x44, 0x8a, 0xd5,
+    0x5f, 0xb9, 0x69, 0x48, 0x63, 0xc8, 0x29, 0x1f, 0xa1, 0xc8, 0xe0, 0x1b, 0x54, 0x8e, 0x5e, 0x45,
+    0x0b, 0x8f, 0xe6, 0x80, 0xcd, 0xd0, 0x24, 0xf0, 0x4e, 0x5e, 0x03, 0x63, 0x40, 0x01, 0x04, 0xb6,
+    0xbf, 0xc3, 0xfb, 0x81, 0x29, 0xf5, 0x66, 0xec, 0xe7, 0xe0, 0x11, 0x26, 0x73, 0x14, 0x07, 0x81,
+    0x00, 0xb6, 0x13, 0xa4, 0x07, 0x00, 0xca, 0xc2, 0x3b, 0xe7, 0x78, 0x99, 0x15, 0xbe, 0x8b, 0x96,
+    0x8e, 0x51, 0x2e, 0x7e, 0x45, 0x2c, 0xfc, 0x5e, 0xa2, 0x18, 0x66, 0x5f, 0x2f, 0x12, 0x42, 0x82,
+    0x84, 0xfa, 0x6a, 0xbd, 0x9c, 0x81, 0xa2, 0x86, 0x19, 0xc4, 0xc2, 0xc1, 0x25, 0x2c, 0x43, 0x41,
+    0xbe, 0x3f, 0xff, 0x39, 0x5f, 0xc3, 0xb8, 0xb3, 0x0c, 0xbf, 0x3e, 0x82, 0x41, 0xc6, 0x93, 0xc9,
+    0xc4, 0x32, 0xc7, 0x9f, 0xa6, 0x7a, 0x68, 0x14, 0x1b, 0xa9, 0x6d, 0x31, 0x0b, 0xc9, 0x65, 0x2e,
+    0x8c, 0x79, 0xe4, 0x5e, 0x66, 0x7c, 0xa6, 0x24, 0x40, 0x82, 0x50, 0x8a, 0xec, 0xff, 0xbc, 0x06,
+    0x16, 0x0c, 0x0e, 0xe0, 0x16, 0x82, 0x45, 0xa1, 0x02, 0x1f, 0x9d, 0x7d, 0xc6, 0x76, 0x77, 0x19,
+    0x28, 0xe6, 0x3a, 0x80, 0x99, 0x1d, 0xb4, 0x18, 0x69, 0xa7, 0x4b, 0xc4, 0x79, 0x08, 0x91, 0x42,
+    0x0e, 0x54, 0xed, 0xd0, 0x30, 0x1b, 0xb1, 0x6c, 0xdb, 0x57, 0x89, 0x8b, 0x7d, 0x15, 0x8e, 0xfd,
+    0xdb, 0xf0, 0x3b, 0xa5, 0xbf, 0xb0, 0xed, 0x36, 0x7c, 0x86, 0x28, 0xa4, 0x39, 0x6f, 0x2e, 0xc4,
+    0xd2, 0x2b, 0x40, 0xa0, 0x99, 0x95, 0xf0, 0xf6, 0xf8, 0xc5, 0x58, 0xd1, 0x31, 0xe6, 0x84, 0xbc,
+    0x0c, 0x72, 0x17, 0xe7, 0x54, 0x10, 0x7f, 0xc0, 0x5f, 0x79, 0xca, 0x39, 0xd1, 0xcb, 0xc8, 0xf4,
+    0xb8, 0x32, 0xf6, 0xfa, 0x7d, 0x76, 0x78, 0x78, 0x88, 0xfd, 0x65, 0x01, 0xef, 0x7d, 0x21, 0x49,
+    0x06, 0xc3, 0x03, 0x93, 0xfb, 0x24, 0xc2, 0x15, 0xa1, 0xf4, 0x4c, 0xf6, 0xe8, 0x11, 0x0b, 0xfb,
+    0x1f, 0xc7, 0x8f, 0x82, 0x12, 0xae, 0x0e, 0xdf, 0x63, 0x47, 0x89, 0xb5, 0x64, 0x16, 0x5a, 0xc4,
+    0xf7, 0xec, 0x4b, 0x66, 0x21, 0x8b, 0x34, 0x78, 0x24, 0x47, 0xb5, 0xcb, 0x2c, 0xe0, 0xd2, 0xf7,
+    0xf8, 0xb9, 0x5f, 0x19, 0x98, 0xf7, 0xe2, 0xd3, 0x47, 0x45, 0x79, 0x86, 0xa0, 0x3c, 0x05, 0x43,
+    0xa1, 0xb2, 0xcd, 0x93, 0x01, 0x27, 0xb9, 0x03, 0x13, 0x6e, 0x72, 0xe9, 0xae, 0x7a, 0xbd, 0xab,
+    0x01, 0xd0, 0x87, 0xc6, 0xd3, 0xe3, 0x3c, 0x53, 0x89, 0x56, 0x7c, 0xe3, 0x46, 0x8f, 0x47, 0xd3,
+    0xf6, 0x3a, 0x4d, 0x71, 0x0a, 0xa4, 0x70, 0xae, 0x98, 0xc0, 0x6b, 0xe1, 0x48, 0x11, 0xc6, 0x61,
+    0x64, 0x86, 0x2e, 0x8f, 0x6c, 0xa9, 0xda, 0x53, 0x56, 0xf1, 0x10, 0xb0, 0x16, 0xe2, 0x9f, 0xc8,
+    0x88, 0x0e, 0x2f, 0x0f, 0xfb, 0x72, 0xa7, 0x16, 0xdf, 0xb9, 0x87, 0x61, 0x90, 0x0a, 0xa9, 0xdf,
+    0xd2, 0x93, 0x42, 0x4b, 0x6c, 0x58, 0x0c, 0xcf, 0xcd, 0xaf, 0x8a, 0x01, 0x86, 0x90, 0xa7, 0xdf,
+    0xd4, 0x02, 0xc8, 0xd3, 0x6f, 0x8a, 0x7d, 0xe1, 0x9e, 0xd2, 0x5b, 0x88, 0xb7, 0x1d, 0xc8, 0xf1,
+    0xd1, 0x59, 0x3d, 0x0c, 0x3d, 0x3a, 0xdb, 0x06, 0xa6, 0x0c, 0xf3, 0xf0, 0xc8, 0xae, 0xd7, 0x7d,
+    0x13, 0xbf, 0x8b, 0x93, 0xeb, 0x98, 0x71, 0x22, 0x31, 0x96, 0x6a, 0xa1, 0xb2, 0x1e, 0xe4, 0x16,
+    0xfc, 0x93, 0x81, 0x2e, 0xfb, 0xf5, 0xaf, 0xd9, 0xb0, 0xbe, 0x1d, 0xd0, 0x4e, 0x19, 0x5f, 0xac,
+    0x37, 0x62, 0xf4, 0xf3, 0x20, 0xc7, 0x8c, 0x53, 0xb6, 0x5e, 0xe1, 0x3d, 0xea, 0xa2, 0x79, 0xb9,
+    0x0d, 0xc0, 0x37, 0x48, 0x8b, 0x4b, 0xbb, 0xca, 0x76, 0x00, 0x78, 0xa6, 0xf4, 0x96, 0x27, 0x3b,
+    0x60, 0xdc, 0x5a, 0x7f, 0xf3, 0x5e, 0x05, 0x44, 0x19, 0x80, 0xdd, 0xb1, 0x19, 0x5b, 0x36, 0x94,
+    0xdb, 0xb1, 0x55, 0x04, 0xfa, 0x35, 0x84, 0xc4, 0xf2, 0x4d, 0x5c, 0xec, 0xc5, 0x05, 0x18, 0xbe,
+    0xf9, 0xa5, 0xbb, 0xaf, 0xee, 0x0c, 0x71, 0x78, 0xfd, 0x2a, 0x1e, 0x1b, 0x3b, 0x72, 0x9c, 0x93,
+    0x9b, 0x0b, 0x79, 0x78, 0xb0, 0x05, 0x61, 0xe5, 0x78, 0x4d, 0xa2, 0x5b, 0x76, 0x2c, 0x27, 0x13,
+    0x68, 0x96, 0x2c, 0x01, 0x4e, 0x59, 0xa7, 0x97, 0x7b, 0x25, 0x30, 0xea, 0x2b, 0x88, 0x25, 0x7a,
+    0x95, 0x90, 0x4b, 0xbe, 0xbb, 0x79, 0x0b, 0xbb, 0x45, 0x13, 0x39, 0xae, 0xec, 0x01, 0x13, 0xa2,
+    0x78, 0xc4, 0xb5, 0x1b, 0x74, 0x44, 0xe0, 0x88, 0x4a, 0xb3, 0x54, 0x87, 0x75, 0x63, 0x90, 0xe6,
+    0x8f, 0xf1, 0x58, 0x26, 0xe8, 0x11, 0x92, 0x83, 0xa2, 0x73, 0x0c, 0xc1, 0xed, 0x79, 0x38, 0xc3,
+    0xf7, 0x5e, 0x0a, 0x05, 0x93, 0xb4, 0x1c, 0xdf, 0xb9, 0xa9, 0x5e, 0x39, 0xcf, 0x29, 0x19, 0x73,
+    0x5c, 0xee, 0xab, 0x4b, 0x10, 0xb2, 0x90, 0xbb, 0xf9, 0x37, 0x14, 0xaf, 0xb3, 0xcb, 0x28, 0x99,
+    0xb9, 0x91, 0x3c, 0xe1, 0x00, 0x9f, 0x18, 0xa4, 0x38, 0x07, 0xde, 0xb5, 0xa3, 0x5e, 0xdf, 0xb1,
+    0xb4, 0x0c, 0x43, 0x4e, 0xa2, 0xb9, 0xd8, 0x37, 0xa2, 0xad, 0x48, 0x20, 0x11, 0xeb, 0x8a, 0xc0,
+    0x00, 0xa7, 0x8b, 0xd3, 0x6f, 0x3e, 0x6e, 0x6b, 0xb3, 0x6b, 0xd1, 0x2e, 0x41, 0x7d, 0x33, 0xbf,
+    0xb6, 0x6f, 0x58, 0xb1, 0x38, 0xd5, 0xcc, 0x80, 0x38, 0xd7, 0xbf, 0xed, 0x36, 0x0f, 0x34, 0x5a,
+    0x7c, 0xca, 0xdd, 0x06, 0x8c, 0xef, 0x12, 0xa8, 0xe8, 0x63, 0xeb, 0x01, 0xd0, 0xc7, 0xd1, 0x39,
+    0x22, 0x3a, 0xff, 0x40, 0x5d, 0x02, 0xbd, 0x03, 0xe3, 0xa3, 0x7c, 0x82, 0xec, 0xc9, 0xb1, 0xa6,
+    0x13, 0xbc, 0x83, 0x6a, 0x1f, 0x0e, 0x15, 0x6b, 0xfa, 0xe2, 0x8d, 0x06, 0xca, 0xe6, 0xa6, 0xeb,
+    0x23, 0x09, 0xe2, 0xec, 0x0f, 0xb1, 0xa7, 0xfa, 0x10, 0x7a, 0xa7, 0xcf, 0x2f, 0x5e, 0xbe, 0x10,
+    0xbb, 0xdc, 0x6d, 0xf1, 0x8a, 0x10, 0x77, 0xdd, 0xd3, 0xcb, 0x20, 0xa6, 0x06, 0x07, 0xc2, 0x82,
+    0x3f, 0x6d, 0xe6, 0x0b, 0xb6, 0x1c, 0x54, 0x97, 0x2f, 0x80, 0xec, 0x1c, 0xca, 0x13, 0xcb, 0xff,
+    0xf0, 0x43, 0xf8, 0xbe, 0xe5, 0xd8, 0xb7, 0x7c, 0x4b, 0xa3, 0xcc, 0x39, 0xc4, 0x86, 0xcd, 0xb4,
+    0x8f, 0x3f, 0x55, 0xbd, 0x83, 0xfa, 0xde, 0xe2, 0x0f, 0x3b, 0x75, 0x53, 0x8a, 0x2a, 0x1e, 0x42,
+    0x29, 0xff, 0x1c, 0x4e, 0xe2, 0x43, 0x2c, 0xb5, 0x62, 0x4f, 0xad, 0xa6, 0x5a, 0xdf, 0x4c, 0xc2,
+    0xf3, 0x30, 0x84, 0x88, 0x5b, 0x29, 0xe8, 0xce, 0xe5, 0x09, 0xc5, 0xa6, 0x20, 0x84, 0xf7, 0x3f,
+    0xfd, 0xa6, 0x09, 0xa1, 0xb2, 0x85, 0x25, 0x36, 0xa3, 0x8a, 0x23, 0x10, 0x1e, 0x79, 0xcb, 0xc8,
+    0x8e, 0x8f, 0xc1, 0x57, 0x60, 0x5f, 0x1c, 0xf0, 0xf8, 0x0c, 0xa7, 0x01, 0x54, 0x23, 0xf5, 0x00,
+    0x85, 0xef, 0x6e, 0xd4, 0xce, 0x54, 0x21, 0xdc, 0x14, 0x41, 0xe4, 0xce, 0xcd, 0x1e, 0xdf, 0x9f,
+    0x83, 0x60, 0x72, 0xb0, 0x73, 0x2b, 0xc2, 0x48, 0x3a, 0x06, 0x51, 0xec, 0x46, 0xf6, 0xb9, 0xf3,
+    0xb0, 0x45, 0x36, 0xcc, 0x16, 0xe1, 0x5c, 0x30, 0xf7, 0x7d, 0x01, 0x4c, 0xd0, 0xc8, 0x36, 0x9d,
+    0xaf, 0x6c, 0xe6, 0x4b, 0x8d, 0xb3, 0x82, 0x33, 0x48, 0xae, 0x64, 0x92, 0xc4, 0x0c, 0x62, 0xf4,
+    0x3e, 0xbd, 0x8e, 0xa7, 0x69, 0x5c, 0x56, 0x79, 0xba, 0x5c, 0xae, 0xe4, 0x50, 0x5f, 0x39, 0x08,
+    0x0a, 0xc1, 0x9b, 0x3c, 0x2d, 0x0f, 0x5f, 0x2b, 0x14, 0xf6, 0x59, 0xf5, 0xbb, 0x58, 0x68, 0xfe,
+    0xdb, 0xf1, 0x58, 0xae, 0x7b, 0x57, 0x89, 0xa5, 0xd0, 0x64, 0x7d, 0x27, 0xbd, 0xd8, 0x22, 0x55,
+    0x8a, 0x6d, 0x41, 0x2a, 0xb5, 0x56, 0xb5, 0xa7, 0x28, 0x58, 0xc7, 0x7e, 0x30, 0x07, 0xbf, 0xea,
+    0x2b, 0x27, 0xa5, 0x50, 0xf7, 0x34, 0xda, 0x1e, 0x01, 0x60, 0xb2, 0x89, 0xb4, 0x6d, 0xde, 0x9e,
+    0x96, 0xbf, 0xf4, 0x54, 0x9b, 0x5c, 0x68, 0x01, 0x4f, 0x7b, 0xef, 0xd4, 0xb2, 0xd8, 0xb8, 0xa3,
+    0x1c, 0x25, 0xbe, 0x4f, 0x0f, 0xf3, 0x1c, 0xc2, 0x1b, 0x30, 0xd1, 0xa0, 0x58, 0x20, 0xa5, 0x15,
+    0xa4, 0xc5, 0xd7, 0x16, 0x94, 0x17, 0xe9, 0x5d, 0x08, 0x3f, 0x7f, 0x2d, 0xd1, 0xc5, 0xb6, 0xb4,
+    0x79, 0x9e, 0x6e, 0x43, 0x75, 0x91, 0xb6, 0x23, 0x0a, 0x70, 0x06, 0x6c, 0x91, 0x16, 0xd2, 0xb8,
+    0xbf, 0xbe, 0xab, 0x60, 0x28, 0xa1, 0x67, 0xc0, 0xf5, 0x43, 0x2a, 0x1e, 0x95, 0x71, 0xff, 0x81,
+    0xc8, 0x2a, 0x07, 0xd7, 0xd8, 0xe5, 0x6e, 0xfa, 0xe4, 0x91, 0x87, 0x10, 0x8a, 0xe8, 0xd5, 0xaf,
+    0x38, 0x90, 0x47, 0x6c, 0x6c, 0xe0, 0x5c, 0xc3, 0xbf, 0xd1, 0xe9, 0x37, 0xc9, 0x4d, 0x34, 0xae,
+    0x87, 0x05, 0x3f, 0xfd, 0xe3, 0x3f, 0xb3, 0xe3, 0x45, 0xe0, 0xbd, 0x63, 0x80, 0xd1, 0x7e, 0xd9,
+    0x8c, 0xe6, 0x90, 0x57, 0x78, 0x2e, 0x07, 0x8d, 0x36, 0xe7, 0x27, 0x89, 0xf4, 0xc5, 0xae, 0xb2,
+    0x4c, 0xda, 0x38, 0x52, 0x91, 0xb0, 0xf4, 0x11, 0xe3, 0xc4, 0xb2, 0x23, 0x89, 0xa4, 0x5c, 0xd8,
+    0x29, 0x1c, 0xe5, 0xfa, 0xfa, 0x81, 0x3c, 0x2d, 0x33, 0xaa, 0xee, 0xe2, 0xea, 0x74, 0x74, 0x17,
+    0x1b, 0x5f, 0xe0, 0xad, 0x1f, 0xca, 0x1b, 0xfb, 0x08, 0x02, 0xe5, 0x8b, 0xb3, 0xba, 0x95, 0x75,
+    0x6b, 0x31, 0xb8, 0x73, 0x2f, 0x19, 0xfe, 0xc1, 0x08, 0xb0, 0xb2, 0x13, 0x5b, 0x9a, 0x54, 0x21,
+    0xbc, 0x5a, 0x1a, 0xcc, 0xb5, 0x48, 0x80, 0x11, 0x1b, 0x7b, 0xd5, 0xfc, 0x97, 0x85, 0xc8, 0x7c,
+    0x11, 0xc7, 0xf7, 0xfc, 0x95, 0x60, 0x32, 0x99, 0x22, 0xbf, 0xd1, 0xe9, 0x6e, 0xc9, 0x6b, 0x08,
+    0x68, 0x31, 0x6d, 0x00, 0xfe, 0x2f, 0x7e, 0xb0, 0x8b, 0x77, 0xeb, 0xf3, 0x36, 0xb8, 0xb3, 0x7a,
+    0x8e, 0xa1, 0x23, 0x3f, 0x3b, 0xa4, 0x57, 0x87, 0x75, 0xcb, 0xaa, 0x2d, 0xbd, 0x29, 0x4d, 0x2b,
+    0x8c, 0xbf, 0x42, 0x2d, 0x64, 0x27, 0xfc, 0x37, 0x82, 0x6e, 0x8b, 0xec, 0x2d, 0x5e, 0xac, 0x95,
+    0xe5, 0x77, 0xe6, 0x43, 0xc8, 0xbc, 0x06, 0x59, 0x49, 0x6f, 0x30, 0x55, 0xce, 0x11, 0xf1, 0xab,
+    0x7e, 0x0b, 0x2a, 0xc1, 0x07, 0xed, 0x97, 0x83, 0x8b, 0xaa, 0xfd, 0x4a, 0xbb, 0x43, 0x81, 0x45,
+    0xbf, 0xc4, 0xa6, 0x68, 0x47, 0x3b, 0x46, 0x32, 0xdf, 0x45, 0x40, 0x39, 0x28, 0x89, 0xe8, 0xf3,
+    0x1f, 0xf4, 0xe0, 0x9d, 0x0c, 0x5a, 0x8b, 0xf0, 0x67, 0xb3, 0x3c, 0xde, 0x4f, 0x31, 0x45, 0x9c,
+    0xa7, 0xdc, 0x60, 0x9d, 0x26, 0xb1, 0x01, 0xff, 0x63, 0x4a, 0x89, 0xdc, 0x9c, 0x8b, 0x7d, 0xe8,
+    0x1e, 0x97, 0xaa, 0xc6, 0x2c, 0xf6, 0x40, 0xca, 0x09, 0xb7, 0xd2, 0x8a, 0xa4, 0x16, 0x73, 0xd0,
+    0xc8, 0xe2, 0xe0, 0x20, 0x6e, 0x0b, 0x10, 0x42, 0xf8, 0x0d, 0x18, 0x84, 0x08, 0x17, 0x58, 0x96,
+    0xa7, 0xc9, 0xbb, 0xa0, 0x94, 0x26, 0x7f, 0xb3, 0x9b, 0x90, 0x26, 0xbe, 0x51, 0xef, 0x6b, 0xa1,
+    0x5c, 0x66, 0x6b, 0xe0, 0x0e, 0x8a, 0x53, 0x0b, 0x2e, 0x70, 0x1d, 0x21, 0xd5, 0xea, 0xe1, 0x26,
+    0x14, 0x1e, 0x40, 0xdf, 0x5d, 0x36, 0xe2, 0xa3, 0xcc, 0x82, 0xcb, 0x30, 0x3e, 0x03, 0xb2, 0x7a,
+    0x42, 0xbf, 0x96, 0xc9, 0x55, 0x70, 0x91, 0xf4, 0x44, 0xeb, 0x01, 0xbb, 0xed, 0x97, 0xe8, 0x40,
+    0xb9, 0x64, 0x4c, 0xa3, 0x9e, 0xd3, 0x22, 0x22, 0xdb, 0x16, 0xd5, 0x91, 0xba, 0x03, 0x91, 0xa4,
+    0x7f, 0xd3, 0xdf, 0x98, 0x51, 0x43, 0x87, 0x7c, 0x4a, 0xae, 0x59, 0x83, 0x4b, 0x3c, 0xf1, 0xef,
+    0x2d, 0x00, 0xf9, 0xae, 0xc9, 0x27, 0xab, 0x8d, 0xa8, 0x9a, 0x9a, 0x72, 0x85, 0x2b, 0x03, 0x5a,
+    0x21, 0xfa, 0x0a, 0xe7, 0x42, 0x60, 0x12, 0x57, 0x86, 0x7d, 0x85, 0xb3, 0x05, 0x3b, 0x65, 0x43,
+    0xad, 0xd4, 0x5e, 0xad, 0xd0, 0xf2, 0x07, 0x42, 0x07, 0xb8, 0xb6, 0x86, 0x92, 0xa2, 0x1f, 0x54,
+    0xee, 0xde, 0x70, 0xbe, 0x95, 0xfb, 0x75, 0x25, 0x83, 0x65, 0x15, 0xe9, 0x7b, 0x8d, 0xb1, 0xd2,
+    0x05, 0x24, 0xdc, 0xcb, 0xe1, 0x5b, 0x88, 0xf9, 0x4f, 0xe0, 0x6d, 0x48, 0x5f, 0x6a, 0xe3, 0x79,
+    0x2b, 0xb9, 0xfe, 0x0d, 0xa0, 0x6d, 0x1a, 0x46, 0xd3, 0xc5, 0x34, 0xd8, 0x5d, 0x38, 0x19, 0x7c,
+    0x51, 0x29, 0x78, 0x19, 0x73, 0x84, 0xff, 0xb5, 0x3a, 0x27, 0xdb, 0xb6, 0x15, 0xcf, 0x74, 0x41,
+    0x2b, 0xa3, 0xe3, 0x45, 0x97, 0x0f, 0x38, 0x00, 0x1c, 0x1e, 0x32, 0x0b, 0x20, 0x58, 0x96, 0xa0,
+    0xad, 0x7d, 0x5f, 0x82, 0xfc, 0x6d, 0x71, 0xda, 0x5e, 0xfa, 0x1d, 0x99, 0x12, 0x2a, 0xab, 0x6a,
+    0x0b, 0xe7, 0xfb, 0xaf, 0xf2, 0xef, 0xbd, 0x4e, 0x2e, 0x46, 0xfa, 0xf7, 0xbb, 0x32, 0x6e, 0xae,
+    0x16, 0x2b, 0xc7, 0xd1, 0x0d, 0x26, 0x66, 0x1b, 0xd7, 0x79, 0x9c, 0x99, 0x41, 0xb4, 0x9d, 0x95,
+    0x24, 0x4c, 0xe1, 0x98, 0x03, 0x0a, 0x44, 0x82, 0xfa, 0x64, 0x5c, 0x5b, 0x2c, 0x8a, 0xd3, 0x1b,
+    0x3d, 0x4f, 0x9e, 0x85, 0x37, 0x81, 0xdf, 0x1b, 0xe2, 0xa1, 0x7d, 0x91, 0xc9, 0x82, 0x89, 0x73,
+    0xb4, 0x2f, 0x42, 0x7a, 0xd7, 0xd6, 0x9b, 0xab, 0x15, 0xf6, 0x29, 0xd3, 0x7f, 0xde, 0xd7, 0xd5,
+    0x47, 0xbd, 0xa4, 0x59, 0xcb, 0xeb, 0x6d, 0x99, 0xca, 0xea, 0x2e, 0x88, 0x19, 0xf5, 0xc5, 0x7a,
+    0x23, 0x61, 0xf9, 0xa3, 0x4e, 0xed, 0xbb, 0x46, 0x77, 0xbf, 0x99, 0x4b, 0x27, 0xee, 0xa8, 0xd2,
+    0x8b, 0x58, 0x45, 0xaa, 0xf4, 0x17, 0xfc, 0x49, 0x6a, 0x34, 0xde, 0x72, 0xda, 0x22, 0x05, 0x79,
+    0xfb, 0x15, 0x75, 0x19, 0x7f, 0xa9, 0xab, 0x3a, 0xa8, 0x00, 0x0a, 0x8c, 0xfb, 0xe9, 0xc7, 0xff,
+    0x8e, 0x37, 0x2b, 0x5f, 0x07, 0x19, 0xc0, 0x21, 0x0e, 0xaa, 0xb7, 0x62, 0xbb, 0xbc, 0x73, 0x33,
+    0x59, 0x8e, 0xff, 0xf0, 0x17, 0xac, 0x33, 0x44, 0x62, 0x50, 0xcb, 0x62, 0x82, 0xff, 0x70, 0x27,
+    0xde, 0x72, 0x21, 0x3a, 0xe6, 0x41, 0x0e, 0x0c, 0xee, 0xee, 0xba, 0xab, 0x70, 0x37, 0x13, 0x11,
+    0xeb, 0x8e, 0x9e, 0x2f, 0x82, 0xb8, 0x97, 0x22, 0xbf, 0x53, 0xfd, 0xcf, 0xb2, 0x24, 0xee, 0xf5,
+    0x65, 0x21, 0xcf, 0x01, 0xda, 0x9e, 0x43, 0x25, 0xee, 0x4e, 0x35, 0x78, 0x4a, 0x6b, 0xcb, 0x25,
+    0xd4, 0x6c, 0x93, 0x89, 0xbc, 0xdd, 0xd4, 0xde, 0x1b, 0xaa, 0x8b, 0x4c, 0x36, 0xe4, 0x53, 0x99,
+    0xd6, 0x86, 0x3c, 0xaa, 0x65, 0x8a, 0xdd, 0x6b, 0x90, 0x4a, 0xa0, 0x59, 0xb9, 0x49, 0x85, 0xf6,
+    0xd2, 0x6b, 0x1d, 0xb5, 0xf2, 0xee, 0x6e, 0x1a, 0xb9, 0x72, 0xeb, 0x0a, 0x85, 0xbb, 0x6d, 0xec,
+    0x93, 0xb3, 0x7b, 0x11, 0x27, 0xcb, 0x4e, 0xce, 0x70, 0x04, 0x4d, 0xdb, 0x46, 0x11, 0xde, 0x8a,
+    0x6a, 0x07, 0x8a, 0x35, 0x64, 0x93, 0x5d, 0x43, 0xa7, 0xbf, 0xae, 0x04, 0x4d, 0x35, 0x12, 0xb2,
+    0x3c, 0x13, 0xbf, 0x0a, 0x7c, 0xd4, 0x8d, 0x6d, 0x3a, 0x5c, 0xbd, 0x2b, 0xd5, 0x55, 0x33, 0xbf,
+    0xca, 0x2a, 0x5a, 0x58, 0x48, 0x68, 0x55, 0x8f, 0xfd, 0xfb, 0xdf, 0xfd, 0xe6, 0x7f, 0x8b, 0x9b,
+    0x4b, 0xe2, 0x2a, 0x85, 0xbc, 0x36, 0x21, 0x5e, 0x3f, 0x8f, 0x6f, 0xae, 0x80, 0x9e, 0xcc, 0x03,
+    0x40, 0x30, 0x6a, 0x88, 0x2f, 0xf4, 0xbe, 0x86, 0x59, 0x89, 0x7e, 0x4c, 0x42, 0x13, 0x12, 0x66,
+    0x3c, 0x07, 0x9e, 0xbf, 0xc5, 0x83, 0x2e, 0x3d, 0x55, 0x16, 0x1b, 0xed, 0x43, 0xff, 0xf4, 0x97,
+    0xf4, 0x62, 0x8e, 0x57, 0x09, 0xa7, 0xb4, 0x32, 0x82, 0xc6, 0xc7, 0x20, 0x88, 0xf8, 0xdb, 0x49,
+    0x47, 0x67, 0x0c, 0x75, 0x95, 0xb9, 0x78, 0x7b, 0x40, 0x0e, 0x25, 0x1c, 0x18, 0xbe, 0xe2, 0x16,
+    0xed, 0x26, 0x20, 0x97, 0x54, 0xcd, 0xd3, 0xe2, 0x9a, 0x25, 0xac, 0x8d, 0xcd, 0xdd, 0x30, 0xe2,
+    0x39, 0x6e, 0x41, 0xbf, 0x96, 0x2b, 0xdc, 0xbc, 0xc5, 0xdb, 0xd8, 0xc3, 0xf7, 0x88, 0x47, 0x30,
+    0x2e, 0xcf, 0x69, 0xc4, 0x39, 0x8e, 0x3b, 0x18, 0x6a, 0x0f, 0x82, 0xe4, 0x09, 0x78, 0x62, 0x1f,
+    0xf1, 0x02, 0xdf, 0x27, 0x9e, 0x83, 0x48, 0x37, 0xed, 0xbb, 0xf3, 0xeb, 0x93, 0x6f, 0xc5, 0x95,
+    0xcb, 0x07, 0xd5, 0x9b, 0xc4, 0x9d, 0xef, 0x8a, 0x8b, 0x0e, 0x30, 0x06, 0xe2, 0x52, 0xf3, 0x65,
+    0x15, 0x60, 0x47, 0x51, 0xd4, 0xeb, 0x8a, 0x17, 0xf5, 0x77, 0xfb, 0x6f, 0x8d, 0xef, 0xf6, 0x71,
+    0x0f, 0xf6, 0x99, 0x8b, 0x3f, 0x04, 0xe6, 0xbd, 0x13, 0xdb, 0x1b, 0x25, 0x1c, 0xbd, 0xf8, 0xa5,
+    0x82, 0x03, 0x71, 0x95, 0xa1, 0xe9, 0xfd, 0x40, 0x31, 0x7e, 0xfb, 0x97, 0x74, 0x85, 0x39, 0xe6,
+    0x17, 0x2a, 0xbb, 0x8d, 0x9d, 0xd7, 0x67, 0xe8, 0xad, 0x30, 0x0e, 0x22, 0x7f, 0x85, 0x8e, 0x66,
+    0x17, 0x49, 0x40, 0xc4, 0x55, 0x47, 0xa6, 0x54, 0xa8, 0xbe, 0xac, 0xc6, 0x5d, 0xf1, 0x43, 0x64,
+    0x81, 0x58, 0xd3, 0xef, 0x91, 0xc1, 0xa7, 0xe2, 0xc7, 0x00, 0x24, 0x2b, 0x52, 0x3d, 0x79, 0x47,
+    0xa7, 0x64, 0x8b, 0x14, 0xd6, 0xe1, 0x98, 0xd1, 0xf1, 0x94, 0x8b, 0xf9, 0xf9, 0xc5, 0xc5, 0x19,
+    0xcf, 0xc6, 0x1b, 0x6c, 0x02, 0x50, 0x9c, 0x9b, 0x4b, 0x27, 0xba, 0x4f, 0xaa, 0x53, 0xf3, 0xa3,
+    0x4d, 0x89, 0xa7, 0x02, 0x31, 0x0e, 0x90, 0xd2, 0x2d, 0x21, 0xb0, 0x04, 0xb2, 0xc3, 0xf9, 0x2d,
+    0xcf, 0x4d, 0xc4, 0x54, 0x27, 0x5e, 0x84, 0xeb, 0x47, 0xdc, 0x8b, 0x29, 0x33, 0xaa, 0xf8, 0x2d,
+    0xf3, 0xad, 0x89, 0xe6, 0xfc, 0x0a, 0x7b, 0x21, 0x6e, 0xde, 0xa5, 0x25, 0xe5, 0x50, 0xb6, 0x94,
+    0x40, 0x8b, 0x8b, 0x2d, 0xdd, 0xca, 0x36, 0x34, 0xaf, 0xad, 0x5a, 0xda, 0x87, 0x5d, 0x80, 0xef,
+    0x2a, 0x3e, 0x24, 0x16, 0xfa, 0x58, 0xec, 0xdd, 0xca, 0x82, 0x72, 0xdf, 0xd3, 0x68, 0x58, 0xca,
+    0x11, 0x0f, 0x8f, 0x91, 0x5f, 0xad, 0x7d, 0x1e, 0x42, 0x95, 0x2c, 0x23, 0xf7, 0x5c, 0x69, 0x24,
+    0xe3, 0x8c, 0x38, 0xc8, 0xd5, 0x80, 0x4a, 0x90, 0xa0, 0xb0, 0x12, 0x6f, 0x89, 0xe4, 0x81, 0xe0,
+    0x66, 0xaf, 0xcb, 0x1b, 0x20, 0x3c, 0xfe, 0x54, 0xdc, 0x51, 0x00, 0x40, 0x7a, 0x96, 0xe1, 0xaf,
+    0x0a, 0x88, 0x8a, 0xaa, 0xa6, 0xcb, 0x6a, 0x42, 0xab, 0x87, 0x48, 0x63, 0x49, 0x0a, 0x45, 0x54,
+    0xe2, 0x3f, 0x5e, 0xf6, 0xf9, 0xec, 0x43, 0x0d, 0x03, 0x30, 0xef, 0x00, 0xa7, 0x1d, 0xb0, 0x8f,
+    0xdf, 0xd0, 0x6c, 0xa3, 0x8c, 0x88, 0x84, 0x64, 0x65, 0x2b, 0x01, 0x9b, 0xbe, 0xec, 0x4b, 0xc1,
+    0xe0, 0xdb, 0x2b, 0x62, 0xff, 0x78, 0x11, 0x46, 0x7e, 0x8f, 0x77, 0x93, 0x41, 0x7c, 0x3d, 0x07,
+    0x81, 0x78, 0x09, 0xde, 0xb1, 0x90, 0x41, 0x21, 0xed, 0x6d, 0x06, 0x2d, 0xae, 0x36, 0xb5, 0x5b,
+    0x34, 0x7f, 0x29, 0x81, 0x14, 0x7a, 0xd6, 0xe6, 0x40, 0x1b, 0x7a, 0x47, 0x3d, 0x78, 0xa6, 0x2b,
+    0xf1, 0x21, 0xd0, 0x45, 0x0e, 0x74, 0xbf, 0x91, 0x3f, 0x4d, 0xbf, 0x20, 0x28, 0x5b, 0x65, 0xf8,
+    0x45, 0x68, 0xf5, 0x67, 0x43, 0xb5, 0x25, 0x86, 0x2a, 0x5f, 0xf5, 0x50, 0xee, 0x0b, 0x7e, 0x90,
+    0xd9, 0x89, 0x4d, 0xa5, 0x6b, 0x98, 0xa2, 0xf0, 0x95, 0x0a, 0x77, 0xf4, 0x92, 0xc3, 0x95, 0x3d,
+    0x0b, 0xcd, 0x14, 0x12, 0xe6, 0xdf, 0xb3, 0xb7, 0xe2, 0x2b, 0xff, 0xc0, 0x09, 0xd0, 0x0f, 0x6e,
+    0xc4, 0x46, 0xbe, 0xe8, 0x02, 0x46, 0xb5, 0x41, 0x73, 0x30, 0x44, 0x20, 0xf6, 0xd0, 0x6e, 0xa7,
+    0xc4, 0xad, 0x72, 0xed, 0xa6, 0x28, 0x6c, 0x78, 0xf3, 0xa2, 0x46, 0x79, 0xcd, 0x03, 0x76, 0x3a,
+    0xc5, 0x8b, 0x0f, 0x42, 0x9b, 0x40, 0x9d, 0x93, 0xe2, 0x8d, 0x0f, 0x7d, 0x75, 0xb6, 0x6e, 0x83,
+    0x2b, 0x24, 0xb5, 0x09, 0x70, 0xfd, 0x0d, 0x12, 0xdd, 0xda, 0x9a, 0xaa, 0xf2, 0x06, 0x88, 0x52,
+    0x4a, 0xd9, 0xf6, 0xf5, 0x66, 0x29, 0x23, 0x79, 0xff, 0x46, 0x6e, 0xff, 0xf1, 0x51, 0xee, 0x2f,
+    0xa9, 0x6a, 0x7f, 0xb1, 0x6f, 0x79, 0xd7, 0xc8, 0x95, 0x1d, 0xe3, 0x2f, 0x10, 0xd9, 0x72, 0x7f,
+    0xb6, 0xe6, 0x5e, 0xdb, 0xc2, 0x27, 0xf1, 0x63, 0x3b, 0x9d, 0xc3, 0xb3, 0x08, 0x2f, 0xb3, 0x49,
+    0x9d, 0x74, 0xa5, 0x00, 0xca, 0x38, 0x49, 0xf1, 0xdd, 0xf7, 0x05, 0x2e, 0x7e, 0x11, 0xa9, 0xfd,
+    0x75, 0x74, 0x45, 0x00, 0x89, 0x17, 0x79, 0xc5, 0xad, 0x50, 0x4a, 0x0a, 0x16, 0x5f, 0x7b, 0x3c,
+    0xfb, 0x8e, 0x9e, 0x85, 0x3b, 0x82, 0x38, 0x12, 0xe8, 0xc3, 0x93, 0x1b, 0x24, 0xb3, 0xa5, 0xba,
+    0x90, 0xec, 0xa0, 0x54, 0x9a, 0x96, 0x69, 0x5e, 0x08, 0x1a, 0x5a, 0xfd, 0xb0, 0xb3, 0x0c, 0xf2,
+    0x45, 0xe2, 0x83, 0x37, 0x38, 0x3b, 0x3d, 0xbf, 0xe8, 0x0e, 0x76, 0xf0, 0x57, 0x01, 0xf6, 0x08,
+    0x91, 0x37, 0xaf, 0x5f, 0x9c, 0xc3, 0x32, 0xd3, 0x5b, 0x9c, 0xb9, 0xa9, 0xbb, 0xcc, 0x7a, 0x72,
+    0xb4, 0x7e, 0x39, 0x23, 0xdf, 0xb1, 0xdc, 0x29, 0x63, 0x5c, 0x1e, 0xf6, 0x7f, 0x90, 0x64, 0x8a,
+    0xc0, 0x16, 0x37, 0xbb, 0x8b, 0x18, 0xff, 0x0b, 0x76, 0x72, 0xb6, 0x57, 0xce, 0x59, 0xe1, 0x0a,
+    0xbd, 0x7f, 0xc9, 0xd1, 0xe6, 0x7a, 0xad, 0xb1, 0x9b, 0xfe, 0x21, 0x4a, 0xf1, 0xd3, 0x3f, 0xfd,
+    0x83, 0x1c, 0x1a, 0x0d, 0x84, 0x07, 0xa6, 0x4a, 0xe8, 0x7c, 0xa7, 0x57, 0x16, 0x9d, 0x2b, 0x21,
+    0xed, 0xfe, 0x47, 0x22, 0x42, 0x41, 0x94, 0x32, 0x78, 0xd5, 0xcb, 0xd6, 0xde, 0xb7, 0x52, 0x9c,
+    0xaf, 0x62, 0xea, 0x43, 0xba, 0x84, 0x30, 0x90, 0xea, 0x45, 0x0c, 0x4f, 0x2f, 0xf1, 0x50, 0x02,
+    0xf9, 0x3f, 0x62, 0x4f, 0x82, 0xab, 0xd0, 0x0b, 0x1a, 0xe1, 0xbc, 0x96, 0xc4, 0xd1, 0x6d, 0x4b,
+    0x4c, 0xaf, 0x77, 0x29, 0xd1, 0xb3, 0xb4, 0x89, 0x86, 0x8e, 0x71, 0x7c, 0x5a, 0x54, 0xec, 0x93,
+    0xb4, 0xe7, 0x5e, 0xbe, 0xe0, 0x83, 0x95, 0x4b, 0x59, 0xd1, 0xd0, 0xce, 0x8a, 0x2a, 0xe3, 0xad,
+    0x1a, 0xf5, 0xb9, 0xd0, 0xa9, 0xc8, 0xf9, 0x19, 0xe9, 0x0a, 0x66, 0x56, 0x79, 0xfc, 0xad, 0x5b,
+    0xf7, 0x57, 0x37, 0x21, 0xe4, 0xaa, 0xb6, 0xbd, 0x6f, 0xdc, 0xb7, 0x54, 0xdf, 0x49, 0x58, 0xf8,
+    0xf9, 0xf4, 0x8e, 0xfc, 0xbc, 0xf2, 0x0d, 0x87, 0xa5, 0xa7, 0xae, 0xbe, 0xcd, 0x31, 0xc8, 0x7f,
+    0x45, 0x40, 0x28, 0xa4, 0xc7, 0xa4, 0xbd, 0xda, 0xb8, 0x65, 0x5b, 0x6f, 0xa9, 0x1c, 0x27, 0x7f,
+    0x88, 0xff, 0x83, 0x8e, 0x98, 0xda, 0xb9, 0xac, 0xbb, 0x35, 0x8f, 0x03, 0xfe, 0x57, 0xf7, 0x68,
+    0xd5, 0x9c, 0x16, 0x3e, 0x28, 0x52, 0x96, 0xef, 0x71, 0xb4, 0xf8, 0xb5, 0x2c, 0xb1, 0x68, 0xd9,
+    0xbc, 0xde, 0x95, 0x3d, 0x37, 0xaf, 0x74, 0x71, 0xd9, 0x7e, 0xae, 0xae, 0x76, 0x95, 0x4b, 0xca,
+    0x89, 0xf7, 0x8e, 0xae, 0x90, 0x03, 0xc3, 0x8a, 0xb4, 0x60, 0xbe, 0x8e, 0xbd, 0xef, 0x32, 0xb6,
+    0xfd, 0x7d, 0x58, 0xb0, 0x98, 0xc5, 0xe3, 0x22, 0xfa, 0x95, 0x2f, 0x0a, 0x29, 0xf6, 0x78, 0x44,
+    0x31, 0xd8, 0x51, 0xe2, 0xbe, 0x3d, 0x25, 0xec, 0x03, 0xe6, 0x82, 0xd0, 0x8f, 0x72, 0x58, 0x55,
+    0x01, 0x7c, 0x58, 0x7b, 0x49, 0xf4, 0x11, 0xdb, 0xf7, 0x03, 0x70, 0x0f, 0x78, 0x1e, 0xb0, 0xa9,
+    0x9e, 0x5f, 0xc5, 0xaa, 0x20, 0x52, 0x90, 0xd6, 0xe7, 0x6b, 0xa4, 0x1c, 0x6f, 0x27, 0xa4, 0xa0,
+    0x6c, 0xbd, 0xba, 0x19, 0x0e, 0xe8, 0x36, 0x76, 0xbf, 0xdd, 0x3e, 0xa1, 0x23, 0x66, 0xb9, 0x27,
+    0x6b, 0xfe, 0x1b, 0x64, 0x2a, 0x1f, 0x69, 0xe5, 0x87, 0xfd, 0xc0, 0xac, 0xc4, 0x1b, 0x20, 0x1e,
+    0xed, 0x8a, 0x5f, 0xc2, 0xd9, 0x5d, 0xe4, 0xcb, 0xe8, 0x70, 0xe7, 0xff, 0x01, 0xaa, 0x85, 0xe9,
+    0xd7, 0xa8, 0x88, 0x00, 0x00,
+};
+
+#endif // SENSYTHING_DASHBOARD_H
@@ -9,45 +9,73 @@
 //////////////////////////////////////////////////////////////////////////////////////////
 
 #include "SensythingCap.h"
+#include "SensythingChannels.h"
 
-SensythingCap::SensythingCap() : SensythingCore() {
+// FDC_CONF fields
+#define FDC_CONF_RATE_SHIFT 10
+#define FDC_CONF_REPEAT     0x0100
+#define FDC_CONF_MEAS_ALL   0x00F0                // MEAS_1..MEAS_4 enable
+#define FDC_CONF_DONE_1     0x0008                // DONE_n = 0x0008 >> n
+
+// CONF_MEASn fields
+#define CONF_MEAS_CHA_SHIFT    13
+#define CONF_MEAS_CHB_CAPDAC   (0x4 << 10)        // Single-ended against the CAPDAC
+#define CONF_MEAS_CAPDAC_SHIFT 5
+
+// Re-range the CAPDAC when the result MSB leaves +/- half scale (as the FDC1004 library does)
+#define CAPDAC_UPPER_BOUND ((int16_t)0x4000)
+#define CAPDAC_LOWER_BOUND ((int16_t)-0x4000)
+
+#define CAPDAC_PF_PER_STEP 3.125f
+#define RESULT_LSB_PER_PF  524288.0f              // 24-bit result, 2^19 counts per pF
+
+// Constant descriptor; configureBoardConfig() copies it and applies the read mode
+const BoardConfig SensythingCap::BOARD_CONFIG = {
+    BOARD_TYPE_CAP,
+    "Sensything Cap",
+    "FDC1004 Capacitance",
+    CHANNELS,
+    SENSYTHING_CAP_CHANNELS,
+    true,                                         // CAPDAC columns
+    SENSYTHING_I2C_SDA, SENSYTHING_I2C_SCL,       // I2C
+    -1, -1, -1, -1,                               // SPI not used
+    SENSYTHING_CAP_PIPELINED_MIN_INTERVAL_MS,
+    SENSYTHING_MAX_SAMPLE_INTERVAL_MS
+};
+
+SensythingCap::SensythingCap() : SensythingCoreT() {
     capSensor = nullptr;
+    pipelineRequested = true;
+    pipelineActive = false;
+    rateCode = 0;
+    rateInterval = 0;
+    memset(capdac, 0, sizeof(capdac));
+    slotTimeouts = 0;
+    memset(&splitData, 0, sizeof(MeasurementData));
+    splitPending = 0;
+    splitStartUs = 0;
+    splitTimeoutUs = 0;
     configureBoardConfig();
 }
 
 SensythingCap::~SensythingCap() {
+    // The acquisition task calls readSample(); stop it while this object is intact
+    enableThreadedAcquisition(false);
+    
     if (capSensor) {
+        if (pipelineActive) {
+            stopRepeatMode();
+        }
         delete capSensor;
     }
 }
 
 void SensythingCap::configureBoardConfig() {
-    boardConfig.boardType = BOARD_TYPE_CAP;
-    boardConfig.boardName = "Sensything Cap";
-    boardConfig.sensorType = "FDC1004 Capacitance";
-    boardConfig.channelCount = 4;
-    
-    // Configure channel information
-    for (int i = 0; i < 4; i++) {
-        snprintf(boardConfig.channels[i].label, SENSYTHING_MAX_LABEL_LEN, 
-                "ch%d_pf", i);
-        snprintf(boardConfig.channels[i].unit, 16, "pF");
-        boardConfig.channels[i].minValue = -100.0;
-        boardConfig.channels[i].maxValue = 100.0;
-        boardConfig.channels[i].active = true;
-    }
-    
-    // Pin configuration
-    boardConfig.i2c_sda = SENSYTHING_I2C_SDA;
-    boardConfig.i2c_scl = SENSYTHING_I2C_SCL;
-    boardConfig.spi_cs = -1;  // Not used
-    boardConfig.spi_mosi = -1;
-    boardConfig.spi_miso = -1;
-    boardConfig.spi_sck = -1;
+    boardConfig = BOARD_CONFIG;
     
-    // Sample rate limits
-    boardConfig.minSampleInterval = SENSYTHING_MIN_SAMPLE_INTERVAL_MS;
-    boardConfig.maxSampleInterval = SENSYTHING_MAX_SAMPLE_INTERVAL_MS;
+    // Sample rate limit (a 4-channel read must fit in one interval)
+    boardConfig.minSampleInterval = pipelineRequested ?
+        SENSYTHING_CAP_PIPELINED_MIN_INTERVAL_MS : SENSYTHING_CAP_SEQUENTIAL_MIN_INTERVAL_MS;
 }
 
 bool SensythingCap::initSensor() {
@@ -74,15 +102,26 @@ bool SensythingCap::initSensor() {
     return true;
 }
 
-bool SensythingCap::readMeasurement(MeasurementData& data) {
+bool SensythingCap::readSample(MeasurementData& data) {
     if (!capSensor) {
         DEBUG_PRINTLN("Sensor not initialized");
         return false;
     }
     
+    // Mode changes are applied here so the bus is only used from one context
+    if (pipelineRequested) {
+        return readPipelined(data);
+    }
+    if (pipelineActive) {
+        stopRepeatMode();
+    }
+    return readSequential(data);
+}
+
+bool SensythingCap::readSequential(MeasurementData& data) {
     // Initialize measurement data
     data.timestamp = millis();
-    data.channel_count = 4;
+    data.channel_count = CHANNELS;
     data.status_flags = 0;
     
     // Read all 4 channels
@@ -90,6 +129,7 @@ bool SensythingCap::readMeasurement(MeasurementData& data) {
         fdc1004_capacitance_t measurement = capSensor->getCapacitanceMeasurement(
             static_cast<fdc1004_channel_t>(FDC1004_CHANNEL_0 + i)
         );
+        data.channel_time_us[i] = (uint32_t)esp_timer_get_time();
         
         // Check if measurement is valid
         if (!isnan(measurement.capacitance_pf)) {
@@ -113,14 +153,223 @@ bool SensythingCap::readMeasurement(MeasurementData& data) {
     return true;
 }
 
-String SensythingCap::getBoardName() {
-    return boardConfig.boardName;
+// =================================================================================================
+// PIPELINED (REPEAT MODE) ACQUISITION
+// =================================================================================================
+
+bool SensythingCap::readPipelined(MeasurementData& data) {
+    if (!startMeasurement()) {
+        return false;
+    }
+    while (!isMeasurementReady()) {
+        delay(1);  // Let WiFi/BLE run while the remaining slots convert
+    }
+    return collectMeasurement(data);
+}
+
+bool SensythingCap::startMeasurement() {
+    if (!capSensor || !pipelineRequested) {
+        return false;
+    }
+    if (!pipelineActive || rateInterval != getAcquisitionIntervalUs() / 1000) {
+        if (!startRepeatMode()) {
+            return false;
+        }
+    }
+    
+    splitData.timestamp = millis();
+    splitData.channel_count = CHANNELS;
+    splitData.status_flags = 0;
+    
+    // One round converts all four slots back to back. When the interval is at
+    // least a round long every slot is already done and nothing waits.
+    splitTimeoutUs = 2 * 4 * 1000000LL / getConversionRate();
+    splitStartUs = esp_timer_get_time();
+    splitPending = 0x0F;
+    return true;
+}
+
+bool SensythingCap::isMeasurementReady() {
+    if (!splitPending) {
+        return true;
+    }
+    
+    uint16_t conf;
+    if (!readRegister(REG_FDC_CONF, conf)) {
+        return true;  // Remaining slots are reported as failed
+    }
+    int64_t nowUs = esp_timer_get_time();
+    
+    for (uint8_t ch = 0; ch < 4; ch++) {
+        if ((splitPending & (1 << ch)) && (conf & (FDC_CONF_DONE_1 >> ch))) {
+            readSlot(ch, splitData, (uint32_t)nowUs);
+            splitPending &= ~(1 << ch);
+        }
+    }
+    
+    return !splitPending || nowUs - splitStartUs > splitTimeoutUs;
+}
+
+bool SensythingCap::collectMeasurement(MeasurementData& data) {
+    for (uint8_t ch = 0; ch < 4; ch++) {
+        if (splitPending & (1 << ch)) {
+            splitData.channels[ch] = 0.0;
+            splitData.metadata[ch] = capdac[ch];
+            splitData.channel_time_us[ch] = 0;
+            splitData.status_flags |= (1 << ch);
+            slotTimeouts++;
+        }
+    }
+    splitPending = 0;
+    
+    data = splitData;
+    return true;
+}
+
+void SensythingCap::readSlot(uint8_t channel, MeasurementData& data, uint32_t timeUs) {
+    uint16_t msb, lsb;
+    if (!readRegister(REG_MEAS_MSB + 2 * channel, msb) ||
+        !readRegister(REG_MEAS_MSB + 2 * channel + 1, lsb)) {
+        data.channels[channel] = 0.0;
+        data.metadata[channel] = capdac[channel];
+        data.channel_time_us[channel] = 0;
+        data.status_flags |= (1 << channel);
+        return;
+    }
+    
+    // 24-bit two's complement result in MSB[15:0]:LSB[15:8]
+    int32_t raw = (int32_t)(((uint32_t)msb << 16) | lsb) >> 8;
+    data.channels[channel] = raw / RESULT_LSB_PER_PF + capdac[channel] * CAPDAC_PF_PER_STEP;
+    data.metadata[channel] = capdac[channel];
+    data.channel_time_us[channel] = timeUs;
+    
+    // Track the input with the CAPDAC; the new offset applies from the next conversion
+    int16_t level = (int16_t)msb;
+    uint8_t next = capdac[channel];
+    if (level > CAPDAC_UPPER_BOUND && next < SENSYTHING_CAP_CAPDAC_MAX) {
+        next++;
+    } else if (level < CAPDAC_LOWER_BOUND && next > 0) {
+        next--;
+    }
+    if (next != capdac[channel]) {
+        capdac[channel] = next;
+        writeRegister(REG_CONF_MEAS + channel,
+                      (channel << CONF_MEAS_CHA_SHIFT) | CONF_MEAS_CHB_CAPDAC | (next << CONF_MEAS_CAPDAC_SHIFT));
+        data.status_flags |= SENSYTHING_STATUS_CAPDAC_ADJ;
+    }
+}
+
+bool SensythingCap::startRepeatMode() {
+    // Slowest rate (lowest noise) whose four-slot round fits in the interval
+    unsigned long interval = getAcquisitionIntervalUs() / 1000;  // Oversampling reads faster than the sample interval
+    uint8_t code;
+    if (interval >= 40) {
+        code = 1;   // 100 S/s, 40 ms per round
+    } else if (interval >= 20) {
+        code = 2;   // 200 S/s, 20 ms per round
+    } else {
+        code = 3;   // 400 S/s, 10 ms per round
+    }
+    
+    for (uint8_t ch = 0; ch < 4; ch++) {
+        uint16_t conf = (ch << CONF_MEAS_CHA_SHIFT) | CONF_MEAS_CHB_CAPDAC | (capdac[ch] << CONF_MEAS_CAPDAC_SHIFT);
+        if (!writeRegister(REG_CONF_MEAS + ch, conf)) {
+            Serial.println(String(EMOJI_ERROR) + " FDC1004 slot configuration failed");
+            return false;
+        }
+    }
+    if (!writeRegister(REG_FDC_CONF, (code << FDC_CONF_RATE_SHIFT) | FDC_CONF_REPEAT | FDC_CONF_MEAS_ALL)) {
+        Serial.println(String(EMOJI_ERROR) + " FDC1004 repeat mode start failed");
+        return false;
+    }
+    
+    rateCode = code;
+    rateInterval = interval;
+    pipelineActive = true;
+    DEBUG_PRINTF("FDC1004 repeat mode at %u S/s\n", getConversionRate());
+    return true;
+}
+
+void SensythingCap::stopRepeatMode() {
+    writeRegister(REG_FDC_CONF, 0);
+    pipelineActive = false;
+    rateCode = 0;
+}
+
+uint16_t SensythingCap::getConversionRate() const {
+    switch (rateCode) {
+        case 1: return 100;
+        case 2: return 200;
+        case 3: return 400;
+        default: return 0;
+    }
 }
 
-String SensythingCap::getSensorType() {
-    return boardConfig.sensorType;
+void SensythingCap::setPipelined(bool enable) {
+    pipelineRequested = enable;
+    configureBoardConfig();
+    
+    // Sequential reads take ~40 ms; do not leave the timer asking for more.
+    // setSampleRate() also lowers the oversampling to fit.
+    if (getAcquisitionIntervalUs() < boardConfig.minSampleInterval * 1000UL) {
+        setSampleRate(max(sysState.sampleInterval, boardConfig.minSampleInterval));
+    }
+}
+
+// =================================================================================================
+// REGISTER ACCESS
+// =================================================================================================
+
+bool SensythingCap::writeRegister(uint8_t reg, uint16_t value) {
+    Wire.beginTransmission(SENSYTHING_CAP_I2C_ADDRESS);
+    Wire.write(reg);
+    Wire.write((uint8_t)(value >> 8));
+    Wire.write((uint8_t)(value & 0xFF));
+    return Wire.endTransmission() == 0;
+}
+
+bool SensythingCap::readRegister(uint8_t reg, uint16_t& value) {
+    Wire.beginTransmission(SENSYTHING_CAP_I2C_ADDRESS);
+    Wire.write(reg);
+    if (Wire.endTransmission(false) != 0) {
+        return false;
+    }
+    if (Wire.requestFrom((uint8_t)SENSYTHING_CAP_I2C_ADDRESS, (size_t)2) != 2) {
+        return false;
+    }
+    value = (uint16_t)(Wire.read() << 8);
+    value |= (uint16_t)Wire.read();
+    return true;
+}
+
+// =================================================================================================
+// BOARD HOOKS
+// =================================================================================================
+
+bool SensythingCap::handleBoardCommand(const String& command) {
+    if (command == "cap_mode pipelined") {
+        setPipelined(true);
+        Serial.println(String(EMOJI_SUCCESS) + " FDC1004 pipelined (repeat mode)");
+        return true;
+    }
+    if (command == "cap_mode sequential") {
+        setPipelined(false);
+        Serial.println(String(EMOJI_SUCCESS) + " FDC1004 sequential (one conversion per channel)");
+        return true;
+    }
+    return false;
+}
+
+void SensythingCap::printBoardStatus() {
+    if (pipelineActive) {
+        Serial.printf("%s FDC1004: pipelined at %u S/s per slot, %u slot timeouts\n", EMOJI_DATA,
+                     getConversionRate(), slotTimeouts);
+    } else {
+        Serial.printf("%s FDC1004: %s\n", EMOJI_DATA,
+                     pipelineRequested ? "pipelined (starts with the next read)" : "sequential at 100 S/s");
+    }
 }
 
-BoardConfig SensythingCap::getBoardConfig() {
-    return boardConfig;
+void SensythingCap::printBoardHelp() {
+    Serial.println("cap_mode <mode> - FDC1004 conversion: pipelined | sequential");
 }
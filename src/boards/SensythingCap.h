@@ -13,27 +13,120 @@
 
 #include <Wire.h>
 #include <Protocentral_FDC1004.h>
-#include "../core/SensythingCore.h"
+#include "../core/SensythingCoreT.h"
 
-class SensythingCap : public SensythingCore {
+#define SENSYTHING_CAP_I2C_ADDRESS 0x50
+#define SENSYTHING_CAP_PIPELINED_MIN_INTERVAL_MS 10   // Four conversions at 400 S/s
+#define SENSYTHING_CAP_SEQUENTIAL_MIN_INTERVAL_MS 40  // Four triggered conversions at 100 S/s
+#define SENSYTHING_CAP_CAPDAC_MAX 31                  // 5-bit CAPDAC, 3.125 pF per step
+
+class SensythingCap : public SensythingCoreT<SensythingCap> {
 public:
     SensythingCap();
     ~SensythingCap();
     
+    static const uint8_t CHANNELS = 4;
+    
     // Implement pure virtual methods from SensythingCore
     bool initSensor() override;
-    bool readMeasurement(MeasurementData& data) override;
-    String getBoardName() override;
-    String getSensorType() override;
-    BoardConfig getBoardConfig() override;
     
+    // Sensor read, called by SensythingCoreT without virtual dispatch
+    bool readSample(MeasurementData& data);
+    
+    // Optional board hooks
+    bool isSplitPhase() override { return pipelineRequested; }
+    bool startMeasurement() override;
+    bool isMeasurementReady() override;
+    bool collectMeasurement(MeasurementData& data) override;
+    bool handleBoardCommand(const String& command) override;
+    void printBoardStatus() override;
+    void printBoardHelp() override;
+    
+    /**
+     * Select pipelined or sequential conversion
+     *
+     * Pipelined (default): all four measurement slots are programmed once and
+     * the FDC1004 converts them continuously in repeat mode. A read only fetches
+     * slots whose DONE bit is set, and the conversion rate (100/200/400 S/s)
+     * follows the sample interval, so 4-channel capture runs down to
+     * SENSYTHING_CAP_PIPELINED_MIN_INTERVAL_MS.
+     *
+     * Sequential: every channel is triggered and waited for in turn through the
+     * FDC1004 library at 100 S/s (about 40 ms per 4-channel read).
+     *
+     * Only pipelined mode supports the split-phase read, so update() polls the
+     * DONE bits between sink passes rather than waiting inside readSample().
+     * @param enable true for pipelined, false for sequential
+     */
+    void setPipelined(bool enable);
+    
+    bool isPipelined() const { return pipelineRequested; }
+    
+    /**
+     * Conversion rate currently programmed in pipelined mode
+     * @return Samples per second per measurement slot (0 if not running)
+     */
+    uint16_t getConversionRate() const;
+
 private:
     FDC1004* capSensor;
     
+    // Pipelined (repeat mode) state; applied from readSample() so all
+    // I2C traffic stays in the acquisition context
+    volatile bool pipelineRequested;
+    bool pipelineActive;
+    uint8_t rateCode;                            // FDC_CONF RATE field (1-3), 0 = not programmed
+    unsigned long rateInterval;                  // Sample interval the rate was chosen for
+    uint8_t capdac[4];
+    uint32_t slotTimeouts;                       // Slots not done within two conversion rounds
+    
+    // Split-phase read in flight: slots still converting and the partial result
+    MeasurementData splitData;
+    uint8_t splitPending;
+    int64_t splitStartUs;
+    int64_t splitTimeoutUs;
+    
+    // FDC1004 registers
+    static const uint8_t REG_MEAS_MSB  = 0x00;   // MEASn_MSB = 2n, MEASn_LSB = 2n + 1
+    static const uint8_t REG_CONF_MEAS = 0x08;   // CONF_MEASn = 0x08 + n
+    static const uint8_t REG_FDC_CONF  = 0x0C;
+    
+    static const BoardConfig BOARD_CONFIG;
+    
     /**
      * Configure board-specific settings
      */
     void configureBoardConfig();
+    
+    /**
+     * Read all channels through the library, one triggered conversion at a time
+     */
+    bool readSequential(MeasurementData& data);
+    
+    /**
+     * Blocking split-phase read: start, wait for the slots not yet done, collect
+     */
+    bool readPipelined(MeasurementData& data);
+    
+    /**
+     * Program the measurement slots and start repeat mode at the rate that fits
+     * the current sample interval
+     * @return true if the sensor accepted the configuration
+     */
+    bool startRepeatMode();
+    
+    /**
+     * Stop repeat mode so the library can trigger single conversions again
+     */
+    void stopRepeatMode();
+    
+    /**
+     * Fetch one slot's result and track its CAPDAC
+     */
+    void readSlot(uint8_t channel, MeasurementData& data, uint32_t timeUs);
+    
+    bool writeRegister(uint8_t reg, uint16_t value);
+    bool readRegister(uint8_t reg, uint16_t& value);
 };
 
 #endif // SENSYTHING_CAP_H
@@ -0,0 +1,26 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Platform - Channel Tables
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#include "SensythingChannels.h"
+
+// FDC1004: four single-ended capacitance channels
+const ChannelInfo SENSYTHING_CAP_CHANNELS[4] = {
+    {"ch0_pf", "pF", -100.0f, 100.0f, true},
+    {"ch1_pf", "pF", -100.0f, 100.0f, true},
+    {"ch2_pf", "pF", -100.0f, 100.0f, true},
+    {"ch3_pf", "pF", -100.0f, 100.0f, true}
+};
+
+// AFE4400: raw IR/RED PPG (19-bit ADC) and the derived SpO2 and heart rate
+const ChannelInfo SENSYTHING_OX_CHANNELS[4] = {
+    {"ir_raw",     "ADC", 0.0f, 524288.0f, true},
+    {"red_raw",    "ADC", 0.0f, 524288.0f, true},
+    {"spo2",       "%",   0.0f, 100.0f,    true},
+    {"heart_rate", "bpm", 0.0f, 250.0f,    true}
+};
@@ -0,0 +1,21 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Platform - Channel Tables
+//    Constant channel descriptions shared by the boards that produce each layout
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SENSYTHING_CHANNELS_H
+#define SENSYTHING_CHANNELS_H
+
+#include "../core/SensythingTypes.h"
+
+// Defined once in SensythingChannels.cpp so every BoardConfig points at the
+// same flash-resident table instead of carrying its own copy
+extern const ChannelInfo SENSYTHING_CAP_CHANNELS[4];   // Sensything Cap and Sim (Cap)
+extern const ChannelInfo SENSYTHING_OX_CHANNELS[4];    // Sensything OX and Sim (OX)
+
+#endif // SENSYTHING_CHANNELS_H
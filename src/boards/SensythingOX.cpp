@@ -9,13 +9,59 @@
 //////////////////////////////////////////////////////////////////////////////////////////
 
 #include "SensythingOX.h"
+#include "SensythingChannels.h"
+#include <esp_heap_caps.h>
 
-SensythingOX::SensythingOX() : SensythingCore() {
+// Constant descriptor; configureBoardConfig() copies it into the core
+const BoardConfig SensythingOX::BOARD_CONFIG = {
+    BOARD_TYPE_OX,
+    "Sensything OX",
+    "AFE4400 PPG/SpO2",
+    CHANNELS,
+    SENSYTHING_OX_CHANNELS,
+    false,
+    -1, -1,                                       // I2C not used
+    PIN_SPI_CS, SENSYTHING_SPI_MOSI, SENSYTHING_SPI_MISO, SENSYTHING_SPI_SCK,
+    8,                                            // 125Hz maximum (AFE4400 typically runs at ~125Hz)
+    10000                                         // 0.1Hz minimum
+};
+
+SensythingOX::SensythingOX() : SensythingCoreT() {
     ppgSensor = nullptr;
+    drdyMode = false;
+    drdyStopRequested = false;
+    drdyTaskHandle = nullptr;
+    drdyTaskExited = nullptr;
+    drdyTimestampUs = 0;
+    drdyConversions = 0;
+    drdyOverruns = 0;
+    burstRequested = false;
+    burstActive = false;
+    burstDevice = nullptr;
+    memset(burstTransactions, 0, sizeof(burstTransactions));
+    burstTx = nullptr;
+    burstRx = nullptr;
+    burstPending = 0;
+    burstTimestamp = 0;
+    burstCycles = 0;
+    memset(&rawSample, 0, sizeof(SensythingOXRawSample));
+    readCycles = 0;
+    readCount = 0;
     configureBoardConfig();
 }
 
 SensythingOX::~SensythingOX() {
+    // The acquisition task calls readSample(); stop it while this object is intact
+    enableThreadedAcquisition(false);
+    enableDataReadyMode(false);
+    
+    if (burstActive) {
+        stopBurstReader();
+    }
+    if (burstTx) heap_caps_free(burstTx);
+    if (burstRx) heap_caps_free(burstRx);
+    if (drdyTaskExited) vSemaphoreDelete(drdyTaskExited);
+    
     if (ppgSensor) {
         delete ppgSensor;
         ppgSensor = nullptr;
@@ -23,59 +69,12 @@ SensythingOX::~SensythingOX() {
 }
 
 void SensythingOX::configureBoardConfig() {
-    boardConfig.boardType = BOARD_TYPE_OX;
-    boardConfig.boardName = "Sensything OX";
-    boardConfig.sensorType = "AFE4400 PPG/SpO2";
-    boardConfig.channelCount = 4;
-    
-    // Configure channel information
-    // Channel 0: IR PPG raw data
-    snprintf(boardConfig.channels[0].label, SENSYTHING_MAX_LABEL_LEN, "ir_raw");
-    snprintf(boardConfig.channels[0].unit, 16, "ADC");
-    boardConfig.channels[0].minValue = 0.0;
-    boardConfig.channels[0].maxValue = 524288.0;  // 19-bit ADC
-    boardConfig.channels[0].active = true;
-    
-    // Channel 1: RED PPG raw data
-    snprintf(boardConfig.channels[1].label, SENSYTHING_MAX_LABEL_LEN, "red_raw");
-    snprintf(boardConfig.channels[1].unit, 16, "ADC");
-    boardConfig.channels[1].minValue = 0.0;
-    boardConfig.channels[1].maxValue = 524288.0;  // 19-bit ADC
-    boardConfig.channels[1].active = true;
-    
-    // Channel 2: SpO2 percentage
-    snprintf(boardConfig.channels[2].label, SENSYTHING_MAX_LABEL_LEN, "spo2");
-    snprintf(boardConfig.channels[2].unit, 16, "%%");
-    boardConfig.channels[2].minValue = 0.0;
-    boardConfig.channels[2].maxValue = 100.0;
-    boardConfig.channels[2].active = true;
-    
-    // Channel 3: Heart Rate
-    snprintf(boardConfig.channels[3].label, SENSYTHING_MAX_LABEL_LEN, "heart_rate");
-    snprintf(boardConfig.channels[3].unit, 16, "bpm");
-    boardConfig.channels[3].minValue = 0.0;
-    boardConfig.channels[3].maxValue = 250.0;
-    boardConfig.channels[3].active = true;
-    
-    // Pin configuration (SPI-based)
-    boardConfig.i2c_sda = -1;  // Not used
-    boardConfig.i2c_scl = -1;  // Not used
-    boardConfig.spi_cs = PIN_SPI_CS;
-    boardConfig.spi_mosi = SENSYTHING_SPI_MOSI;
-    boardConfig.spi_miso = SENSYTHING_SPI_MISO;
-    boardConfig.spi_sck = SENSYTHING_SPI_SCK;
-    
-    // Sample rate limits (AFE4400 typically runs at ~125Hz)
-    boardConfig.minSampleInterval = 8;     // 125Hz maximum (8ms period)
-    boardConfig.maxSampleInterval = 10000;  // 0.1Hz minimum
+    boardConfig = BOARD_CONFIG;
 }
 
 bool SensythingOX::initSensor() {
     // Initialize SPI
-    SPI.begin(boardConfig.spi_sck, boardConfig.spi_miso, boardConfig.spi_mosi, boardConfig.spi_cs);
-    SPI.setBitOrder(MSBFIRST);
-    SPI.setDataMode(SPI_MODE0);
-    SPI.setFrequency(4000000);  // 4 MHz
+    beginLibrarySPI();
     
     // Create AFE44XX sensor instance (published library only takes CS and PWDN pins)
     ppgSensor = new AFE44XX(PIN_SPI_CS, PIN_AFE_PWDN);
@@ -87,68 +86,469 @@ bool SensythingOX::initSensor() {
     return true;
 }
 
-bool SensythingOX::readMeasurement(MeasurementData& data) {
+bool SensythingOX::readSample(MeasurementData& data) {
     if (!ppgSensor) {
         DEBUG_PRINTLN("Sensor not initialized");
         return false;
     }
     
+    // DRDY mode: hand out the next buffered conversion
+    if (drdyMode) {
+        return drdyBuffer.pop(data);
+    }
+    
+    return readConversion(data, millis());
+}
+
+bool SensythingOX::readConversion(MeasurementData& data, uint32_t timestamp) {
+    applyReadPath();
+    
+    if (burstActive) {
+        uint32_t start = ESP.getCycleCount();
+        if (!queueBurst()) {
+            drainBurst();
+            return false;
+        }
+        burstCycles = ESP.getCycleCount() - start;
+        
+        // The task blocks here while the DMA clocks the frames out
+        if (!fetchBurst(portMAX_DELAY)) {
+            return false;
+        }
+        fillBurstMeasurement(data, timestamp);
+        return true;
+    }
+    
     // Get data from AFE4400
+    uint32_t start = ESP.getCycleCount();
     if (!ppgSensor->get_AFE44XX_Data(&rawData)) {
         DEBUG_PRINTLN("Failed to read AFE4400 data");
         return false;
     }
+    readCycles += ESP.getCycleCount() - start;
+    readCount++;
     
+    fillMeasurement(rawData, data, timestamp);
+    return true;
+}
+
+void SensythingOX::fillMeasurement(const afe44xx_data& raw, MeasurementData& data, uint32_t timestamp) {
     // Initialize measurement data
-    data.timestamp = millis();
-    data.channel_count = 4;
+    data.timestamp = timestamp;
+    data.channel_count = CHANNELS;
     data.status_flags = 0;
     
     // Fill channel data
     // Channel 0: IR raw ADC value
-    data.channels[0] = (float)rawData.IR_data;
+    data.channels[0] = (float)raw.IR_data;
     
     // Channel 1: RED raw ADC value
-    data.channels[1] = (float)rawData.RED_data;
+    data.channels[1] = (float)raw.RED_data;
     
     // Channel 2: SpO2 percentage (0-100%)
-    data.channels[2] = (float)rawData.spo2;
+    data.channels[2] = (float)raw.spo2;
     
     // Channel 3: Heart rate (bpm)
-    data.channels[3] = (float)rawData.heart_rate;
+    data.channels[3] = (float)raw.heart_rate;
     
     // Status flags
-    if (rawData.buffer_count_overflow) {
+    if (raw.buffer_count_overflow) {
         data.status_flags |= SENSYTHING_STATUS_BUFFER_OVERFLOW;
     }
     
     // Check for invalid heart rate (typically 0 or >250 indicates no signal)
-    if (rawData.heart_rate == 0 || rawData.heart_rate > 250) {
+    if (raw.heart_rate == 0 || raw.heart_rate > 250) {
         data.status_flags |= SENSYTHING_STATUS_NO_SIGNAL;
     }
     
     // Check for invalid SpO2 (typically <70% or >100% indicates error)
-    if (rawData.spo2 < 70.0 || rawData.spo2 > 100.0) {
+    if (raw.spo2 < 70.0 || raw.spo2 > 100.0) {
         data.status_flags |= SENSYTHING_STATUS_INVALID_DATA;
     }
     
     // Metadata: Store quality indicators
-    data.metadata[0] = (uint8_t)(rawData.spo2);  // SpO2 as byte
-    data.metadata[1] = (uint8_t)(rawData.heart_rate);  // HR as byte
-    data.metadata[2] = rawData.buffer_count_overflow ? 1 : 0;
+    data.metadata[0] = (uint8_t)(raw.spo2);  // SpO2 as byte
+    data.metadata[1] = (uint8_t)(raw.heart_rate);  // HR as byte
+    data.metadata[2] = raw.buffer_count_overflow ? 1 : 0;
     data.metadata[3] = 0;  // Reserved
+}
+
+// =================================================================================================
+// BURST (DMA) READ PATH
+// =================================================================================================
+
+void SensythingOX::setBurstRead(bool enable) {
+    burstRequested = enable;
+}
+
+float SensythingOX::getReadCpuTimeUs() const {
+    if (readCount == 0) {
+        return 0.0f;
+    }
+    return (float)(readCycles / readCount) / ESP.getCpuFreqMHz();
+}
+
+void SensythingOX::beginLibrarySPI() {
+    SPI.begin(boardConfig.spi_sck, boardConfig.spi_miso, boardConfig.spi_mosi, boardConfig.spi_cs);
+    SPI.setBitOrder(MSBFIRST);
+    SPI.setDataMode(SPI_MODE0);
+    SPI.setFrequency(SENSYTHING_OX_SPI_CLOCK_HZ);
+}
+
+void SensythingOX::applyReadPath() {
+    if (burstRequested == burstActive) {
+        return;
+    }
+    
+    // Figures are per path, so before/after can be compared in 'status'
+    readCycles = 0;
+    readCount = 0;
+    
+    if (!burstRequested) {
+        stopBurstReader();
+        return;
+    }
+    if (!startBurstReader()) {
+        burstRequested = false;
+        Serial.println(String(EMOJI_ERROR) + " AFE4400 burst read unavailable, using the library");
+    }
+}
+
+bool SensythingOX::startBurstReader() {
+    if (!burstTx) {
+        burstTx = (uint8_t*)heap_caps_malloc(4 * 4, MALLOC_CAP_DMA);
+        burstRx = (uint8_t*)heap_caps_malloc(4 * 4, MALLOC_CAP_DMA);
+        if (!burstTx || !burstRx) {
+            return false;
+        }
+    }
+    
+    // The Arduino driver and spi_master cannot share the peripheral
+    SPI.end();
+    
+    spi_bus_config_t bus = {};
+    bus.mosi_io_num = boardConfig.spi_mosi;
+    bus.miso_io_num = boardConfig.spi_miso;
+    bus.sclk_io_num = boardConfig.spi_sck;
+    bus.quadwp_io_num = -1;
+    bus.quadhd_io_num = -1;
+    bus.max_transfer_sz = 4 * 4;
+    if (spi_bus_initialize(SENSYTHING_OX_BURST_SPI_HOST, &bus, SPI_DMA_CH_AUTO) != ESP_OK) {
+        beginLibrarySPI();
+        return false;
+    }
     
+    spi_device_interface_config_t device = {};
+    device.mode = 0;
+    device.clock_speed_hz = SENSYTHING_OX_BURST_SPI_CLOCK_HZ;
+    device.spics_io_num = PIN_SPI_CS;
+    device.queue_size = 4;
+    if (spi_bus_add_device(SENSYTHING_OX_BURST_SPI_HOST, &device, &burstDevice) != ESP_OK) {
+        spi_bus_free(SENSYTHING_OX_BURST_SPI_HOST);
+        beginLibrarySPI();
+        return false;
+    }
+    
+    // Leave register reads enabled for as long as this path owns the bus; the
+    // library writes CONTROL0 itself before its next access
+    spi_transaction_t control = {};
+    control.flags = SPI_TRANS_USE_TXDATA;
+    control.length = 32;
+    control.tx_data[0] = REG_CONTROL0;
+    control.tx_data[1] = (CONTROL0_SPI_READ >> 16) & 0xFF;
+    control.tx_data[2] = (CONTROL0_SPI_READ >> 8) & 0xFF;
+    control.tx_data[3] = CONTROL0_SPI_READ & 0xFF;
+    spi_device_polling_transmit(burstDevice, &control);
+    
+    // One 32-bit frame per register: the address byte, then 24 data bits.
+    // The AFE4400 does not auto-increment, so each frame is its own transaction.
+    memset(burstTx, 0, 4 * 4);
+    for (uint8_t i = 0; i < 4; i++) {
+        burstTx[4 * i] = REG_LED2VAL + i;
+        memset(&burstTransactions[i], 0, sizeof(spi_transaction_t));
+        burstTransactions[i].length = 32;
+        burstTransactions[i].tx_buffer = &burstTx[4 * i];
+        burstTransactions[i].rx_buffer = &burstRx[4 * i];
+    }
+    
+    burstPending = 0;
+    burstActive = true;
+    Serial.printf("%s AFE4400 burst read at %d MHz\n", EMOJI_SUCCESS, SENSYTHING_OX_BURST_SPI_CLOCK_HZ / 1000000);
     return true;
 }
 
-String SensythingOX::getBoardName() {
-    return boardConfig.boardName;
+void SensythingOX::stopBurstReader() {
+    if (!burstActive) {
+        return;
+    }
+    drainBurst();
+    spi_bus_remove_device(burstDevice);
+    spi_bus_free(SENSYTHING_OX_BURST_SPI_HOST);
+    burstDevice = nullptr;
+    burstActive = false;
+    
+    // The spi_master driver routed CS to the peripheral; the library drives it as a GPIO
+    beginLibrarySPI();
+    pinMode(PIN_SPI_CS, OUTPUT);
+    digitalWrite(PIN_SPI_CS, HIGH);
+}
+
+bool SensythingOX::queueBurst() {
+    for (uint8_t i = 0; i < 4; i++) {
+        if (spi_device_queue_trans(burstDevice, &burstTransactions[i], 0) != ESP_OK) {
+            return false;
+        }
+        burstPending++;
+    }
+    return true;
 }
 
-String SensythingOX::getSensorType() {
-    return boardConfig.sensorType;
+bool SensythingOX::fetchBurst(TickType_t wait) {
+    // Results come back in queue order
+    while (burstPending) {
+        spi_transaction_t* done;
+        if (spi_device_get_trans_result(burstDevice, &done, wait) != ESP_OK) {
+            return false;
+        }
+        burstPending--;
+    }
+    return true;
+}
+
+void SensythingOX::drainBurst() {
+    if (burstActive) {
+        fetchBurst(portMAX_DELAY);
+    }
+}
+
+void SensythingOX::fillBurstMeasurement(MeasurementData& data, uint32_t timestamp) {
+    uint32_t start = ESP.getCycleCount();
+    
+    int32_t values[4];
+    for (uint8_t i = 0; i < 4; i++) {
+        const uint8_t* frame = &burstRx[4 * i];
+        uint32_t value = ((uint32_t)frame[1] << 16) | ((uint32_t)frame[2] << 8) | frame[3];
+        values[i] = (int32_t)(value << 10) >> 10;  // 22-bit two's complement
+    }
+    rawSample.led2 = values[0];
+    rawSample.aled2 = values[1];
+    rawSample.led1 = values[2];
+    rawSample.aled1 = values[3];
+    
+    data.timestamp = timestamp;
+    data.channel_count = CHANNELS;
+    data.status_flags = 0;
+    data.channels[0] = (float)rawSample.led1;  // IR
+    data.channels[1] = (float)rawSample.led2;  // RED
+    data.channels[2] = 0.0;                    // SpO2 and heart rate need the library
+    data.channels[3] = 0.0;
+    memset(data.metadata, 0, sizeof(data.metadata));
+    
+    readCycles += burstCycles + (ESP.getCycleCount() - start);
+    readCount++;
+}
+
+bool SensythingOX::startMeasurement() {
+    if (!ppgSensor || drdyMode) {
+        return false;
+    }
+    applyReadPath();
+    if (!burstActive) {
+        return false;
+    }
+    
+    uint32_t start = ESP.getCycleCount();
+    burstTimestamp = millis();
+    bool queued = queueBurst();
+    burstCycles = ESP.getCycleCount() - start;
+    if (!queued) {
+        drainBurst();
+    }
+    return queued;
+}
+
+bool SensythingOX::isMeasurementReady() {
+    uint32_t start = ESP.getCycleCount();
+    if (burstActive) {
+        fetchBurst(0);
+    }
+    burstCycles += ESP.getCycleCount() - start;
+    return burstPending == 0;
+}
+
+bool SensythingOX::collectMeasurement(MeasurementData& data) {
+    // DRDY mode may have been enabled while the read was in flight
+    if (!burstActive || burstPending || drdyMode) {
+        return false;
+    }
+    fillBurstMeasurement(data, burstTimestamp);
+    return true;
+}
+
+// =================================================================================================
+// DRDY INTERRUPT ACQUISITION
+// =================================================================================================
+
+bool SensythingOX::enableDataReadyMode(bool enable) {
+    if (enable == drdyMode) {
+        return true;
+    }
+    
+    if (enable) {
+        if (!ppgSensor) {
+            Serial.println(String(EMOJI_ERROR) + " AFE4400 not initialized");
+            return false;
+        }
+        if (threadedAcquisition) {
+            // The acquisition task reads the AFE4400 on every tick; two tasks on one bus would interleave
+            Serial.println(String(EMOJI_ERROR) + " DRDY needs polled acquisition (acq_mode polled)");
+            return false;
+        }
+        
+        if (!drdyTaskExited) {
+            drdyTaskExited = xSemaphoreCreateBinary();
+            if (!drdyTaskExited) {
+                Serial.println(String(EMOJI_ERROR) + " Failed to create DRDY task semaphore");
+                return false;
+            }
+        }
+        
+        // A split-phase read from update() must not interleave with the task's
+        drainBurst();
+        resetSplitPhase();
+        drdyBuffer.clear();
+        drdyStopRequested = false;
+        
+        BaseType_t created = xTaskCreatePinnedToCore(
+            &SensythingOX::dataReadyTaskEntry, "sensything_drdy",
+            SENSYTHING_ACQ_TASK_STACK_SIZE, this, SENSYTHING_ACQ_TASK_PRIORITY,
+            &drdyTaskHandle, SENSYTHING_ACQ_TASK_CORE);
+        if (created != pdPASS) {
+            Serial.println(String(EMOJI_ERROR) + " Failed to start DRDY task");
+            drdyTaskHandle = nullptr;
+            return false;
+        }
+        
+        pinMode(PIN_AFE_DRDY, INPUT);
+        attachInterruptArg(digitalPinToInterrupt(PIN_AFE_DRDY), &SensythingOX::onDataReady, this, RISING);
+        drdyMode = true;
+        
+        Serial.println(String(EMOJI_SUCCESS) + " DRDY acquisition enabled");
+        return true;
+    }
+    
+    // No new edges after this; the ISR was attached from this core, so none
+    // is running while we are
+    detachInterrupt(digitalPinToInterrupt(PIN_AFE_DRDY));
+    
+    // Let the task finish any SPI read in progress and acknowledge before it
+    // is deleted; update() only takes the bus back once drdyMode is cleared
+    drdyStopRequested = true;
+    xTaskNotifyGive(drdyTaskHandle);
+    xSemaphoreTake(drdyTaskExited, portMAX_DELAY);
+    vTaskDelete(drdyTaskHandle);
+    drdyTaskHandle = nullptr;
+    resetSplitPhase();                           // Start polling with a fresh conversion
+    drdyMode = false;
+    
+    Serial.println(String(EMOJI_SUCCESS) + " DRDY acquisition disabled");
+    return true;
+}
+
+void IRAM_ATTR SensythingOX::onDataReady(void* arg) {
+    SensythingOX* board = static_cast<SensythingOX*>(arg);
+    board->drdyTimestampUs = (uint32_t)esp_timer_get_time();  // One store, so the task never sees half of it
+    
+    BaseType_t higherPriorityWoken = pdFALSE;
+    vTaskNotifyGiveFromISR(board->drdyTaskHandle, &higherPriorityWoken);
+    portYIELD_FROM_ISR(higherPriorityWoken);
+}
+
+void SensythingOX::dataReadyTaskEntry(void* arg) {
+    SensythingOX* board = static_cast<SensythingOX*>(arg);
+    board->dataReadyTaskLoop();
+    
+    // Acknowledge and park; enableDataReadyMode() deletes the task
+    xSemaphoreGive(board->drdyTaskExited);
+    vTaskSuspend(nullptr);
+}
+
+void SensythingOX::dataReadyTaskLoop() {
+    MeasurementData sample;
+    memset(&sample, 0, sizeof(MeasurementData));
+    
+    while (true) {
+        // One notification per DRDY edge; more than one pending means the
+        // previous conversion was overwritten before we could read it
+        uint32_t pending = ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        bool valid = false;
+        while (pending && !drdyStopRequested) {
+            drdyOverruns += pending - 1;
+            
+            // Rebuild the full edge time from its low word; the edge is far less
+            // than 2^32 us old, so the wrapped difference is its true age
+            int64_t now = esp_timer_get_time();
+            uint32_t ageUs = (uint32_t)now - drdyTimestampUs;
+            uint32_t timestamp = (uint32_t)((now - ageUs) / 1000);
+            valid = readConversion(sample, timestamp);
+            
+            // An edge during the read means the result registers changed under
+            // it: the sample may hold the newer conversion or parts of both, so
+            // it is counted as an overrun and the newest conversion read instead
+            pending = ulTaskNotifyTake(pdTRUE, 0);
+            if (pending || !valid) {
+                drdyOverruns++;
+                valid = false;
+            }
+        }
+        if (drdyStopRequested) {
+            return;
+        }
+        if (!valid) {
+            continue;
+        }
+        
+        drdyConversions++;
+        if (!drdyBuffer.push(sample)) {
+            drdyOverruns++;
+        }
+    }
+}
+
+bool SensythingOX::handleBoardCommand(const String& command) {
+    if (command == "drdy on") {
+        enableDataReadyMode(true);
+        return true;
+    }
+    if (command == "drdy off") {
+        enableDataReadyMode(false);
+        return true;
+    }
+    if (command == "burst on" || command == "burst off") {
+        // Applied on the next read, from whichever context owns the bus
+        setBurstRead(command == "burst on");
+        Serial.printf("%s AFE4400 read path: %s\n", EMOJI_SUCCESS, burstRequested ? "burst" : "library");
+        return true;
+    }
+    return false;
+}
+
+void SensythingOX::printBoardStatus() {
+    if (drdyMode) {
+        Serial.printf("%s AFE4400 DRDY: %u conversions, %u overruns, %u buffered\n", EMOJI_DATA,
+                     drdyConversions, drdyOverruns, (unsigned)drdyBuffer.size());
+    } else {
+        Serial.printf("%s AFE4400 DRDY: off (polled at sample rate)\n", EMOJI_DATA);
+    }
+    Serial.printf("%s AFE4400 read: %s, %.1f us CPU/sample over %u reads\n", EMOJI_TIME,
+                 burstActive ? "burst (DMA)" : "library", getReadCpuTimeUs(), readCount);
+    if (burstActive) {
+        Serial.printf("%s AFE4400 raw: LED2 %ld, ALED2 %ld, LED1 %ld, ALED1 %ld\n", EMOJI_DATA,
+                     (long)rawSample.led2, (long)rawSample.aled2, (long)rawSample.led1, (long)rawSample.aled1);
+    }
 }
 
-BoardConfig SensythingOX::getBoardConfig() {
-    return boardConfig;
+void SensythingOX::printBoardHelp() {
+    Serial.println("drdy <on|off>   - Capture every AFE4400 conversion on DRDY");
+    Serial.println("burst <on|off>  - Read AFE4400 results in one DMA batch (raw only, no SpO2/HR)");
 }
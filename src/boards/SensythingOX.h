@@ -12,34 +12,190 @@
 #define SENSYTHING_OX_H
 
 #include <SPI.h>
+#include <driver/spi_master.h>
 #include <protocentral_afe44xx.h>
-#include "../core/SensythingCore.h"
+#include "../core/SensythingCoreT.h"
+#include "../core/SensythingRingBuffer.h"
 
-class SensythingOX : public SensythingCore {
+#define SENSYTHING_OX_DRDY_BUFFER_SIZE 64   // Conversions buffered between the DRDY task and update()
+#define SENSYTHING_OX_SPI_CLOCK_HZ 4000000           // Library register access
+#define SENSYTHING_OX_BURST_SPI_CLOCK_HZ 16000000    // AFE4400 SCLK maximum
+#define SENSYTHING_OX_BURST_SPI_HOST SPI2_HOST       // FSPI, the bus Arduino's SPI uses on the S3
+
+/**
+ * AFE4400 result registers fetched by the burst read (22-bit, sign-extended)
+ */
+typedef struct {
+    int32_t led2;                                // LED2VAL: RED
+    int32_t aled2;                               // ALED2VAL: ambient after RED
+    int32_t led1;                                // LED1VAL: IR
+    int32_t aled1;                               // ALED1VAL: ambient after IR
+} SensythingOXRawSample;
+
+class SensythingOX : public SensythingCoreT<SensythingOX> {
 public:
     SensythingOX();
     ~SensythingOX();
     
+    static const uint8_t CHANNELS = 4;
+    
     // Implement pure virtual methods from SensythingCore
     bool initSensor() override;
-    bool readMeasurement(MeasurementData& data) override;
-    String getBoardName() override;
-    String getSensorType() override;
-    BoardConfig getBoardConfig() override;
+    
+    // Sensor read, called by SensythingCoreT without virtual dispatch
+    bool readSample(MeasurementData& data);
+    
+    // Optional board hooks
+    bool isDataReadyDriven() override { return drdyMode; }
+    bool isSplitPhase() override { return burstRequested && !drdyMode; }
+    bool startMeasurement() override;
+    bool isMeasurementReady() override;
+    bool collectMeasurement(MeasurementData& data) override;
+    bool handleBoardCommand(const String& command) override;
+    void printBoardStatus() override;
+    void printBoardHelp() override;
+    
+    /**
+     * Enable/disable DRDY interrupt acquisition
+     * 
+     * In DRDY mode every AFE4400 conversion is read by a dedicated task woken from
+     * the ADC_RDY interrupt, timestamped in the ISR and buffered, so no conversion
+     * is read twice or skipped. The sample interval no longer paces acquisition.
+     * @param enable true to capture on DRDY, false to poll on the sample timer
+     * @return true if the requested mode is active
+     */
+    bool enableDataReadyMode(bool enable);
+    
+    /**
+     * Number of AFE4400 conversions captured in DRDY mode
+     */
+    uint32_t getDataReadyCount() const { return drdyConversions; }
+    
+    /**
+     * Number of conversions lost in DRDY mode (reader late or buffer full)
+     */
+    uint32_t getDataReadyOverruns() const { return drdyOverruns; }
+    
+    /**
+     * Select the burst read path
+     * 
+     * Burst: the Arduino SPI driver hands the bus to an ESP-IDF spi_master device
+     * at SENSYTHING_OX_BURST_SPI_CLOCK_HZ, and the four result registers are read
+     * as one queued batch of DMA transactions. The CPU only queues the batch and
+     * decodes the results; polled reads become split-phase, so update() keeps
+     * servicing the sinks during the transfer. SpO2 and heart rate come from the
+     * AFE44XX library and read 0 in this mode.
+     * 
+     * Library (default): every read goes through the AFE44XX library.
+     * @param enable true for the burst path, false for the library
+     */
+    void setBurstRead(bool enable);
+    
+    bool isBurstRead() const { return burstRequested; }
+    
+    /**
+     * Latest result registers from the burst path (zero until the first burst read)
+     */
+    SensythingOXRawSample getRawSample() const { return rawSample; }
+    
+    /**
+     * Mean CPU time per sample of the active read path, excluding time spent
+     * blocked while the DMA transfer runs
+     * @return Microseconds (0 before the first read)
+     */
+    float getReadCpuTimeUs() const;
     
 private:
     AFE44XX* ppgSensor;
     afe44xx_data rawData;
     
+    // DRDY acquisition state
+    volatile bool drdyMode;
+    volatile bool drdyStopRequested;
+    TaskHandle_t drdyTaskHandle;                 // Set and cleared only by enableDataReadyMode()
+    SemaphoreHandle_t drdyTaskExited;            // Given by the task when it has left its loop
+    volatile uint32_t drdyTimestampUs;           // Low word of esp_timer_get_time(), captured in the ISR
+    volatile uint32_t drdyConversions;
+    volatile uint32_t drdyOverruns;
+    SensythingRingBuffer<MeasurementData, SENSYTHING_OX_DRDY_BUFFER_SIZE> drdyBuffer;
+    
+    // Burst read state; the path is switched from the read context so the bus
+    // only ever has one owner
+    volatile bool burstRequested;
+    bool burstActive;
+    spi_device_handle_t burstDevice;
+    spi_transaction_t burstTransactions[4];
+    uint8_t* burstTx;                            // DMA-capable, 4 bytes per register
+    uint8_t* burstRx;
+    uint8_t burstPending;                        // Transactions queued but not yet fetched
+    uint32_t burstTimestamp;                     // Split-phase read start (millis)
+    uint32_t burstCycles;                        // CPU cycles spent on the read in flight
+    SensythingOXRawSample rawSample;
+    
+    // CPU time per sample on the active read path
+    uint64_t readCycles;
+    uint32_t readCount;
+    
+    // AFE4400 registers
+    static const uint8_t REG_CONTROL0 = 0x00;
+    static const uint8_t REG_LED2VAL  = 0x2A;    // LED2VAL, ALED2VAL, LED1VAL, ALED1VAL are consecutive
+    static const uint32_t CONTROL0_SPI_READ = 0x000001;
+    
     // Pin definitions (from proposal)
     static const uint8_t PIN_SPI_CS   = 10;
     static const uint8_t PIN_AFE_DRDY = 14;
     static const uint8_t PIN_AFE_PWDN = 21;
     
+    static const BoardConfig BOARD_CONFIG;
+    
     /**
      * Configure board-specific settings
      */
     void configureBoardConfig();
+    
+    /**
+     * Convert an AFE44XX reading into the platform measurement layout
+     */
+    void fillMeasurement(const afe44xx_data& raw, MeasurementData& data, uint32_t timestamp);
+    
+    /**
+     * Read one conversion on the active path (polled reads and the DRDY task)
+     */
+    bool readConversion(MeasurementData& data, uint32_t timestamp);
+    
+    /**
+     * Switch to the requested read path if it changed
+     */
+    void applyReadPath();
+    
+    /**
+     * Configure the Arduino SPI driver for the AFE44XX library
+     */
+    void beginLibrarySPI();
+    
+    /**
+     * Hand the bus to a spi_master device and enable register reads
+     * @return true if the burst path is ready
+     */
+    bool startBurstReader();
+    
+    /**
+     * Release the spi_master device and give the bus back to the library
+     */
+    void stopBurstReader();
+    
+    bool queueBurst();
+    bool fetchBurst(TickType_t wait);
+    void drainBurst();
+    
+    /**
+     * Decode the fetched registers into rawSample and the measurement layout
+     */
+    void fillBurstMeasurement(MeasurementData& data, uint32_t timestamp);
+    
+    void dataReadyTaskLoop();
+    static void dataReadyTaskEntry(void* arg);
+    static void IRAM_ATTR onDataReady(void* arg);
 };
 
 #endif // SENSYTHING_OX_H
@@ -0,0 +1,403 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Replay - Board Implementation
+//    Plays back CSV logs written by SensythingSDCard through the streaming pipeline
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#include "SensythingReplay.h"
+#include "SensythingChannels.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Split off the next comma-separated field (the line is modified in place)
+static char* nextField(char*& cursor) {
+    if (!cursor) {
+        return nullptr;
+    }
+    char* field = cursor;
+    char* comma = strchr(cursor, ',');
+    if (comma) {
+        *comma = '\0';
+        cursor = comma + 1;
+    } else {
+        cursor = nullptr;
+    }
+    return field;
+}
+
+// No hardware attached; the channels and board type come from the log
+const BoardConfig SensythingReplay::BOARD_CONFIG = {
+    BOARD_TYPE_CUSTOM,
+    "Sensything Replay",
+    "CSV log replay",
+    0,
+    nullptr,
+    false,
+    -1, -1, -1, -1, -1, -1,
+    1,
+    SENSYTHING_MAX_SAMPLE_INTERVAL_MS
+};
+
+SensythingReplay::SensythingReplay(fs::FS& fs, const char* path) : SensythingCore(), filesystem(fs) {
+    snprintf(this->path, sizeof(this->path), "%s", path);
+    dataStart = 0;
+    bufferOffset = 0;
+    hasMetadata = false;
+    readPos = 0;
+    readLen = 0;
+    memset(&pending, 0, sizeof(MeasurementData));
+    pendingValid = false;
+    speedPerMille = 1000;
+    looping = false;
+    restartRequested = false;
+    rebase = true;
+    baseUs = 0;
+    baseTimestamp = 0;
+    firstTimestamp = 0;
+    lastTimestamp = 0;
+    lastInterval = 0;
+    loopOffset = 0;
+    recordsSinceRewind = 0;
+    finished = false;
+    replayed = 0;
+    malformed = 0;
+    loops = 0;
+
+    // Replaced from the file header in initSensor()
+    memset(channelInfo, 0, sizeof(channelInfo));
+    snprintf(sensorTypeText, sizeof(sensorTypeText), "Replay of %s", path);
+    boardConfig = BOARD_CONFIG;
+    boardConfig.channels = channelInfo;
+}
+
+SensythingReplay::~SensythingReplay() {
+    // The acquisition task calls readMeasurement(); stop it while this object is intact
+    enableThreadedAcquisition(false);
+
+    if (file) {
+        file.close();
+    }
+}
+
+bool SensythingReplay::initSensor() {
+    file = filesystem.open(path, FILE_READ);
+    if (!file) {
+        Serial.printf("%s Cannot open %s (mount the filesystem before initPlatform())\n", EMOJI_ERROR, path);
+        return false;
+    }
+
+    char line[SENSYTHING_CSV_HEADER_SIZE];
+    if (!readLine(line, sizeof(line)) || !parseHeader(line)) {
+        Serial.printf("%s %s has no SensythingSDCard CSV header\n", EMOJI_ERROR, path);
+        file.close();
+        return false;
+    }
+    dataStart = bufferOffset + readPos;
+
+    Serial.printf("%s Replaying %s: %d channels, %u bytes\n", EMOJI_INFO, path,
+                 boardConfig.channelCount, (unsigned)file.size());
+    return true;
+}
+
+bool SensythingReplay::parseHeader(char* line) {
+    char* cursor = line;
+    char* field = nextField(cursor);
+    if (!field || strcmp(field, "timestamp") != 0) {
+        return false;
+    }
+    field = nextField(cursor);
+    if (!field || strcmp(field, "count") != 0) {
+        return false;
+    }
+
+    uint8_t channelCount = 0;
+    hasMetadata = false;
+    while ((field = nextField(cursor)) != nullptr) {
+        if (strcmp(field, "status_flags") == 0) {
+            break;
+        }
+
+        size_t length = strlen(field);
+        if (length > 7 && strcmp(field + length - 7, "_capdac") == 0) {
+            hasMetadata = true;
+            continue;
+        }
+
+        if (channelCount >= SENSYTHING_MAX_CHANNELS) {
+            return false;
+        }
+        snprintf(channelInfo[channelCount].label, SENSYTHING_MAX_LABEL_LEN, "%s", field);
+        channelCount++;
+    }
+    if (!field || channelCount == 0) {
+        return false;  // No status_flags column
+    }
+    boardConfig.channelCount = channelCount;
+
+    // Present the log as the board that wrote it so the sinks format it the same way
+    if (hasMetadata) {
+        boardConfig.boardType = BOARD_TYPE_CAP;
+        boardConfig.boardName = "Sensything Replay (Cap)";
+    } else if (strcmp(channelInfo[0].label, "ir_raw") == 0) {
+        boardConfig.boardType = BOARD_TYPE_OX;
+        boardConfig.boardName = "Sensything Replay (OX)";
+    } else {
+        boardConfig.boardType = BOARD_TYPE_CUSTOM;
+    }
+    boardConfig.sensorType = sensorTypeText;
+    boardConfig.metadataColumns = hasMetadata;
+
+    for (uint8_t i = 0; i < channelCount; i++) {
+        const char* unit = "";
+        if (boardConfig.boardType == BOARD_TYPE_CAP) {
+            unit = SENSYTHING_CAP_CHANNELS[0].unit;
+        } else if (boardConfig.boardType == BOARD_TYPE_OX && i < 4) {
+            unit = SENSYTHING_OX_CHANNELS[i].unit;
+        }
+        snprintf(channelInfo[i].unit, sizeof(channelInfo[i].unit), "%s", unit);
+        channelInfo[i].minValue = 0.0;
+        channelInfo[i].maxValue = 0.0;
+        channelInfo[i].active = true;
+    }
+    return true;
+}
+
+bool SensythingReplay::parseRecord(char* line, MeasurementData& data) {
+    char* cursor = line;
+    char* end;
+
+    char* field = nextField(cursor);
+    if (!field) return false;
+    data.timestamp = strtoul(field, &end, 10);
+    if (end == field) return false;
+
+    field = nextField(cursor);
+    if (!field) return false;
+    data.measurement_count = strtoul(field, &end, 10);
+    if (end == field) return false;
+
+    for (uint8_t i = 0; i < boardConfig.channelCount; i++) {
+        field = nextField(cursor);
+        if (!field) return false;
+
+        // Failed channels were logged as NaN; boards report them as 0 plus the fail flag
+        float value = strtof(field, &end);
+        if (end == field) return false;
+        data.channels[i] = isnan(value) ? 0.0f : value;
+
+        data.metadata[i] = 0;
+        if (hasMetadata) {
+            field = nextField(cursor);
+            if (!field) return false;
+            data.metadata[i] = (uint8_t)strtoul(field, &end, 10);
+            if (end == field) return false;
+        }
+    }
+
+    field = nextField(cursor);
+    if (!field) return false;
+    data.status_flags = (uint8_t)strtoul(field, &end, 16);
+    if (end == field) return false;
+
+    data.channel_count = boardConfig.channelCount;
+    return true;
+}
+
+bool SensythingReplay::readLine(char* line, size_t size) {
+    size_t used = 0;
+    bool gotData = false;
+
+    while (true) {
+        if (readPos >= readLen) {
+            bufferOffset += readLen;
+            readLen = file.read((uint8_t*)readBuffer, sizeof(readBuffer));
+            readPos = 0;
+            if (readLen == 0) {
+                break;  // End of file; a final line without '\n' still counts
+            }
+        }
+
+        char c = readBuffer[readPos++];
+        gotData = true;
+        if (c == '\n') {
+            break;
+        }
+        // Over-long lines are truncated and then fail to parse
+        if (c != '\r' && used < size - 1) {
+            line[used++] = c;
+        }
+    }
+
+    line[used] = '\0';
+    return gotData;
+}
+
+void SensythingReplay::rewind() {
+    file.seek(dataStart);
+    bufferOffset = dataStart;
+    readPos = 0;
+    readLen = 0;
+    pendingValid = false;
+    recordsSinceRewind = 0;
+}
+
+bool SensythingReplay::loadPending() {
+    char line[SENSYTHING_CSV_LINE_SIZE];
+
+    while (true) {
+        if (!readLine(line, sizeof(line))) {
+            // Give up on a file without a single valid record instead of spinning
+            if (!looping || recordsSinceRewind == 0) {
+                return false;
+            }
+
+            // Continue the timeline one recorded interval after the last record
+            loopOffset += lastTimestamp - firstTimestamp + lastInterval;
+            loops++;
+            rewind();
+            continue;
+        }
+
+        if (line[0] == '\0') {
+            continue;
+        }
+        if (!parseRecord(line, pending)) {
+            malformed++;
+            continue;
+        }
+
+        uint32_t recorded = pending.timestamp;
+        if (recordsSinceRewind == 0) {
+            firstTimestamp = recorded;
+        } else {
+            lastInterval = recorded - lastTimestamp;
+        }
+        lastTimestamp = recorded;
+        recordsSinceRewind++;
+
+        pending.timestamp = recorded + loopOffset;
+        pendingValid = true;
+        return true;
+    }
+}
+
+bool SensythingReplay::readMeasurement(MeasurementData& data) {
+    if (!file) {
+        return false;
+    }
+
+    // Commands arrive on the loop task; apply them here on the reading task
+    if (restartRequested) {
+        restartRequested = false;
+        rewind();
+        loopOffset = 0;
+        finished = false;
+        rebase = true;
+    }
+    if (finished) {
+        return false;
+    }
+
+    if (!pendingValid && !loadPending()) {
+        finished = true;
+        Serial.printf("%s Replay finished: %u records, %u malformed lines\n", EMOJI_SUCCESS,
+                     replayed, malformed);
+        return false;
+    }
+
+    // Paced playback: hold the record until its recorded time, scaled by speed
+    uint32_t speed = speedPerMille;
+    if (speed > 0) {
+        int64_t now = esp_timer_get_time();
+        int32_t elapsedMs = (int32_t)(pending.timestamp - baseTimestamp);
+        if (rebase || elapsedMs < 0) {
+            rebase = false;
+            baseUs = now;
+            baseTimestamp = pending.timestamp;
+            elapsedMs = 0;
+        }
+
+        int64_t dueUs = baseUs + (int64_t)elapsedMs * 1000000 / speed;
+        if (dueUs > now) {
+            return false;
+        }
+
+        // Paused or starved for a while: resume from here rather than burst
+        if (now - dueUs > (int64_t)SENSYTHING_REPLAY_MAX_LAG_MS * 1000) {
+            baseUs = now;
+            baseTimestamp = pending.timestamp;
+        }
+    }
+
+    data = pending;
+    pendingValid = false;
+    replayed++;
+    return true;
+}
+
+void SensythingReplay::setSpeed(float speed) {
+    speedPerMille = speed > 0 ? (uint32_t)(speed * 1000.0f + 0.5f) : 0;
+    rebase = true;
+}
+
+bool SensythingReplay::handleBoardCommand(const String& command) {
+    if (command.startsWith("replay speed")) {
+        String arg = command.substring(12);
+        arg.trim();
+        
+        // toFloat() reads "abc" as 0, which would mean flat-out
+        float speed = 0.0f;
+        char extra;
+        if (arg != "max" &&
+            (sscanf(arg.c_str(), "%f %c", &speed, &extra) != 1 ||
+             !(speed > 0.0f && speed <= SENSYTHING_REPLAY_MAX_SPEED))) {
+            Serial.printf("%s Usage: replay speed <factor (0-%.0f]|max>\n", EMOJI_ERROR, SENSYTHING_REPLAY_MAX_SPEED);
+            return true;
+        }
+        setSpeed(speed);
+        if (speedPerMille == 0) {
+            Serial.println(String(EMOJI_SUCCESS) + " Replay speed: flat-out");
+        } else {
+            Serial.printf("%s Replay speed: %.2fx\n", EMOJI_SUCCESS, getSpeed());
+        }
+        return true;
+    }
+    if (command == "replay loop on" || command == "replay loop off") {
+        setLoop(command.endsWith("on"));
+        Serial.printf("%s Replay loop %s\n", EMOJI_SUCCESS, looping ? "on" : "off");
+        return true;
+    }
+    if (command == "replay restart") {
+        restart();
+        Serial.println(String(EMOJI_SUCCESS) + " Replay restarted");
+        return true;
+    }
+    return false;
+}
+
+void SensythingReplay::printBoardStatus() {
+    size_t size = file ? file.size() : 0;
+    size_t position = bufferOffset + readPos;
+
+    Serial.printf("%s Replay: %s, %u records, %u malformed, %.0f%% read%s\n", EMOJI_DATA, path,
+                 replayed, malformed, size > 0 ? 100.0f * position / size : 0.0f,
+                 finished ? " (finished)" : "");
+    if (speedPerMille == 0) {
+        Serial.printf("%s Replay speed: flat-out, loop %s (%u loops)\n", EMOJI_DATA,
+                     looping ? "on" : "off", loops);
+    } else {
+        Serial.printf("%s Replay speed: %.2fx, loop %s (%u loops)\n", EMOJI_DATA,
+                     getSpeed(), looping ? "on" : "off", loops);
+    }
+}
+
+void SensythingReplay::printBoardHelp() {
+    Serial.println("replay speed <x|max> - Playback speed (1 = real time, max = flat-out)");
+    Serial.println("replay loop <on|off> - Restart at end of file");
+    Serial.println("replay restart  - Rewind to the first record");
+}
@@ -0,0 +1,141 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Replay - Board Implementation
+//    Plays back CSV logs written by SensythingSDCard through the streaming pipeline
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SENSYTHING_REPLAY_H
+#define SENSYTHING_REPLAY_H
+
+#include <FS.h>
+#include "../core/SensythingCore.h"
+
+#define SENSYTHING_REPLAY_READ_SIZE 512          // File bytes fetched per read
+#define SENSYTHING_REPLAY_MAX_LAG_MS 500         // Re-anchor timing instead of bursting a longer backlog
+#define SENSYTHING_REPLAY_PATH_SIZE 64
+#define SENSYTHING_REPLAY_MAX_SPEED 1000.0f     // Fastest timed playback ('max' is flat-out)
+
+/**
+ * Replays a sensything_N.csv file in the column layout written by
+ * SensythingSDCard::writeHeader(). Channel labels come from the header; a
+ * file with "_capdac" columns replays as a Cap board and one starting with
+ * "ir_raw" as an OX board, so every sink formats it like a live capture.
+ *
+ * The filesystem must be mounted before initPlatform(); for the SD card,
+ * call initSDCard() first.
+ */
+class SensythingReplay : public SensythingCore {
+public:
+    /**
+     * @param fs Filesystem holding the log (e.g. SD_MMC)
+     * @param path Absolute path of the CSV file (e.g. "/sensything_1.csv")
+     */
+    SensythingReplay(fs::FS& fs, const char* path);
+    ~SensythingReplay();
+
+    // Implement pure virtual methods from SensythingCore
+    bool initSensor() override;
+    bool readMeasurement(MeasurementData& data) override;
+
+    // Records are paced by their own timestamps, not by the sample interval
+    bool isDataReadyDriven() override { return true; }
+    bool handleBoardCommand(const String& command) override;
+    void printBoardStatus() override;
+    void printBoardHelp() override;
+
+    /**
+     * Set the playback speed
+     * @param speed 1.0 = real time, N = N times faster, 0 = as fast as the pipeline takes it
+     */
+    void setSpeed(float speed);
+
+    float getSpeed() const { return speedPerMille / 1000.0f; }
+
+    /**
+     * Start again from the first record when the end of the file is reached
+     * @param enable true to loop
+     */
+    void setLoop(bool enable) { looping = enable; }
+
+    /**
+     * Rewind to the first record
+     */
+    void restart() { restartRequested = true; }
+
+    bool isFinished() const { return finished; }
+    uint32_t getReplayedCount() const { return replayed; }
+    uint32_t getMalformedCount() const { return malformed; }
+
+private:
+    fs::FS& filesystem;
+    char path[SENSYTHING_REPLAY_PATH_SIZE];
+    File file;
+    size_t dataStart;                            // File offset of the first record
+    size_t bufferOffset;                         // File offset of readBuffer[0]
+    bool hasMetadata;                            // File has _capdac columns
+
+    // Storage for the parts of boardConfig that come from the file header
+    ChannelInfo channelInfo[SENSYTHING_MAX_CHANNELS];
+    char sensorTypeText[SENSYTHING_REPLAY_PATH_SIZE + 16];
+
+    // Buffered line reader
+    char readBuffer[SENSYTHING_REPLAY_READ_SIZE];
+    size_t readPos;
+    size_t readLen;
+
+    // Next record, read ahead so its due time is known
+    MeasurementData pending;
+    bool pendingValid;
+
+    // Playback timing
+    volatile uint32_t speedPerMille;             // 1000 = real time, 0 = flat-out
+    volatile bool looping;
+    volatile bool restartRequested;
+    bool rebase;                                 // Anchor the next record to "now"
+    int64_t baseUs;
+    uint32_t baseTimestamp;
+    uint32_t firstTimestamp;
+    uint32_t lastTimestamp;
+    uint32_t lastInterval;
+    uint32_t loopOffset;                         // Added to timestamps so loops stay monotonic
+    uint32_t recordsSinceRewind;
+    bool finished;
+
+    uint32_t replayed;
+    uint32_t malformed;
+    uint32_t loops;
+
+    static const BoardConfig BOARD_CONFIG;
+
+    /**
+     * Parse the header line into boardConfig
+     * @return true if the header matches the SensythingSDCard CSV layout
+     */
+    bool parseHeader(char* line);
+
+    /**
+     * Parse one data line
+     * @return true if the line held a complete record
+     */
+    bool parseRecord(char* line, MeasurementData& data);
+
+    /**
+     * Read the next line into a buffer, without the line ending
+     * @return false at end of file
+     */
+    bool readLine(char* line, size_t size);
+
+    /**
+     * Read ahead to the next valid record (handles end of file and looping)
+     * @return false if there are no more records
+     */
+    bool loadPending();
+
+    void rewind();
+};
+
+#endif // SENSYTHING_REPLAY_H
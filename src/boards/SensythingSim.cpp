@@ -0,0 +1,233 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Sim - Board Implementation
+//    Synthetic Cap/OX signal generator for exercising the streaming pipeline
+//    without sensor hardware
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#include "SensythingSim.h"
+#include "SensythingChannels.h"
+#include <math.h>
+
+#define SIM_TWO_PI 6.2831853f
+
+// One descriptor per profile; no hardware attached. The sample rate limit is
+// the polled maximum, faster rates use setGenerationRate().
+const BoardConfig SensythingSim::CAP_PROFILE_CONFIG = {
+    BOARD_TYPE_CAP,
+    "Sensything Sim (Cap)",
+    "Simulated Capacitance",
+    CHANNELS,
+    SENSYTHING_CAP_CHANNELS,
+    true,
+    -1, -1, -1, -1, -1, -1,
+    1,                                            // 1kHz polled maximum
+    SENSYTHING_MAX_SAMPLE_INTERVAL_MS
+};
+
+const BoardConfig SensythingSim::OX_PROFILE_CONFIG = {
+    BOARD_TYPE_OX,
+    "Sensything Sim (OX)",
+    "Simulated PPG/SpO2",
+    CHANNELS,
+    SENSYTHING_OX_CHANNELS,
+    false,
+    -1, -1, -1, -1, -1, -1,
+    1,
+    SENSYTHING_MAX_SAMPLE_INTERVAL_MS
+};
+
+// Position within a repeating period as a fraction [0, 1). Computed in integer
+// microseconds so the signals do not lose resolution after hours of uptime.
+static float periodPhase(int64_t timeUs, int64_t periodUs) {
+    return (float)(timeUs % periodUs) / (float)periodUs;
+}
+
+SensythingSim::SensythingSim(SensythingSimProfile profile) : SensythingCoreT() {
+    this->profile = profile;
+    generationRateHz = 0;
+    noiseAmplitude = SENSYTHING_SIM_DEFAULT_NOISE;
+    rngState = 0x2545F491;
+    startUs = 0;
+    sampleIndex = 0;
+    generated = 0;
+    skipped = 0;
+    statsStartUs = 0;
+    configureBoardConfig();
+}
+
+SensythingSim::~SensythingSim() {
+    // The acquisition task calls readSample(); stop it while this object is intact
+    enableThreadedAcquisition(false);
+}
+
+void SensythingSim::configureBoardConfig() {
+    boardConfig = (profile == SENSYTHING_SIM_OX) ? OX_PROFILE_CONFIG : CAP_PROFILE_CONFIG;
+}
+
+bool SensythingSim::initSensor() {
+    DEBUG_PRINTLN("Simulated sensor ready");
+    return true;
+}
+
+bool SensythingSim::readSample(MeasurementData& data) {
+    uint32_t rateHz = generationRateHz;
+
+    // Polled: one sample per sample interval, like the real boards
+    if (rateHz == 0) {
+        synthesize(data, esp_timer_get_time());
+        data.timestamp = millis();
+        generated++;
+        return true;
+    }
+
+    // Free-running: hand out every sample due on the 1/rate grid
+    int64_t now = esp_timer_get_time();
+    if (startUs == 0) {
+        startUs = now;
+        statsStartUs = now;
+    }
+
+    int64_t dueUs = startUs + (int64_t)(sampleIndex * 1000000ULL / rateHz);
+    if (dueUs > now) {
+        return false;
+    }
+
+    // Too far behind to catch up: drop the backlog instead of bursting it
+    if (now - dueUs > (int64_t)SENSYTHING_SIM_MAX_LAG_MS * 1000) {
+        uint64_t currentIndex = (uint64_t)(now - startUs) * rateHz / 1000000ULL;
+        skipped += (uint32_t)(currentIndex - sampleIndex);
+        sampleIndex = currentIndex;
+        dueUs = startUs + (int64_t)(sampleIndex * 1000000ULL / rateHz);
+    }
+
+    synthesize(data, dueUs);
+    data.timestamp = (uint32_t)(dueUs / 1000);
+    sampleIndex++;
+    generated++;
+    return true;
+}
+
+void SensythingSim::synthesize(MeasurementData& data, int64_t timeUs) {
+    data.channel_count = CHANNELS;
+    data.status_flags = 0;
+
+    if (profile == SENSYTHING_SIM_OX) {
+        // 72 bpm pulse: systolic peak plus a smaller dicrotic wave
+        float phase = periodPhase(timeUs, 833333);
+        float systolic = (phase - 0.2f) / 0.08f;
+        float dicrotic = (phase - 0.5f) / 0.1f;
+        float pulse = expf(-systolic * systolic) + 0.4f * expf(-dicrotic * dicrotic);
+
+        // Blood volume absorbs light, so the raw signal dips with each beat;
+        // whole ADC counts, as the AFE4400 reports them
+        data.channels[0] = roundf(120000.0f - 3000.0f * (pulse + noiseAmplitude * nextNoise()));
+        data.channels[1] = roundf(90000.0f - 1800.0f * (pulse + noiseAmplitude * nextNoise()));
+        data.channels[2] = 97.0f;
+        data.channels[3] = 72.0f;
+
+        data.metadata[0] = 97;
+        data.metadata[1] = 72;
+        data.metadata[2] = 0;
+        data.metadata[3] = 0;
+        return;
+    }
+
+    // Four electrodes with different baselines and slow drift; every 10 s one
+    // of them sees a 2 s "touch"
+    uint32_t touchedChannel = (uint32_t)((timeUs / 10000000) % 4);
+    bool touching = (timeUs % 10000000) < 2000000;
+
+    for (int i = 0; i < 4; i++) {
+        float baseline = 4.0f + 2.0f * i;
+        float drift = 0.5f * sinf(SIM_TWO_PI * periodPhase(timeUs, (6 + 2 * i) * 1000000LL));
+        float touch = (touching && touchedChannel == (uint32_t)i) ? 3.0f : 0.0f;
+
+        data.channels[i] = baseline + drift + touch + 0.5f * noiseAmplitude * nextNoise();
+        data.metadata[i] = (uint8_t)(baseline / 3.125f);  // CAPDAC steps are 3.125 pF
+    }
+}
+
+float SensythingSim::nextNoise() {
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 17;
+    rngState ^= rngState << 5;
+    return (float)(int32_t)rngState * (1.0f / 2147483648.0f);
+}
+
+bool SensythingSim::setGenerationRate(uint32_t rateHz) {
+    if (rateHz > SENSYTHING_SIM_MAX_RATE_HZ) {
+        Serial.printf("%s Generation rate must be 0-%u Hz\n", EMOJI_ERROR, SENSYTHING_SIM_MAX_RATE_HZ);
+        return false;
+    }
+
+    generationRateHz = 0;
+    startUs = 0;
+    sampleIndex = 0;
+    generated = 0;
+    skipped = 0;
+    statsStartUs = esp_timer_get_time();
+    generationRateHz = rateHz;
+
+    if (rateHz == 0) {
+        Serial.println(String(EMOJI_SUCCESS) + " Sim: paced by sample interval");
+    } else {
+        Serial.printf("%s Sim: free-running at %u Hz\n", EMOJI_SUCCESS, rateHz);
+    }
+    return true;
+}
+
+bool SensythingSim::handleBoardCommand(const String& command) {
+    if (command.startsWith("sim rate")) {
+        String arg = command.substring(8);
+        arg.trim();
+        if (arg.length() == 0) {
+            Serial.println(String(EMOJI_ERROR) + " Usage: sim rate <hz>");
+        } else {
+            setGenerationRate((uint32_t)arg.toInt());
+        }
+        return true;
+    }
+    if (command.startsWith("sim noise")) {
+        String arg = command.substring(9);
+        arg.trim();
+        
+        // Negative or NaN amplitudes would corrupt every generated sample
+        float noise = 0.0f;
+        char extra;
+        if (sscanf(arg.c_str(), "%f %c", &noise, &extra) != 1 ||
+            !(noise >= 0.0f && noise <= SENSYTHING_SIM_MAX_NOISE)) {
+            Serial.printf("%s Usage: sim noise <fraction 0-%.1f>\n", EMOJI_ERROR, SENSYTHING_SIM_MAX_NOISE);
+        } else {
+            setNoise(noise);
+            Serial.printf("%s Sim noise: %.3f\n", EMOJI_SUCCESS, noiseAmplitude);
+        }
+        return true;
+    }
+    return false;
+}
+
+void SensythingSim::printBoardStatus() {
+    const char* profileName = (profile == SENSYTHING_SIM_OX) ? "ox" : "cap";
+    float seconds = (esp_timer_get_time() - statsStartUs) / 1000000.0f;
+    float achieved = seconds > 0 ? generated / seconds : 0;
+
+    if (generationRateHz > 0) {
+        Serial.printf("%s Sim (%s): free-running %u Hz, %u generated (%.0f/s), %u skipped\n",
+                     EMOJI_DATA, profileName, (unsigned)generationRateHz, generated, achieved, skipped);
+    } else {
+        Serial.printf("%s Sim (%s): paced by sample interval, %u generated (%.0f/s)\n",
+                     EMOJI_DATA, profileName, generated, achieved);
+    }
+    Serial.printf("%s Heap: %u free, %u min free, %u largest block\n", EMOJI_DATA,
+                 ESP.getFreeHeap(), ESP.getMinFreeHeap(), ESP.getMaxAllocHeap());
+}
+
+void SensythingSim::printBoardHelp() {
+    Serial.println("sim rate <hz>   - Free-running generation rate (0 = sample interval)");
+    Serial.println("sim noise <f>   - Noise as a fraction of signal amplitude");
+}
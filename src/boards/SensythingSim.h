@@ -0,0 +1,113 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Sim - Board Implementation
+//    Synthetic Cap/OX signal generator for exercising the streaming pipeline
+//    without sensor hardware
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SENSYTHING_SIM_H
+#define SENSYTHING_SIM_H
+
+#include "../core/SensythingCoreT.h"
+
+#define SENSYTHING_SIM_MAX_RATE_HZ 20000         // Fastest free-running generation rate
+#define SENSYTHING_SIM_MAX_LAG_MS 100            // Backlog skipped when the loop falls behind
+#define SENSYTHING_SIM_DEFAULT_NOISE 0.02f       // Noise as a fraction of signal amplitude
+#define SENSYTHING_SIM_MAX_NOISE 1.0f            // Largest accepted 'sim noise'
+
+/**
+ * Signal profile; selects the board type and channel layout the sinks see
+ */
+enum SensythingSimProfile {
+    SENSYTHING_SIM_CAP,                          // 4 x pF with CAPDAC metadata (like Sensything Cap)
+    SENSYTHING_SIM_OX                            // IR/RED PPG, SpO2, HR (like Sensything OX)
+};
+
+class SensythingSim : public SensythingCoreT<SensythingSim> {
+public:
+    SensythingSim(SensythingSimProfile profile = SENSYTHING_SIM_CAP);
+    ~SensythingSim();
+
+    static const uint8_t CHANNELS = 4;
+
+    // Implement pure virtual methods from SensythingCore
+    bool initSensor() override;
+
+    // Sensor read, called by SensythingCoreT without virtual dispatch
+    bool readSample(MeasurementData& data);
+
+    // Optional board hooks
+    bool isDataReadyDriven() override { return generationRateHz > 0; }
+    bool isReadNonBlocking() override { return generationRateHz == 0; }
+    bool handleBoardCommand(const String& command) override;
+    void printBoardStatus() override;
+    void printBoardHelp() override;
+
+    /**
+     * Set the free-running generation rate
+     *
+     * At 0 the board is polled on the sample interval like real hardware. Above
+     * 0 it behaves like a data-ready driven sensor: every update() receives all
+     * samples due since the last one, timestamped on an exact 1/rate grid, so
+     * the pipeline can be driven faster than the 1 ms sample interval allows.
+     * @param rateHz Samples per second (0 = paced by the sample interval)
+     * @return true if the rate was accepted
+     */
+    bool setGenerationRate(uint32_t rateHz);
+
+    uint32_t getGenerationRate() const { return generationRateHz; }
+
+    /**
+     * Set the noise added to every channel
+     * @param amplitude Fraction of the signal amplitude (0 = clean signal)
+     */
+    void setNoise(float amplitude) { noiseAmplitude = amplitude; }
+
+    /**
+     * Number of samples generated since the rate was last set
+     */
+    uint32_t getGeneratedCount() const { return generated; }
+
+    /**
+     * Number of free-running samples skipped because update() fell more than
+     * SENSYTHING_SIM_MAX_LAG_MS behind
+     */
+    uint32_t getSkippedCount() const { return skipped; }
+
+private:
+    SensythingSimProfile profile;
+    volatile uint32_t generationRateHz;
+    float noiseAmplitude;
+    uint32_t rngState;
+
+    // Free-running state
+    int64_t startUs;                             // Time of sample 0 (0 = not started)
+    uint64_t sampleIndex;                        // Next sample on the 1/rate grid
+    uint32_t generated;
+    uint32_t skipped;
+    int64_t statsStartUs;
+
+    static const BoardConfig CAP_PROFILE_CONFIG;
+    static const BoardConfig OX_PROFILE_CONFIG;
+
+    /**
+     * Configure board-specific settings
+     */
+    void configureBoardConfig();
+
+    /**
+     * Fill a measurement with the profile's signals at a point in time
+     */
+    void synthesize(MeasurementData& data, int64_t timeUs);
+
+    /**
+     * Uniform noise in [-1, 1) from a fixed-seed xorshift, so runs repeat exactly
+     */
+    float nextNoise();
+};
+
+#endif // SENSYTHING_SIM_H
@@ -10,6 +10,25 @@
 
 #include "SensythingBLE.h"
 
+// Static instance for the GAP callback
+SensythingBLE* SensythingBLE::instance = nullptr;
+
+// =================================================================================================
+// CONNECTION CALLBACKS
+// =================================================================================================
+
+void BLEConnectionCallbacks::onConnect(BLEServer* pServer, esp_ble_gatts_cb_param_t* param) {
+    pOwner->onClientConnected(param);
+}
+
+void BLEConnectionCallbacks::onDisconnect(BLEServer* pServer) {
+    pOwner->onClientDisconnected();
+}
+
+void BLEConnectionCallbacks::onMtuChanged(BLEServer* pServer, esp_ble_gatts_cb_param_t* param) {
+    pOwner->onMtuChanged(param->mtu.mtu);
+}
+
 SensythingBLE::SensythingBLE() {
     pServer = nullptr;
     pService = nullptr;
@@ -18,6 +37,27 @@ SensythingBLE::SensythingBLE() {
     connected = false;
     initialized = false;
     deviceName = "Sensything";
+    negotiatedMTU = SENSYTHING_BLE_DEFAULT_MTU;
+    notificationsSent = 0;
+    memset(&sinkStats, 0, sizeof(sinkStats));
+    
+    highThroughput = false;
+    hasPeer = false;
+    memset(peerAddress, 0, sizeof(peerAddress));
+    connIntervalUnits = 0;
+    txPHY = 1;
+    
+    notificationRate = 0;
+    rateWindowCount = 0;
+    rateWindowStartMs = 0;
+    
+    batching = false;
+    batchMaxLatencyMs = SENSYTHING_BLE_BATCH_MAX_LATENCY_MS;
+    batchLength = 0;
+    batchSamples = 0;
+    nextBatchSequence = 0;
+    batchStartMs = 0;
+    deltaEncoding = false;
 }
 
 SensythingBLE::~SensythingBLE() {
@@ -27,6 +67,9 @@ SensythingBLE::~SensythingBLE() {
     if (initialized) {
         BLEDevice::deinit(true);
     }
+    if (instance == this) {
+        instance = nullptr;
+    }
 }
 
 bool SensythingBLE::init(String deviceName) {
@@ -44,6 +87,12 @@ bool SensythingBLE::init(String deviceName) {
     // Initialize BLE Device
     BLEDevice::init(deviceName.c_str());
     
+    // Offer a large MTU so notifications are not capped at 20 bytes, and
+    // watch GAP events to learn the connection interval and PHY
+    instance = this;
+    BLEDevice::setMTU(SENSYTHING_BLE_PREFERRED_MTU);
+    BLEDevice::setCustomGapHandler(gapEventHandler);
+    
     // Create BLE Server
     pServer = BLEDevice::createServer();
     if (!pServer) {
@@ -52,7 +101,7 @@ bool SensythingBLE::init(String deviceName) {
     }
     
     // Set connection callbacks
-    pCallbacks = new BLEConnectionCallbacks(&connected);
+    pCallbacks = new BLEConnectionCallbacks(this);
     pServer->setCallbacks(pCallbacks);
     
     // Create BLE Service (OPENVIEW UUID)
@@ -111,9 +160,16 @@ void SensythingBLE::streamData(const MeasurementData& data, const BoardConfig& c
     }
     
     if (!connected) {
+        sinkStats.samplesDropped += batchSamples;
+        batchSamples = 0;  // Stale batch is dropped with the connection
         return;  // No client connected, skip silently
     }
     
+    if (batching) {
+        addToBatch(data, config);
+        return;
+    }
+    
     // Format data as raw Int16 array (GATT notifications provide framing)
     uint8_t buffer[32];  // Max: 16 channels × 2 bytes = 32 bytes
     int bufferSize = formatAsInt16Array(buffer, data, config);
@@ -121,6 +177,151 @@ void SensythingBLE::streamData(const MeasurementData& data, const BoardConfig& c
     // Send notification
     pDataCharacteristic->setValue(buffer, bufferSize);
     pDataCharacteristic->notify();
+    notificationsSent++;
+    sinkStats.samplesDelivered++;
+    sinkStats.bytesSent += bufferSize;
+}
+
+void SensythingBLE::update() {
+    // Measure the achieved notification rate over one-second windows
+    unsigned long now = millis();
+    if (now - rateWindowStartMs >= 1000) {
+        if (rateWindowStartMs != 0) {
+            notificationRate = (notificationsSent - rateWindowCount) * 1000.0f / (now - rateWindowStartMs);
+        }
+        rateWindowCount = notificationsSent;
+        rateWindowStartMs = now;
+    }
+    
+    if (!batching || batchSamples == 0) {
+        return;
+    }
+    
+    if (!connected) {
+        sinkStats.samplesDropped += batchSamples;
+        batchSamples = 0;
+        return;
+    }
+    
+    if (millis() - batchStartMs >= batchMaxLatencyMs) {
+        flushBatch();
+    }
+}
+
+void SensythingBLE::setBatching(bool enable, uint16_t maxLatencyMs) {
+    if (!enable && batchSamples > 0 && connected) {
+        flushBatch();  // Do not strand queued samples
+    }
+    batching = enable;
+    batchMaxLatencyMs = maxLatencyMs;
+    sinkStats.samplesDropped += batchSamples;
+    batchSamples = 0;
+}
+
+void SensythingBLE::setDeltaEncoding(bool enable) {
+    if (enable == deltaEncoding) {
+        return;
+    }
+    if (batchSamples > 0 && connected) {
+        flushBatch();  // The pending batch was built in the other layout
+    }
+    sinkStats.samplesDropped += batchSamples;
+    batchSamples = 0;
+    deltaEncoding = enable;
+    deltaEncoder.resetStats();
+}
+
+size_t SensythingBLE::getNotifyPayloadSize() const {
+    size_t payload = negotiatedMTU - 3;  // ATT notification header (opcode + handle)
+    if (payload > SENSYTHING_BLE_MAX_NOTIFY_PAYLOAD) {
+        payload = SENSYTHING_BLE_MAX_NOTIFY_PAYLOAD;
+    }
+    return payload;
+}
+
+void SensythingBLE::addToBatch(const MeasurementData& data, const BoardConfig& config) {
+    if (deltaEncoding) {
+        addToDeltaBatch(data);
+        return;
+    }
+    
+    uint8_t sample[2 * SENSYTHING_MAX_CHANNELS];
+    int sampleSize = formatAsInt16Array(sample, data, config);
+    size_t capacity = getNotifyPayloadSize();
+    
+    // A batch only holds consecutive samples so the receiver can number them
+    if (batchSamples > 0 &&
+        (data.measurement_count != nextBatchSequence ||
+         batchLength + sampleSize > capacity ||
+         batchSamples == UINT8_MAX)) {
+        flushBatch();
+    }
+    
+    if (batchSamples == 0) {
+        memcpy(&batchBuffer[0], &data.measurement_count, 4);
+        batchBuffer[4] = 0;  // Sample count, filled in on flush
+        batchBuffer[5] = (uint8_t)(sampleSize / 2);
+        batchLength = SENSYTHING_BLE_BATCH_HEADER_SIZE;
+        batchStartMs = millis();
+    }
+    
+    memcpy(&batchBuffer[batchLength], sample, sampleSize);
+    batchLength += sampleSize;
+    batchSamples++;
+    nextBatchSequence = data.measurement_count + 1;
+    
+    // Send as soon as another sample would not fit, or the oldest one is due
+    if (batchLength + sampleSize > capacity || millis() - batchStartMs >= batchMaxLatencyMs) {
+        flushBatch();
+    }
+}
+
+void SensythingBLE::addToDeltaBatch(const MeasurementData& data) {
+    size_t capacity = getNotifyPayloadSize();
+    
+    // Records cannot move between notifications once encoded, so send the
+    // batch as soon as a worst-case record might not fit
+    if (batchSamples > 0 &&
+        (batchLength + SENSYTHING_DELTA_MAX_RECORD_SIZE > capacity || batchSamples == UINT8_MAX)) {
+        flushBatch();
+    }
+    
+    if (batchSamples == 0) {
+        if (SENSYTHING_BLE_DELTA_HEADER_SIZE + SENSYTHING_DELTA_MAX_RECORD_SIZE > capacity) {
+            sinkStats.samplesDropped++;  // MTU below SENSYTHING_BLE_DELTA_MIN_MTU
+            return;
+        }
+        deltaEncoder.reset();  // Every notification opens with a keyframe
+        batchLength = SENSYTHING_BLE_DELTA_HEADER_SIZE;
+        batchStartMs = millis();
+    }
+    
+    batchLength += deltaEncoder.encode(&batchBuffer[batchLength], data);
+    batchSamples++;
+    
+    if (batchLength + SENSYTHING_DELTA_MAX_RECORD_SIZE > capacity || millis() - batchStartMs >= batchMaxLatencyMs) {
+        flushBatch();
+    }
+}
+
+void SensythingBLE::flushBatch() {
+    if (batchSamples == 0) {
+        return;
+    }
+    
+    if (deltaEncoding) {
+        batchBuffer[0] = batchSamples;
+    } else {
+        batchBuffer[4] = batchSamples;
+    }
+    pDataCharacteristic->setValue(batchBuffer, batchLength);
+    pDataCharacteristic->notify();
+    notificationsSent++;
+    sinkStats.samplesDelivered += batchSamples;
+    sinkStats.bytesSent += batchLength;
+    
+    batchSamples = 0;
+    batchLength = 0;
 }
 
 int SensythingBLE::formatAsInt16Array(uint8_t* buffer, const MeasurementData& data, const BoardConfig& config) {
@@ -149,3 +350,82 @@ int SensythingBLE::formatAsInt16Array(uint8_t* buffer, const MeasurementData& da
     
     return index;  // Return number of bytes (channelCount × 2)
 }
+
+// =================================================================================================
+// LINK TUNING
+// =================================================================================================
+
+void SensythingBLE::setHighThroughput(bool enable) {
+    if (enable == highThroughput) {
+        return;
+    }
+    highThroughput = enable;
+    if (enable && connected) {
+        requestFastLink();
+    }
+}
+
+void SensythingBLE::requestFastLink() {
+    if (!hasPeer || !pServer) {
+        return;
+    }
+    
+    pServer->updateConnParams(peerAddress,
+                              SENSYTHING_BLE_FAST_CONN_MIN_INTERVAL,
+                              SENSYTHING_BLE_FAST_CONN_MAX_INTERVAL,
+                              SENSYTHING_BLE_FAST_CONN_LATENCY,
+                              SENSYTHING_BLE_FAST_CONN_TIMEOUT);
+    esp_ble_gap_set_preferred_phy(peerAddress, 0,
+                                  ESP_BLE_GAP_PHY_2M_PREF_MASK,
+                                  ESP_BLE_GAP_PHY_2M_PREF_MASK,
+                                  ESP_BLE_GAP_PHY_OPTIONS_NO_PREF);
+}
+
+void SensythingBLE::onClientConnected(esp_ble_gatts_cb_param_t* param) {
+    memcpy(peerAddress, param->connect.remote_bda, sizeof(esp_bd_addr_t));
+    hasPeer = true;
+    connected = true;
+    Serial.println(String(EMOJI_SUCCESS) + " BLE client connected");
+    
+    if (highThroughput) {
+        requestFastLink();
+    }
+}
+
+void SensythingBLE::onClientDisconnected() {
+    connected = false;
+    hasPeer = false;
+    negotiatedMTU = SENSYTHING_BLE_DEFAULT_MTU;
+    connIntervalUnits = 0;
+    txPHY = 1;
+    Serial.println(String(EMOJI_INFO) + " BLE client disconnected");
+    // Restart advertising
+    BLEDevice::startAdvertising();
+}
+
+void SensythingBLE::onMtuChanged(uint16_t mtu) {
+    negotiatedMTU = mtu;
+}
+
+void SensythingBLE::gapEventHandler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t* param) {
+    if (!instance) {
+        return;
+    }
+    
+    switch (event) {
+        case ESP_GAP_BLE_UPDATE_CONN_PARAMS_EVT:
+            if (param->update_conn_params.status == ESP_BT_STATUS_SUCCESS) {
+                instance->connIntervalUnits = param->update_conn_params.conn_int;
+            }
+            break;
+            
+        case ESP_GAP_BLE_PHY_UPDATE_COMPLETE_EVT:
+            if (param->phy_update.status == ESP_BT_STATUS_SUCCESS) {
+                instance->txPHY = param->phy_update.tx_phy;
+            }
+            break;
+            
+        default:
+            break;
+    }
+}
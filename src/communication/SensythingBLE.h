@@ -18,26 +18,39 @@
 #include <BLE2902.h>
 #include "../core/SensythingTypes.h"
 #include "../core/SensythingConfig.h"
+#include "../core/SensythingDeltaCodec.h"
 
-// BLE connection callback class
+// Batched notification layout (little-endian), used when batching is enabled:
+//   [0]  uint32 sequence number of the first sample (measurement_count)
+//   [4]  uint8  sample count S
+//   [5]  uint8  channel count N
+//   [6]  int16  samples[S][N] (same per-channel encoding as single-sample notifications)
+// Samples in a batch are consecutive, so sample k has sequence number [0] + k.
+#define SENSYTHING_BLE_BATCH_HEADER_SIZE 6
+
+// Delta notification layout, used when batching and delta encoding are both enabled:
+//   [0]  uint8  sample count S
+//   [1]  delta records[S] (see SensythingDeltaCodec.h), the first a keyframe
+// Every notification decodes on its own. Values are sent losslessly, so the
+// OX's 19-bit counts are not clipped to int16. A notification must hold one
+// worst-case record, i.e. the client has to negotiate an MTU of at least
+// SENSYTHING_BLE_DELTA_MIN_MTU; until then samples are dropped.
+#define SENSYTHING_BLE_DELTA_HEADER_SIZE 1
+#define SENSYTHING_BLE_DELTA_MIN_MTU (3 + SENSYTHING_BLE_DELTA_HEADER_SIZE + SENSYTHING_DELTA_MAX_RECORD_SIZE)
+
+class SensythingBLE;
+
+// BLE connection callback class (forwards link events to the owning module)
 class BLEConnectionCallbacks : public BLEServerCallbacks {
 public:
-    BLEConnectionCallbacks(bool* connected) : pConnected(connected) {}
-    
-    void onConnect(BLEServer* pServer) override {
-        *pConnected = true;
-        Serial.println(String(EMOJI_SUCCESS) + " BLE client connected");
-    }
+    BLEConnectionCallbacks(SensythingBLE* owner) : pOwner(owner) {}
     
-    void onDisconnect(BLEServer* pServer) override {
-        *pConnected = false;
-        Serial.println(String(EMOJI_INFO) + " BLE client disconnected");
-        // Restart advertising
-        BLEDevice::startAdvertising();
-    }
+    void onConnect(BLEServer* pServer, esp_ble_gatts_cb_param_t* param) override;
+    void onDisconnect(BLEServer* pServer) override;
+    void onMtuChanged(BLEServer* pServer, esp_ble_gatts_cb_param_t* param) override;
     
 private:
-    bool* pConnected;
+    SensythingBLE* pOwner;
 };
 
 class SensythingBLE {
@@ -66,6 +79,88 @@ public:
      */
     void streamData(const MeasurementData& data, const BoardConfig& config);
     
+    /**
+     * Flush a partial batch once it has waited the maximum latency
+     * (call regularly, e.g. from the main loop)
+     */
+    void update();
+    
+    /**
+     * Enable/disable batched notifications
+     * 
+     * When enabled, consecutive samples are packed into one notification (see
+     * layout above) up to the negotiated MTU. A partial batch is sent once its
+     * oldest sample is maxLatencyMs old.
+     * @param enable true to batch, false for one notification per sample
+     * @param maxLatencyMs Maximum time a sample waits for its batch to fill
+     */
+    void setBatching(bool enable, uint16_t maxLatencyMs = SENSYTHING_BLE_BATCH_MAX_LATENCY_MS);
+    
+    bool isBatching() const { return batching; }
+    uint16_t getBatchMaxLatency() const { return batchMaxLatencyMs; }
+    
+    /**
+     * Send batched notifications as delta records (layout above) instead of int16
+     * @param enable true for delta notifications; only affects batching
+     */
+    void setDeltaEncoding(bool enable);
+    
+    bool isDeltaEncoding() const { return deltaEncoding; }
+    
+    /**
+     * Get the delta encoder (compression ratio and cost)
+     */
+    const SensythingDeltaEncoder& getDeltaEncoder() const { return deltaEncoder; }
+    
+    /**
+     * Get the ATT MTU negotiated with the connected client
+     * @return MTU in bytes (SENSYTHING_BLE_DEFAULT_MTU until negotiated)
+     */
+    uint16_t getMTU() const { return negotiatedMTU; }
+    
+    /**
+     * Get the number of notifications sent since initialization
+     * @return Notification count
+     */
+    uint32_t getNotificationCount() const { return notificationsSent; }
+    
+    /**
+     * Get delivery counters since initialization
+     * @return SinkStats snapshot
+     */
+    SinkStats getSinkStats() const { return sinkStats; }
+    
+    /**
+     * Request a link tuned for high-rate streaming
+     * 
+     * When enabled, each connection is asked for the 2M PHY and a short
+     * connection interval (SENSYTHING_BLE_FAST_CONN_MIN/MAX_INTERVAL). The
+     * request is sent immediately if a client is connected. Disabling it
+     * leaves the current link as is and stops requesting on new connections.
+     * @param enable true to request fast link parameters
+     */
+    void setHighThroughput(bool enable);
+    
+    bool isHighThroughput() const { return highThroughput; }
+    
+    /**
+     * Get the current connection interval
+     * @return Interval in microseconds (0 until reported by the controller)
+     */
+    uint32_t getConnIntervalUs() const { return connIntervalUnits * 1250UL; }
+    
+    /**
+     * Get the transmit PHY of the current connection
+     * @return 1 for LE 1M, 2 for LE 2M
+     */
+    uint8_t getPHY() const { return txPHY; }
+    
+    /**
+     * Get the notification rate measured over the last second
+     * @return Notifications per second
+     */
+    float getNotificationRate() const { return notificationRate; }
+    
     /**
      * Check if a BLE client is connected
      * @return true if client connected
@@ -87,6 +182,32 @@ private:
     String deviceName;
     bool connected;
     bool initialized;
+    volatile uint16_t negotiatedMTU;
+    uint32_t notificationsSent;
+    SinkStats sinkStats;
+    
+    // Link parameters (written from BLE stack callbacks)
+    bool highThroughput;
+    bool hasPeer;
+    esp_bd_addr_t peerAddress;
+    volatile uint16_t connIntervalUnits;         // 1.25 ms units
+    volatile uint8_t txPHY;
+    
+    // Notification rate measurement
+    float notificationRate;
+    uint32_t rateWindowCount;
+    unsigned long rateWindowStartMs;
+    
+    // Batching state
+    bool batching;
+    uint16_t batchMaxLatencyMs;
+    uint8_t batchBuffer[SENSYTHING_BLE_MAX_NOTIFY_PAYLOAD];
+    size_t batchLength;
+    uint8_t batchSamples;
+    uint32_t nextBatchSequence;                  // Sequence number that may extend the batch
+    unsigned long batchStartMs;
+    bool deltaEncoding;
+    SensythingDeltaEncoder deltaEncoder;
     
     /**
      * Format measurement data as raw Int16 array for GATT notifications
@@ -97,6 +218,41 @@ private:
      */
     int formatAsInt16Array(uint8_t* buffer, const MeasurementData& data, const BoardConfig& config);
     
+    /**
+     * Add a sample to the pending batch, sending the batch when it is full
+     */
+    void addToBatch(const MeasurementData& data, const BoardConfig& config);
+    
+    /**
+     * Add a sample to the pending delta notification, sending it when full
+     */
+    void addToDeltaBatch(const MeasurementData& data);
+    
+    /**
+     * Send the pending batch (if any) as one notification
+     */
+    void flushBatch();
+    
+    /**
+     * Largest notification payload the current connection allows
+     */
+    size_t getNotifyPayloadSize() const;
+    
+    /**
+     * Ask the controller for the 2M PHY and a short connection interval
+     */
+    void requestFastLink();
+    
+    // Link event handlers (called from BLEConnectionCallbacks / GAP handler)
+    void onClientConnected(esp_ble_gatts_cb_param_t* param);
+    void onClientDisconnected();
+    void onMtuChanged(uint16_t mtu);
+    static void gapEventHandler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t* param);
+    
+    static SensythingBLE* instance;  // For the static GAP handler
+    
+    friend class BLEConnectionCallbacks;
+    friend class SensythingBenchmark;
 };
 
 #endif // SENSYTHING_BLE_H
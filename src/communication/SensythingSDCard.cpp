@@ -2,28 +2,54 @@
 //    (c) 2025 Protocentral Electronics
 //
 //    Sensything Platform - SD Card Communication Module
-//    SDIO-based CSV data logging with buffered writes
+//    SDIO-based CSV data logging with a double-buffered background writer
 //
 //    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
 //
 //////////////////////////////////////////////////////////////////////////////////////////
 
 #include "SensythingSDCard.h"
+#include "../core/SensythingCRC.h"
+
+// Upper bounds of the write latency histogram buckets (last bucket is open-ended)
+static const uint32_t LATENCY_BUCKET_LIMITS_US[SENSYTHING_SD_LATENCY_BUCKETS - 1] = {
+    1000, 2000, 5000, 10000, 20000, 50000, 100000
+};
 
 SensythingSDCard::SensythingSDCard() {
     cardReady = false;
     fileOpen = false;
     headerWritten = false;
+    logFormat = SENSYTHING_SD_CSV;
+    binaryChannelCount = 0;
+    blockRecords = 0;
+    blockCRC = SENSYTHING_CRC16_INIT;
     fileCount = 0;
     linesWritten = 0;
     bufferLineCount = 0;
     currentFileName = "";
-    buffer = "";
+    
+    bufferBusy[0] = false;
+    bufferBusy[1] = false;
+    activeBuffer = 0;
+    activeLength = 0;
+    lastSyncMs = 0;
+    bytesSinceSync = 0;
+    
+    writerTaskHandle = nullptr;
+    jobQueue = nullptr;
+    writeError = false;
+    memset(&writerStats, 0, sizeof(writerStats));
+    memset(&sinkStats, 0, sizeof(sinkStats));
 }
 
 SensythingSDCard::~SensythingSDCard() {
+    if (cardReady && fileOpen) {
+        closeSyncBlock();
+        submitFinalBuffer();  // Write remaining buffer data
+    }
+    stopWriter();  // Drains queued jobs and closes the file
     if (cardReady) {
-        flush();  // Write remaining buffer data
         SD_MMC.end();
     }
 }
@@ -73,6 +99,12 @@ bool SensythingSDCard::init() {
     uint64_t usedBytes = SD_MMC.usedBytes() / (1024 * 1024);
     Serial.printf("%s Used Space: %lluMB\n", EMOJI_INFO, usedBytes);
     
+    if (!startWriter()) {
+        Serial.println(String(EMOJI_ERROR) + " Failed to start SD writer task");
+        SD_MMC.end();
+        return false;
+    }
+    
     cardReady = true;
     return true;
 }
@@ -82,6 +114,12 @@ void SensythingSDCard::logData(const MeasurementData& data, const BoardConfig& c
         return;  // Card not ready, skip silently
     }
     
+    if (writeError) {
+        Serial.println(String(EMOJI_ERROR) + " SD write failed, logging disabled");
+        cardReady = false;  // Disable logging on error
+        return;
+    }
+    
     // Create file if needed
     if (!fileOpen) {
         if (!createNewFile(config)) {
@@ -91,21 +129,56 @@ void SensythingSDCard::logData(const MeasurementData& data, const BoardConfig& c
         }
     }
     
-    // Format data as CSV and add to buffer
-    buffer += formatAsCSV(data, config);
-    buffer += "\n";
-    bufferLineCount++;
+    bool stored;
+    if (logFormat == SENSYTHING_SD_BINARY) {
+        stored = logBinaryRecord(data);
+    } else {
+        // Format data as CSV and copy it into the write buffer
+        char line[SENSYTHING_CSV_LINE_SIZE];
+        SensythingTextWriter out(line, sizeof(line));
+        formatAsCSV(out, data, config);
+        out.append('\n');
+        stored = appendToLog((const uint8_t*)out.c_str(), out.length());
+    }
+    
+    if (stored) {
+        bufferLineCount++;
+        linesWritten++;
+        sinkStats.samplesDelivered++;
+    } else {
+        sinkStats.samplesDropped++;
+    }
     
-    // Write buffer if full
-    if (bufferLineCount >= SENSYTHING_SD_BUFFER_LINES) {
-        writeBuffer(false);
+    // Sync policy: push out partial data and update the directory entry
+    // periodically, not on every buffer
+    unsigned long now = millis();
+    if (now - lastSyncMs >= SENSYTHING_SD_SYNC_INTERVAL_MS || bytesSinceSync >= SENSYTHING_SD_SYNC_BYTES) {
+        flush();
     }
 }
 
 void SensythingSDCard::flush() {
-    if (bufferLineCount > 0) {
-        writeBuffer(true);
+    if (!fileOpen) {
+        return;
+    }
+    
+    closeSyncBlock();  // Make everything that gets synced verifiable
+    if (activeLength > 0) {
+        submitActiveBuffer();
     }
+    queueJob(SD_JOB_SYNC);
+    lastSyncMs = millis();
+    bytesSinceSync = 0;
+}
+
+void SensythingSDCard::setFormat(SensythingSDFormat format) {
+    if (format == logFormat) {
+        return;
+    }
+    if (fileOpen) {
+        rotateFile();
+    }
+    logFormat = format;
 }
 
 bool SensythingSDCard::rotateFile() {
@@ -113,10 +186,14 @@ bool SensythingSDCard::rotateFile() {
         return false;
     }
     
-    // Flush current buffer
-    flush();
+    // Flush current buffer and close the file on the writer task
+    if (fileOpen) {
+        closeSyncBlock();
+        submitFinalBuffer();
+        queueJob(SD_JOB_CLOSE);
+    }
     
-    // Close current file (by resetting state)
+    // Next logData() opens a new file
     fileOpen = false;
     headerWritten = false;
     linesWritten = 0;
@@ -129,13 +206,27 @@ bool SensythingSDCard::rotateFile() {
 bool SensythingSDCard::createNewFile(const BoardConfig& config) {
     // Generate filename with timestamp
     fileCount++;
-    currentFileName = String(SENSYTHING_SD_FILE_PREFIX) + String(fileCount) + ".csv";
+    currentFileName = String(SENSYTHING_SD_FILE_PREFIX) + String(fileCount) +
+                      (logFormat == SENSYTHING_SD_BINARY ? ".bin" : ".csv");
     
     Serial.print(String(EMOJI_STORAGE) + " Creating file: ");
     Serial.println(currentFileName);
     
-    // Write header if enabled
-    if (SENSYTHING_SD_CSV_HEADER && !headerWritten) {
+    // The writer task opens the file; it stays open until rotation
+    SDJob job = {};
+    job.type = SD_JOB_OPEN;
+    snprintf(job.fileName, sizeof(job.fileName), "/%s", currentFileName.c_str());
+    if (xQueueSend(jobQueue, &job, 0) != pdTRUE) {
+        return false;
+    }
+    lastSyncMs = millis();
+    bytesSinceSync = 0;
+    
+    // Write header if enabled (binary files always describe themselves)
+    if (logFormat == SENSYTHING_SD_BINARY) {
+        writeBinaryHeader(config);
+        headerWritten = true;
+    } else if (SENSYTHING_SD_CSV_HEADER && !headerWritten) {
         writeHeader(config);
         headerWritten = true;
     }
@@ -147,90 +238,300 @@ bool SensythingSDCard::createNewFile(const BoardConfig& config) {
 }
 
 void SensythingSDCard::writeHeader(const BoardConfig& config) {
-    File file = SD_MMC.open("/" + currentFileName, FILE_APPEND);
-    if (!file) {
-        Serial.println(String(EMOJI_ERROR) + " Failed to open file for header");
-        return;
-    }
-    
     // Build CSV header
-    String header = "timestamp,count";
+    char header[SENSYTHING_CSV_HEADER_SIZE];
+    SensythingTextWriter out(header, sizeof(header));
+    out.append("timestamp,count");
     
     for (int i = 0; i < config.channelCount; i++) {
-        header += ",";
-        header += config.channels[i].label;
+        out.append(',').append(config.channels[i].label);
         
         // Add metadata column for Cap board (CAPDAC)
-        if (config.boardType == BOARD_TYPE_CAP) {
-            header += ",";
-            header += config.channels[i].label;
-            header += "_capdac";
+        if (sensythingHasMetadataColumns(config)) {
+            out.append(',').append(config.channels[i].label).append("_capdac");
         }
     }
     
-    header += ",status_flags\n";
+    out.append(",status_flags\n");
     
-    file.print(header);
-    file.close();
+    // Goes through the write buffer like any other line
+    if (!appendToLog((const uint8_t*)out.c_str(), out.length())) {
+        Serial.println(String(EMOJI_ERROR) + " Failed to queue header");
+        return;
+    }
     
     Serial.println(String(EMOJI_SUCCESS) + " Header written");
 }
 
-String SensythingSDCard::formatAsCSV(const MeasurementData& data, const BoardConfig& config) {
-    String csv = String(data.timestamp);
-    csv += ",";
-    csv += String(data.measurement_count);
+void SensythingSDCard::writeBinaryHeader(const BoardConfig& config) {
+    uint8_t header[SENSYTHING_LOG_HEADER_MAX_SIZE];
+    size_t headerSize = sensythingEncodeLogHeader(header, config, SENSYTHING_SD_BINARY_SYNC_RECORDS);
+    
+    binaryChannelCount = header[6];
+    blockRecords = 0;
+    blockCRC = SENSYTHING_CRC16_INIT;
+    
+    if (!appendToLog(header, headerSize)) {
+        Serial.println(String(EMOJI_ERROR) + " Failed to queue header");
+        return;
+    }
+    
+    Serial.println(String(EMOJI_SUCCESS) + " Binary header written");
+}
+
+bool SensythingSDCard::logBinaryRecord(const MeasurementData& data) {
+    uint8_t record[SENSYTHING_LOG_RECORD_MAX_SIZE];
+    size_t recordSize = sensythingEncodeLogRecord(record, data, binaryChannelCount);
+    
+    if (!appendToLog(record, recordSize)) {
+        return false;
+    }
+    
+    blockCRC = sensythingCRC16(record, recordSize, blockCRC);
+    blockRecords++;
+    if (blockRecords >= SENSYTHING_SD_BINARY_SYNC_RECORDS) {
+        closeSyncBlock();
+    }
+    return true;
+}
+
+void SensythingSDCard::closeSyncBlock() {
+    if (logFormat != SENSYTHING_SD_BINARY || blockRecords == 0) {
+        return;
+    }
+    
+    // If the trailer is dropped, the block is still recoverable as unverified
+    // records before the next trailer
+    uint8_t trailer[SENSYTHING_LOG_SYNC_SIZE];
+    size_t trailerSize = sensythingEncodeLogSync(trailer, blockRecords, blockCRC);
+    appendToLog(trailer, trailerSize);
+    
+    blockRecords = 0;
+    blockCRC = SENSYTHING_CRC16_INIT;
+}
+
+size_t SensythingSDCard::formatAsCSV(SensythingTextWriter& out, const MeasurementData& data, const BoardConfig& config) {
+    out.appendUInt(data.timestamp);
+    out.append(',').appendUInt(data.measurement_count);
     
     // Add channel data
     for (int i = 0; i < config.channelCount; i++) {
-        csv += ",";
+        out.append(',');
         
         // Check if channel is valid
         bool channelValid = !(data.status_flags & (1 << i));
         if (channelValid) {
-            csv += String(data.channels[i], 4);  // 4 decimal places
+            out.appendFixed(data.channels[i], SENSYTHING_CSV_PRECISION);
         } else {
-            csv += "NaN";
+            out.append("NaN");
         }
         
         // Add metadata for Cap board
-        if (config.boardType == BOARD_TYPE_CAP) {
-            csv += ",";
-            csv += String(data.metadata[i]);
+        if (sensythingHasMetadataColumns(config)) {
+            out.append(',').appendUInt(data.metadata[i]);
         }
     }
     
     // Add status flags
-    csv += ",";
-    csv += String(data.status_flags, HEX);
+    out.append(',').appendHex(data.status_flags);
+    
+    return out.length();
+}
+
+// =================================================================================================
+// DOUBLE-BUFFERED WRITER
+// =================================================================================================
+
+bool SensythingSDCard::appendToLog(const uint8_t* data, size_t length) {
+    // Lines may straddle buffers so every full buffer is exactly sector sized;
+    // check space up front so a line is either stored whole or dropped whole
+    size_t space = SENSYTHING_SD_WRITE_BUFFER_SIZE - activeLength;
+    if (length > space && bufferBusy[activeBuffer ^ 1]) {
+        writerStats.overruns++;
+        return false;
+    }
+    
+    while (length > 0) {
+        size_t chunk = SENSYTHING_SD_WRITE_BUFFER_SIZE - activeLength;
+        if (chunk > length) {
+            chunk = length;
+        }
+        memcpy(&writeBuffers[activeBuffer][activeLength], data, chunk);
+        activeLength += chunk;
+        data += chunk;
+        length -= chunk;
+        
+        if (activeLength == SENSYTHING_SD_WRITE_BUFFER_SIZE && !submitActiveBuffer()) {
+            writerStats.overruns++;  // Writer queue full; the rest of the line is lost
+            return false;
+        }
+    }
+    return true;
+}
+
+bool SensythingSDCard::submitActiveBuffer() {
+    uint8_t next = activeBuffer ^ 1;
+    if (bufferBusy[next]) {
+        return false;  // Keep filling; caller accounts for the overrun
+    }
+    
+    SDJob job = {};
+    job.type = SD_JOB_WRITE;
+    job.bufferIndex = activeBuffer;
+    job.length = activeLength;
+    
+    bufferBusy[activeBuffer] = true;
+    if (xQueueSend(jobQueue, &job, 0) != pdTRUE) {
+        bufferBusy[activeBuffer] = false;
+        return false;
+    }
     
-    return csv;
+    bytesSinceSync += activeLength;
+    activeBuffer = next;
+    activeLength = 0;
+    bufferLineCount = 0;
+    return true;
 }
 
-void SensythingSDCard::writeBuffer(bool force) {
-    if (!cardReady || bufferLineCount == 0) {
+void SensythingSDCard::submitFinalBuffer() {
+    if (activeLength == 0) {
         return;
     }
     
-    if (!force && bufferLineCount < SENSYTHING_SD_BUFFER_LINES) {
-        return;  // Buffer not full yet
+    // The tail would otherwise be lost when the previous buffer is still
+    // being written as the file is closed
+    while (bufferBusy[activeBuffer ^ 1] && writerTaskHandle) {
+        vTaskDelay(pdMS_TO_TICKS(1));
+    }
+    if (!submitActiveBuffer()) {
+        writerStats.overruns++;
+    }
+}
+
+bool SensythingSDCard::queueJob(SDJobType type) {
+    SDJob job = {};
+    job.type = type;
+    return xQueueSend(jobQueue, &job, 0) == pdTRUE;
+}
+
+bool SensythingSDCard::startWriter() {
+    if (writerTaskHandle) {
+        return true;
     }
     
-    // Open file in append mode
-    File file = SD_MMC.open("/" + currentFileName, FILE_APPEND);
-    if (!file) {
-        Serial.println(String(EMOJI_ERROR) + " Failed to open file for writing");
-        cardReady = false;  // Disable logging on error
+    jobQueue = xQueueCreate(SENSYTHING_SD_QUEUE_DEPTH, sizeof(SDJob));
+    if (!jobQueue) {
+        return false;
+    }
+    
+    BaseType_t created = xTaskCreatePinnedToCore(
+        &SensythingSDCard::writerTaskEntry, "sensything_sd",
+        SENSYTHING_SD_TASK_STACK_SIZE, this, SENSYTHING_SD_TASK_PRIORITY,
+        &writerTaskHandle, SENSYTHING_SD_TASK_CORE);
+    if (created != pdPASS) {
+        writerTaskHandle = nullptr;
+        vQueueDelete(jobQueue);
+        jobQueue = nullptr;
+        return false;
+    }
+    return true;
+}
+
+void SensythingSDCard::stopWriter() {
+    if (!writerTaskHandle) {
         return;
     }
     
-    // Write buffer
-    file.print(buffer);
-    linesWritten += bufferLineCount;
+    // Queued jobs run first, so everything submitted so far reaches the card
+    SDJob job = {};
+    job.type = SD_JOB_CLOSE;
+    xQueueSend(jobQueue, &job, portMAX_DELAY);
+    job.type = SD_JOB_STOP;
+    xQueueSend(jobQueue, &job, portMAX_DELAY);
+    while (writerTaskHandle) {
+        vTaskDelay(pdMS_TO_TICKS(1));
+    }
     
-    file.close();
+    vQueueDelete(jobQueue);
+    jobQueue = nullptr;
+}
+
+void SensythingSDCard::writerTaskEntry(void* arg) {
+    SensythingSDCard* sd = static_cast<SensythingSDCard*>(arg);
+    sd->writerTaskLoop();
     
-    // Clear buffer
-    buffer = "";
-    bufferLineCount = 0;
+    sd->writerTaskHandle = nullptr;
+    vTaskDelete(nullptr);
+}
+
+void SensythingSDCard::writerTaskLoop() {
+    SDJob job;
+    while (xQueueReceive(jobQueue, &job, portMAX_DELAY) == pdTRUE) {
+        switch (job.type) {
+            case SD_JOB_OPEN:
+                if (logFile) {
+                    logFile.close();
+                }
+                logFile = SD_MMC.open(job.fileName, FILE_APPEND);
+                if (!logFile) {
+                    writeError = true;
+                }
+                break;
+                
+            case SD_JOB_WRITE: {
+                if (logFile) {
+                    uint32_t start = micros();
+                    size_t written = logFile.write(writeBuffers[job.bufferIndex], job.length);
+                    recordWriteLatency(micros() - start);
+                    writerStats.buffersWritten++;
+                    writerStats.bytesWritten += written;
+                    if (written != job.length) {
+                        writeError = true;
+                    }
+                }
+                bufferBusy[job.bufferIndex] = false;
+                break;
+            }
+                
+            case SD_JOB_SYNC:
+                if (logFile) {
+                    logFile.flush();
+                    writerStats.syncs++;
+                }
+                break;
+                
+            case SD_JOB_CLOSE:
+                if (logFile) {
+                    logFile.close();  // Also syncs
+                    writerStats.syncs++;
+                }
+                break;
+                
+            case SD_JOB_STOP:
+                return;
+        }
+    }
+}
+
+void SensythingSDCard::recordWriteLatency(uint32_t latencyUs) {
+    uint8_t bucket = 0;
+    while (bucket < SENSYTHING_SD_LATENCY_BUCKETS - 1 && latencyUs >= LATENCY_BUCKET_LIMITS_US[bucket]) {
+        bucket++;
+    }
+    writerStats.latencyHistogram[bucket]++;
+    writerStats.lastLatencyUs = latencyUs;
+    writerStats.totalLatencyUs += latencyUs;
+    if (latencyUs > writerStats.maxLatencyUs) {
+        writerStats.maxLatencyUs = latencyUs;
+    }
+}
+
+SinkStats SensythingSDCard::getSinkStats() const {
+    SinkStats stats = sinkStats;
+    stats.bytesSent = writerStats.bytesWritten;
+    return stats;
+}
+
+uint32_t SensythingSDCard::getLatencyBucketLimitUs(uint8_t bucket) {
+    return (bucket < SENSYTHING_SD_LATENCY_BUCKETS - 1) ? LATENCY_BUCKET_LIMITS_US[bucket] : 0;
 }
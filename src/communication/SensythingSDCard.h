@@ -2,7 +2,7 @@
 //    (c) 2025 Protocentral Electronics
 //
 //    SensythingES3 - SD Card Communication Module
-//    SDIO-based CSV data logging with buffered writes
+//    SDIO-based CSV data logging with a double-buffered background writer
 //
 //    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
 //
@@ -15,6 +15,31 @@
 #include <SD_MMC.h>
 #include "../core/SensythingTypes.h"
 #include "../core/SensythingConfig.h"
+#include "../core/SensythingFormat.h"
+#include "../core/SensythingLogFormat.h"
+
+// Log file format
+typedef enum {
+    SENSYTHING_SD_CSV,        // Text CSV (.csv, default)
+    SENSYTHING_SD_BINARY      // Fixed-size binary records (.bin, see SensythingLogFormat.h)
+} SensythingSDFormat;
+
+// Writer jobs, executed in order by the background task. All file access
+// happens on that task, so the streaming path only copies bytes into RAM.
+typedef enum {
+    SD_JOB_OPEN,      // Open fileName for appending
+    SD_JOB_WRITE,     // Write length bytes from write buffer bufferIndex
+    SD_JOB_SYNC,      // Flush file data and directory entry to the card
+    SD_JOB_CLOSE,     // Sync and close the current file
+    SD_JOB_STOP       // Exit the task
+} SDJobType;
+
+typedef struct {
+    SDJobType type;
+    uint8_t bufferIndex;
+    size_t length;
+    char fileName[32];
+} SDJob;
 
 class SensythingSDCard {
 public:
@@ -41,10 +66,24 @@ public:
     void logData(const MeasurementData& data, const BoardConfig& config);
     
     /**
-     * Force flush of buffer to file
+     * Hand the partially filled buffer to the writer and request a sync
+     * (returns immediately; the card is written in the background)
      */
     void flush();
     
+    /**
+     * Select the log format; an open file is closed so the next one starts
+     * with the matching header
+     * @param format SENSYTHING_SD_CSV or SENSYTHING_SD_BINARY
+     */
+    void setFormat(SensythingSDFormat format);
+    
+    /**
+     * Get the current log format
+     * @return Active log format
+     */
+    SensythingSDFormat getFormat() const { return logFormat; }
+    
     /**
      * Rotate to new file (creates new timestamped file)
      * @return true if successful
@@ -65,28 +104,68 @@ public:
     
     /**
      * Get buffer fill level
-     * @return Number of lines in buffer (0-SENSYTHING_SD_BUFFER_LINES)
+     * @return Number of lines waiting in the active buffer
      */
-    uint8_t getBufferLevel() const { return bufferLineCount; }
+    uint16_t getBufferLevel() const { return bufferLineCount; }
     
     /**
-     * Get total lines written to current file
+     * Get total lines logged to current file
      * @return Line counter
      */
     uint32_t getLinesWritten() const { return linesWritten; }
     
+    /**
+     * Get background writer statistics (write latency histogram etc.)
+     * @return SDWriterStats snapshot
+     */
+    SDWriterStats getWriterStats() const { return writerStats; }
+    
+    /**
+     * Get delivery counters since initialization
+     * @return SinkStats snapshot (bytesSent counts bytes written to the card)
+     */
+    SinkStats getSinkStats() const;
+    
+    /**
+     * Upper bound (exclusive) of a latency histogram bucket
+     * @param bucket Bucket index
+     * @return Bound in microseconds, 0 for the open-ended last bucket
+     */
+    static uint32_t getLatencyBucketLimitUs(uint8_t bucket);
+    
 private:
     bool cardReady;
     bool fileOpen;
     bool headerWritten;
+    SensythingSDFormat logFormat;
+    
+    // Binary format state
+    uint8_t binaryChannelCount;                  // Channels per record in the current file
+    uint16_t blockRecords;                       // Records since the last sync trailer
+    uint16_t blockCRC;                           // Running CRC over those records
     
     String currentFileName;
     uint32_t fileCount;
     uint32_t linesWritten;
     
-    // Buffer for batch writes
-    String buffer;
-    uint8_t bufferLineCount;
+    // Double buffer: the streaming path fills writeBuffers[activeBuffer] while
+    // the task writes the other one. Buffers are whole sectors, so apart from
+    // the partial buffer written before a sync, card writes are sector multiples.
+    alignas(4) uint8_t writeBuffers[2][SENSYTHING_SD_WRITE_BUFFER_SIZE];
+    volatile bool bufferBusy[2];                 // Set when queued, cleared by the task
+    uint8_t activeBuffer;
+    size_t activeLength;
+    uint16_t bufferLineCount;
+    unsigned long lastSyncMs;
+    uint32_t bytesSinceSync;
+    
+    // Background writer
+    TaskHandle_t writerTaskHandle;
+    QueueHandle_t jobQueue;
+    File logFile;
+    volatile bool writeError;
+    SDWriterStats writerStats;
+    SinkStats sinkStats;
     
     /**
      * Create new log file with timestamp
@@ -102,18 +181,72 @@ private:
     void writeHeader(const BoardConfig& config);
     
     /**
-     * Format measurement data as CSV line
+     * Write the self-describing binary header
+     * @param config Board configuration
+     */
+    void writeBinaryHeader(const BoardConfig& config);
+    
+    /**
+     * Append one binary record, closing the sync block when it is full
+     * @return false if the record was dropped
+     */
+    bool logBinaryRecord(const MeasurementData& data);
+    
+    /**
+     * Append a sync trailer for the records written since the last one
+     */
+    void closeSyncBlock();
+    
+    /**
+     * Format measurement data as CSV line (without line terminator)
+     * @param out Writer to append to
      * @param data Measurement data
      * @param config Board configuration
-     * @return CSV string
+     * @return Formatted length in bytes
+     */
+    size_t formatAsCSV(SensythingTextWriter& out, const MeasurementData& data, const BoardConfig& config);
+    
+    /**
+     * Copy bytes into the active buffer, handing full buffers to the writer
+     * @return false if data was dropped because both buffers were busy
+     */
+    bool appendToLog(const uint8_t* data, size_t length);
+    
+    /**
+     * Queue the active buffer for writing and switch to the other one
+     * @return false if the other buffer is still being written
+     */
+    bool submitActiveBuffer();
+    
+    /**
+     * Queue the partially filled buffer before the file is closed, waiting
+     * for the writer to free the other buffer (at most one buffer write)
+     */
+    void submitFinalBuffer();
+    
+    /**
+     * Queue a job without data for the writer task
+     */
+    bool queueJob(SDJobType type);
+    
+    /**
+     * Start/stop the background writer task
+     */
+    bool startWriter();
+    void stopWriter();
+    
+    /**
+     * Body of the writer task
      */
-    String formatAsCSV(const MeasurementData& data, const BoardConfig& config);
+    void writerTaskLoop();
+    static void writerTaskEntry(void* arg);
     
     /**
-     * Write buffer to file if buffer is full or forced
-     * @param force Force write even if buffer not full
+     * Record the duration of one buffer write
      */
-    void writeBuffer(bool force = false);
+    void recordWriteLatency(uint32_t latencyUs);
+    
+    friend class SensythingBenchmark;
 };
 
 #endif // SENSYTHING_SDCARD_H
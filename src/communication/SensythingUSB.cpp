@@ -8,12 +8,16 @@
 //////////////////////////////////////////////////////////////////////////////////////////
 
 #include "SensythingUSB.h"
+#include "../core/SensythingCRC.h"
 
 SensythingUSB::SensythingUSB() {
     useEmojis = SENSYTHING_USB_USE_EMOJIS;
     useTimestamp = SENSYTHING_USB_TIMESTAMP;
     csvSeparator = ',';
+    outputFormat = SENSYTHING_USB_CSV;
     headerPrinted = false;
+    deltaEncoding = false;
+    memset(&sinkStats, 0, sizeof(sinkStats));
 }
 
 void SensythingUSB::setUseEmojis(bool enable) {
@@ -28,85 +32,162 @@ void SensythingUSB::setSeparator(char separator) {
     csvSeparator = separator;
 }
 
+void SensythingUSB::setFormat(SensythingUSBFormat format) {
+    if (format == SENSYTHING_USB_CSV && outputFormat != SENSYTHING_USB_CSV) {
+        headerPrinted = false;  // Re-announce columns for the text stream
+    }
+    if (format != outputFormat) {
+        deltaEncoder.reset();
+    }
+    outputFormat = format;
+}
+
+void SensythingUSB::setDeltaEncoding(bool enable) {
+    if (enable != deltaEncoding) {
+        deltaEncoder.reset();
+        deltaEncoder.resetStats();
+    }
+    deltaEncoding = enable;
+}
+
 void SensythingUSB::printCSVHeader(const BoardConfig& config) {
     if (headerPrinted) return;
     
-    String header = "";
+    char header[SENSYTHING_CSV_HEADER_SIZE];
+    SensythingTextWriter out(header, sizeof(header));
     
     if (useEmojis) {
-        header += String(EMOJI_DATA) + " ";
+        out.append(EMOJI_DATA).append(' ');
     }
     
     if (useTimestamp) {
-        header += "timestamp" + String(csvSeparator);
+        out.append("timestamp").append(csvSeparator);
     }
     
     // Add channel headers
     for (int i = 0; i < config.channelCount; i++) {
-        header += String(config.channels[i].label);
+        out.append(config.channels[i].label);
         if (i < config.channelCount - 1) {
-            header += csvSeparator;
+            out.append(csvSeparator);
         }
     }
     
     // Add metadata headers based on board type
-    if (config.boardType == BOARD_TYPE_CAP) {
+    if (sensythingHasMetadataColumns(config)) {
         for (int i = 0; i < config.channelCount; i++) {
-            header += csvSeparator;
-            header += "capdac_" + String(i);
+            out.append(csvSeparator).append("capdac_").appendUInt(i);
         }
     }
     
-    header += csvSeparator + "status_flags";
-    header += csvSeparator + "count";
+    out.append(csvSeparator).append("status_flags");
+    out.append(csvSeparator).append("count");
     
-    Serial.println(header);
+    Serial.println(out.c_str());
     headerPrinted = true;
 }
 
-String SensythingUSB::formatAsCSV(const MeasurementData& data, const BoardConfig& config) {
-    String csv = "";
-    
+size_t SensythingUSB::formatAsCSV(SensythingTextWriter& out, const MeasurementData& data, const BoardConfig& config) {
     if (useEmojis) {
-        csv += String(EMOJI_DATA) + " ";
+        out.append(EMOJI_DATA).append(' ');
     }
     
     if (useTimestamp) {
-        csv += String(data.timestamp) + csvSeparator;
+        out.appendUInt(data.timestamp).append(csvSeparator);
     }
     
     // Add channel data
     for (int i = 0; i < data.channel_count; i++) {
-        csv += String(data.channels[i], 4);  // 4 decimal places
+        out.appendFixed(data.channels[i], SENSYTHING_CSV_PRECISION);
         if (i < data.channel_count - 1) {
-            csv += csvSeparator;
+            out.append(csvSeparator);
         }
     }
     
     // Add metadata based on board type
-    if (config.boardType == BOARD_TYPE_CAP) {
+    if (sensythingHasMetadataColumns(config)) {
         for (int i = 0; i < data.channel_count; i++) {
-            csv += csvSeparator;
-            csv += String(data.metadata[i]);
+            out.append(csvSeparator).appendUInt(data.metadata[i]);
         }
-    } else if (config.boardType == BOARD_TYPE_OX) {
-        // For OX, metadata might contain different info
-        // Can be extended based on needs
     }
     
-    csv += csvSeparator + "0x" + String(data.status_flags, HEX);
-    csv += csvSeparator + String(data.measurement_count);
+    out.append(csvSeparator).append("0x").appendHex(data.status_flags);
+    out.append(csvSeparator).appendUInt(data.measurement_count);
+    
+    return out.length();
+}
+
+size_t SensythingUSB::formatAsFrame(uint8_t* buffer, const MeasurementData& data) {
+    uint8_t channelCount = data.channel_count;
+    if (channelCount > SENSYTHING_MAX_CHANNELS) {
+        channelCount = SENSYTHING_MAX_CHANNELS;
+    }
+    
+    size_t index = SENSYTHING_USB_FRAME_HEADER_SIZE;
     
-    return csv;
+    // ESP32-S3 is little-endian, so fields are copied as-is
+    memcpy(&buffer[index], &data.measurement_count, 4);
+    index += 4;
+    memcpy(&buffer[index], &data.timestamp, 4);
+    index += 4;
+    buffer[index++] = channelCount;
+    buffer[index++] = data.status_flags;
+    memcpy(&buffer[index], data.channels, 4 * channelCount);
+    index += 4 * channelCount;
+    memcpy(&buffer[index], data.metadata, channelCount);
+    index += channelCount;
+    
+    return finishFrame(buffer, SENSYTHING_USB_FRAME_MEASUREMENT, index - SENSYTHING_USB_FRAME_HEADER_SIZE);
+}
+
+size_t SensythingUSB::formatAsDeltaFrame(uint8_t* buffer, const MeasurementData& data) {
+    size_t length = deltaEncoder.encode(&buffer[SENSYTHING_USB_FRAME_HEADER_SIZE], data);
+    return finishFrame(buffer, SENSYTHING_USB_FRAME_DELTA, length);
+}
+
+size_t SensythingUSB::finishFrame(uint8_t* buffer, uint8_t type, size_t payloadLength) {
+    size_t index = 0;
+    buffer[index++] = SENSYTHING_USB_FRAME_SYNC0;
+    buffer[index++] = SENSYTHING_USB_FRAME_SYNC1;
+    buffer[index++] = type;
+    buffer[index++] = (uint8_t)payloadLength;
+    index += payloadLength;
+    
+    uint16_t crc = sensythingCRC16(&buffer[2], index - 2);
+    buffer[index++] = crc & 0xFF;
+    buffer[index++] = (crc >> 8) & 0xFF;
+    
+    return index;
 }
 
 void SensythingUSB::streamData(const MeasurementData& data, const BoardConfig& config) {
+    if (outputFormat == SENSYTHING_USB_BINARY) {
+        uint8_t frame[SENSYTHING_USB_FRAME_MAX_SIZE];
+        size_t frameSize = deltaEncoding ? formatAsDeltaFrame(frame, data) : formatAsFrame(frame, data);
+        size_t written = Serial.write(frame, frameSize);
+        if (written != frameSize) {
+            deltaEncoder.reset();  // The receiver lost this record; resume with a keyframe
+        }
+        countWrite(written, frameSize);
+        return;
+    }
+    
     // Print header once
     if (!headerPrinted) {
         printCSVHeader(config);
     }
     
-    // Format and print data
-    String csvLine = formatAsCSV(data, config);
-    Serial.println(csvLine);
+    // Format the line with its terminator so it goes out in one write
+    SensythingTextWriter out(lineBuffer, sizeof(lineBuffer));
+    formatAsCSV(out, data, config);
+    out.append("\r\n");
+    countWrite(Serial.write((const uint8_t*)out.c_str(), out.length()), out.length());
+}
+
+void SensythingUSB::countWrite(size_t written, size_t length) {
+    sinkStats.bytesSent += written;
+    if (written == length) {
+        sinkStats.samplesDelivered++;
+    } else {
+        sinkStats.samplesDropped++;
+    }
 }
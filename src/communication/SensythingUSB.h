@@ -14,6 +14,36 @@
 #include <Arduino.h>
 #include "../core/SensythingTypes.h"
 #include "../core/SensythingConfig.h"
+#include "../core/SensythingFormat.h"
+#include "../core/SensythingDeltaCodec.h"
+
+// USB output format
+typedef enum {
+    SENSYTHING_USB_CSV,       // Human-readable CSV lines (default)
+    SENSYTHING_USB_BINARY     // Compact framed binary records (see below)
+} SensythingUSBFormat;
+
+// Binary frame layout (little-endian):
+//   [0]    0xA5  sync
+//   [1]    0x5A  sync
+//   [2]    frame type (SENSYTHING_USB_FRAME_MEASUREMENT)
+//   [3]    payload length L (bytes 4 .. 4+L-1)
+//   [4]    uint32 sequence number (measurement_count)
+//   [8]    uint32 timestamp (ms)
+//   [12]   uint8  channel count N
+//   [13]   uint8  status flags
+//   [14]   float32 channels[N]
+//   [..]   uint8  metadata[N]
+//   [4+L]  uint16 CRC-16/CCITT-FALSE over bytes 2 .. 4+L-1
+// With delta encoding enabled the frame type is SENSYTHING_USB_FRAME_DELTA and
+// the payload is one delta record (see SensythingDeltaCodec.h). After a CRC
+// error the receiver discards records until the next keyframe.
+#define SENSYTHING_USB_FRAME_SYNC0 0xA5
+#define SENSYTHING_USB_FRAME_SYNC1 0x5A
+#define SENSYTHING_USB_FRAME_MEASUREMENT 0x01
+#define SENSYTHING_USB_FRAME_DELTA 0x02
+#define SENSYTHING_USB_FRAME_HEADER_SIZE 4
+#define SENSYTHING_USB_FRAME_MAX_SIZE (SENSYTHING_USB_FRAME_HEADER_SIZE + SENSYTHING_DELTA_MAX_RECORD_SIZE + 2)
 
 class SensythingUSB {
 public:
@@ -44,10 +74,45 @@ public:
      */
     void setSeparator(char separator);
     
+    /**
+     * Select the output format
+     * @param format SENSYTHING_USB_CSV or SENSYTHING_USB_BINARY
+     */
+    void setFormat(SensythingUSBFormat format);
+    
+    /**
+     * Get the current output format
+     * @return Active output format
+     */
+    SensythingUSBFormat getFormat() const { return outputFormat; }
+    
+    /**
+     * Send binary frames as delta records instead of full floats
+     * 
+     * Only affects SENSYTHING_USB_BINARY. The first frame after enabling is a
+     * keyframe.
+     * @param enable true for SENSYTHING_USB_FRAME_DELTA frames
+     */
+    void setDeltaEncoding(bool enable);
+    
+    bool isDeltaEncoding() const { return deltaEncoding; }
+    
+    /**
+     * Get the delta encoder (compression ratio and cost)
+     */
+    const SensythingDeltaEncoder& getDeltaEncoder() const { return deltaEncoder; }
+    
+    /**
+     * Get delivery counters since initialization
+     * @return SinkStats snapshot
+     */
+    SinkStats getSinkStats() const { return sinkStats; }
+    
 private:
     bool useEmojis;
     bool useTimestamp;
     char csvSeparator;
+    SensythingUSBFormat outputFormat;
     
     /**
      * Format and print CSV header (called once at start)
@@ -55,11 +120,47 @@ private:
     void printCSVHeader(const BoardConfig& config);
     
     /**
-     * Format a single measurement as CSV
+     * Format a single measurement as CSV (without line terminator)
+     * @param out Writer to append to
+     * @return Formatted length in bytes
+     */
+    size_t formatAsCSV(SensythingTextWriter& out, const MeasurementData& data, const BoardConfig& config);
+    
+    /**
+     * Encode a single measurement as a binary frame
+     * @param buffer Output buffer (at least SENSYTHING_USB_FRAME_MAX_SIZE bytes)
+     * @return Frame size in bytes
+     */
+    size_t formatAsFrame(uint8_t* buffer, const MeasurementData& data);
+    
+    /**
+     * Encode a single measurement as a delta frame
+     * @param buffer Output buffer (at least SENSYTHING_USB_FRAME_MAX_SIZE bytes)
+     * @return Frame size in bytes
      */
-    String formatAsCSV(const MeasurementData& data, const BoardConfig& config);
+    size_t formatAsDeltaFrame(uint8_t* buffer, const MeasurementData& data);
     
+    /**
+     * Fill in the sync word, type, length and CRC around a payload
+     * @param buffer Frame whose payload starts at SENSYTHING_USB_FRAME_HEADER_SIZE
+     * @param type Frame type
+     * @param payloadLength Payload size in bytes
+     * @return Frame size in bytes
+     */
+    size_t finishFrame(uint8_t* buffer, uint8_t type, size_t payloadLength);
+    
+    bool deltaEncoding;
+    SensythingDeltaEncoder deltaEncoder;
     bool headerPrinted;
+    char lineBuffer[SENSYTHING_CSV_LINE_SIZE];   // Reused for every CSV line
+    SinkStats sinkStats;
+    
+    /**
+     * Count one sample's write (short writes mean the host is not draining the port)
+     */
+    void countWrite(size_t written, size_t length);
+    
+    friend class SensythingBenchmark;
 };
 
 #endif // SENSYTHING_USB_H
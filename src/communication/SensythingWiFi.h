@@ -20,6 +20,8 @@
 #include <Preferences.h>
 #include "../core/SensythingTypes.h"
 #include "../core/SensythingConfig.h"
+#include "../core/SensythingFormat.h"
+#include "../core/SensythingDeltaCodec.h"
 
 // WiFi mode enumeration (prefixed with SENSYTHING_ to avoid ESP32 WiFi.h conflicts)
 typedef enum {
@@ -28,6 +30,31 @@ typedef enum {
     SENSYTHING_WIFI_MODE_APSTA    // Both AP and STA
 } SensythingWiFiMode;
 
+// Binary WebSocket frame layout (little-endian), used when batching is enabled.
+// Arrays are stored one after another (structure of arrays) so every section
+// starts 4-byte aligned and the browser can view it with typed arrays:
+//   [0]          uint8   frame type (SENSYTHING_WS_FRAME_SAMPLES)
+//   [1]          uint8   channel count N
+//   [2]          uint16  sample count S
+//   [4]          uint32  sequence number of the first sample (measurement_count)
+//   [8]          uint32  timestamps[S] (ms)
+//   [8+4S]       float32 channels[S][N] (NaN for failed channels)
+//   [8+4S+4SN]   uint8   status flags[S]
+// Samples in a frame are consecutive, so sample k has sequence number [4] + k.
+// With delta encoding enabled the frame carries delta records instead (see
+// SensythingDeltaCodec.h), the first of them a keyframe so every frame
+// decodes on its own:
+//   [0]          uint8   frame type (SENSYTHING_WS_FRAME_DELTA)
+//   [1]          uint8   channel count N
+//   [2]          uint16  sample count S
+//   [4]          delta records[S]
+#define SENSYTHING_WS_FRAME_SAMPLES 0x01
+#define SENSYTHING_WS_FRAME_DELTA 0x02
+#define SENSYTHING_WS_DELTA_HEADER_SIZE 4
+#define SENSYTHING_WS_FRAME_HEADER_SIZE 8
+#define SENSYTHING_WS_FRAME_MAX_SIZE (SENSYTHING_WS_FRAME_HEADER_SIZE + \
+    SENSYTHING_WS_BATCH_MAX_SAMPLES * (5 + 4 * SENSYTHING_MAX_CHANNELS))
+
 // Forward declaration for command callback
 class SensythingCore;
 
@@ -86,6 +113,36 @@ public:
      */
     void streamData(const MeasurementData& data, const BoardConfig& config);
     
+    /**
+     * Enable/disable batched binary streaming
+     * 
+     * When enabled, samples are collected for up to windowMs (or
+     * SENSYTHING_WS_BATCH_MAX_SAMPLES samples) and broadcast as one binary
+     * frame (see layout above) instead of one JSON text message per sample.
+     * @param enable true for binary frames, false for JSON text
+     * @param windowMs Batching window in milliseconds
+     */
+    void setBinaryStreaming(bool enable, uint16_t windowMs = SENSYTHING_WS_BATCH_WINDOW_MS);
+    
+    bool isBinaryStreaming() const { return binaryStreaming; }
+    uint16_t getBatchWindow() const { return batchWindowMs; }
+    
+    /**
+     * Send binary frames as delta records instead of full floats
+     * 
+     * Only affects binary streaming. Failed channels keep their raw value
+     * (the status flags mark them) rather than becoming NaN.
+     * @param enable true for SENSYTHING_WS_FRAME_DELTA frames
+     */
+    void setDeltaEncoding(bool enable);
+    
+    bool isDeltaEncoding() const { return deltaEncoding; }
+    
+    /**
+     * Get the delta encoder (compression ratio and cost)
+     */
+    const SensythingDeltaEncoder& getDeltaEncoder() const { return deltaEncoder; }
+    
     /**
      * Check if WiFi is connected
      * @return true if connected (AP has clients or STA connected to network)
@@ -144,6 +201,12 @@ public:
      * @return Number of WebSocket clients
      */
     uint8_t getClientCount() const { return clientCount; }
+    
+    /**
+     * Get delivery counters since initialization
+     * @return SinkStats snapshot
+     */
+    SinkStats getSinkStats() const { return sinkStats; }
 
     /**
      * Set the command handler (core instance) for routing API/WebSocket commands
@@ -158,10 +221,29 @@ private:
     SensythingWiFiMode wifiMode;
     uint8_t clientCount;
     bool initialized;
-    BoardConfig boardConfig;
+    const BoardConfig* boardConfig;  // Owned by the core; set by the init methods
     Preferences preferences;  // For persistent WiFi credential storage
     DNSServer* pDNSServer;    // For captive portal DNS redirect
     bool captivePortalActive; // Track if captive portal is running
+    char jsonBuffer[SENSYTHING_JSON_BUFFER_SIZE];  // Reused for every sample
+    SinkStats sinkStats;
+    
+    // Binary batching state
+    bool binaryStreaming;
+    uint16_t batchWindowMs;
+    uint16_t batchSamples;
+    uint8_t batchChannelCount;
+    uint32_t batchFirstSequence;
+    unsigned long batchStartMs;
+    uint32_t batchTimestamps[SENSYTHING_WS_BATCH_MAX_SAMPLES];
+    float batchChannels[SENSYTHING_WS_BATCH_MAX_SAMPLES][SENSYTHING_MAX_CHANNELS];
+    uint8_t batchFlags[SENSYTHING_WS_BATCH_MAX_SAMPLES];
+    uint8_t frameBuffer[SENSYTHING_WS_FRAME_MAX_SIZE];
+    
+    // Delta encoding state (records are encoded straight into frameBuffer)
+    bool deltaEncoding;
+    SensythingDeltaEncoder deltaEncoder;
+    size_t deltaLength;
     
     // Web server handlers
     void handleRoot();
@@ -176,22 +258,53 @@ private:
     
     /**
      * Format measurement data as JSON for WebSocket
+     * @param out Writer to append to
      * @param data Measurement data
      * @param config Board configuration
-     * @return JSON string
+     * @return Formatted length in bytes
      */
-    String formatAsJSON(const MeasurementData& data, const BoardConfig& config);
+    size_t formatAsJSON(SensythingTextWriter& out, const MeasurementData& data, const BoardConfig& config);
     
     /**
-     * Generate HTML dashboard
-     * @return HTML string with embedded JavaScript for real-time plotting
+     * Add a sample to the pending binary batch, broadcasting it when full
      */
-    String generateDashboardHTML();
+    void addToBatch(const MeasurementData& data, const BoardConfig& config);
+    
+    /**
+     * Append a sample to the pending delta frame, broadcasting it when full
+     */
+    void addToDeltaFrame(const MeasurementData& data);
+    
+    /**
+     * Broadcast the pending batch (if any) as one binary frame
+     */
+    void flushBatch();
+    
+    /**
+     * Serve the dashboard (src/assets/dashboard.html, gzip-compressed in flash
+     * by scripts/build-dashboard.py). Answers 304 when the browser's cached
+     * copy still matches the ETag.
+     */
+    void serveDashboard();
+    
+    /**
+     * Serve /api/metrics in the Prometheus text format. The counters come
+     * from SensythingCore::getMetrics(), so a scrape costs the same however
+     * long the board has been running.
+     */
+    void serveMetrics();
+    
+    /**
+     * Send a formatted metrics chunk and empty the writer
+     */
+    void sendMetricsChunk(SensythingTextWriter& out);
     
     /**
      * Setup web server routes
      */
     void setupWebServer();
+    
+    friend class SensythingBenchmark;
 };
 
 #endif // SENSYTHING_WIFI_H
@@ -0,0 +1,362 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Platform - Hot Path Benchmark Implementation
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#include "SensythingBenchmark.h"
+#include "SensythingCore.h"
+#include "SensythingFormat.h"
+#include "../communication/SensythingUSB.h"
+#include "../communication/SensythingBLE.h"
+#include "../communication/SensythingWiFi.h"
+#include "../communication/SensythingSDCard.h"
+#include <Preferences.h>
+#include <esp_heap_caps.h>
+#include <esp_idf_version.h>
+
+// Local heap low-water marks need ESP-IDF 5.1 (Arduino-ESP32 3.x)
+#if defined(ESP_IDF_VERSION) && ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 1, 0)
+#define SENSYTHING_BENCH_HEAP_PEAK 1
+#else
+#define SENSYTHING_BENCH_HEAP_PEAK 0
+#endif
+
+#define BENCH_PREFS_NAMESPACE "sensything_bch"
+
+SensythingBenchmark::SensythingBenchmark(SensythingCore& core) : core(core), config(core.boardConfig) {
+    // Fixed, representative sample: every channel valid, two-digit values
+    memset(&sample, 0, sizeof(MeasurementData));
+    sample.timestamp = 1234567;
+    sample.measurement_count = 98765;
+    sample.channel_count = config.channelCount;
+    for (uint8_t i = 0; i < SENSYTHING_MAX_CHANNELS; i++) {
+        sample.channels[i] = 12.3456f + 3.25f * i;
+        sample.metadata[i] = 4 + i;
+    }
+
+    // OX-like raw counts: every channel whole-valued, a few LSBs of change per sample
+    deltaSample = sample;
+    for (uint8_t i = 0; i < SENSYTHING_MAX_CHANNELS; i++) {
+        deltaSample.channels[i] = 180000.0f + 20000.0f * i;
+    }
+    deltaPhase = 0;
+
+    // Use the live sinks where they exist so their real state is measured
+    usb = core.usbModule;
+    sd = core.sdModule;
+    wifi = core.wifiModule;
+    ble = core.bleModule;
+    ownsUSB = !usb;
+    ownsSD = !sd;
+    ownsWiFi = !wifi;
+    ownsBLE = !ble;
+
+    // A temporary WiFi module registers itself for the WebSocket callbacks
+    savedWiFiInstance = SensythingWiFi::instance;
+
+    if (ownsUSB) usb = new SensythingUSB();
+    if (ownsSD) sd = new SensythingSDCard();
+    if (ownsWiFi) wifi = new SensythingWiFi();
+    if (ownsBLE) ble = new SensythingBLE();
+
+    command = String(CMD_ACQ_MODE) + (core.threadedAcquisition ? " threaded" : " polled");
+    sink = 0;
+    resultCount = 0;
+}
+
+SensythingBenchmark::~SensythingBenchmark() {
+    if (ownsUSB) delete usb;
+    if (ownsSD) delete sd;
+    if (ownsWiFi) delete wifi;
+    if (ownsBLE) delete ble;
+    SensythingWiFi::instance = savedWiFiInstance;
+}
+
+bool SensythingBenchmark::run(bool saveBaselineResults) {
+    Serial.printf("%s Benchmarking %s at %u MHz...\n", EMOJI_TIME,
+                 config.boardName, ESP.getCpuFreqMHz());
+
+    resultCount = 0;
+    runStage("usb_csv", SENSYTHING_BENCH_ITERATIONS, &SensythingBenchmark::benchUSBCSV);
+    runStage("sd_csv", SENSYTHING_BENCH_ITERATIONS, &SensythingBenchmark::benchSDCSV);
+    runStage("wifi_json", SENSYTHING_BENCH_ITERATIONS, &SensythingBenchmark::benchWiFiJSON);
+    runStage("ble_int16", SENSYTHING_BENCH_ITERATIONS, &SensythingBenchmark::benchBLEInt16);
+    runStage("csv_string", SENSYTHING_BENCH_ITERATIONS, &SensythingBenchmark::benchStringCSV);
+    runStage("delta_encode", SENSYTHING_BENCH_ITERATIONS, &SensythingBenchmark::benchDeltaEncode);
+    runStage("command", SENSYTHING_BENCH_COMMAND_ITERATIONS, &SensythingBenchmark::benchCommand);
+
+    // The acquisition task would feed live samples into the ring under the stage
+    if (!core.threadedAcquisition) {
+        benchStreamDetached();
+    }
+
+    // Sensor stages last: they overwrite the sample. They are skipped when the
+    // acquisition task owns the bus, and for data-ready boards, where a read
+    // would consume buffered samples.
+    if (!core.threadedAcquisition && !core.isDataReadyDriven()) {
+        runStage("read", SENSYTHING_BENCH_READ_ITERATIONS, &SensythingBenchmark::benchRead);
+
+        if (core.isSplitPhase()) {
+            runStage("read_poll", SENSYTHING_BENCH_ITERATIONS, &SensythingBenchmark::benchReadPoll);
+        }
+
+        // Dispatch cost needs a read that never waits, or it drowns in conversion time
+        if (core.isReadNonBlocking()) {
+            uint32_t acquired = core.sysState.samplesAcquired;
+            uint32_t count = core.sysState.measurementCount;
+            uint32_t dropped = core.sysState.droppedSamples;
+            runStage("acquire_static", SENSYTHING_BENCH_ITERATIONS, &SensythingBenchmark::benchAcquireStatic,
+                     SENSYTHING_BENCH_BURST_SAMPLES);
+            runStage("acquire_virtual", SENSYTHING_BENCH_ITERATIONS, &SensythingBenchmark::benchAcquireVirtual,
+                     SENSYTHING_BENCH_BURST_SAMPLES);
+
+            // The samples these queued are benchmark artifacts
+            core.sampleRing.clear();
+            core.decimator.reset();
+            core.sysState.samplesAcquired = acquired;
+            core.sysState.measurementCount = count;
+            core.sysState.droppedSamples = dropped;
+        }
+    }
+
+    loadBaseline();
+
+    bool passed = true;
+    for (uint8_t i = 0; i < resultCount; i++) {
+        SensythingBenchResult& result = results[i];
+        result.regressed = result.baselineNs > 0 &&
+            (uint64_t)result.meanNs * 100 > (uint64_t)result.baselineNs * (100 + SENSYTHING_BENCH_TOLERANCE_PCT);
+        if (result.regressed) {
+            passed = false;
+        }
+    }
+
+    printReport(passed);
+
+    if (saveBaselineResults) {
+        saveBaseline();
+        Serial.println(String(EMOJI_SUCCESS) + " Baseline saved");
+    } else if (passed) {
+        Serial.println(String(EMOJI_SUCCESS) + " Benchmark passed");
+    } else {
+        Serial.printf("%s Benchmark regressed more than %d%% against the baseline\n",
+                     EMOJI_ERROR, SENSYTHING_BENCH_TOLERANCE_PCT);
+    }
+    return passed;
+}
+
+void SensythingBenchmark::runStage(const char* stage, uint32_t iterations, Operation operation,
+                                   uint32_t itemsPerCall) {
+    if (resultCount >= SENSYTHING_BENCH_MAX_STAGES) {
+        return;
+    }
+
+    // Warm caches and any lazy initialization before timing
+    (this->*operation)();
+
+    int32_t freeBefore = (int32_t)heap_caps_get_free_size(MALLOC_CAP_DEFAULT);
+#if SENSYTHING_BENCH_HEAP_PEAK
+    heap_caps_monitor_local_minimum_free_size_start();
+#endif
+
+    uint64_t totalCycles = 0;
+    uint32_t minCycles = UINT32_MAX;
+    for (uint32_t i = 0; i < iterations; i++) {
+        uint32_t start = ESP.getCycleCount();
+        (this->*operation)();
+        uint32_t cycles = ESP.getCycleCount() - start;
+
+        totalCycles += cycles;
+        if (cycles < minCycles) {
+            minCycles = cycles;
+        }
+    }
+
+    SensythingBenchResult& result = results[resultCount++];
+    result.stage = stage;
+    result.iterations = iterations * itemsPerCall;
+
+    uint32_t mhz = ESP.getCpuFreqMHz();
+    result.meanNs = (uint32_t)(totalCycles * 1000 / mhz / iterations / itemsPerCall);
+    result.minNs = (uint32_t)((uint64_t)minCycles * 1000 / mhz / itemsPerCall);
+
+#if SENSYTHING_BENCH_HEAP_PEAK
+    result.heapPeakBytes = freeBefore - (int32_t)heap_caps_get_minimum_free_size(MALLOC_CAP_DEFAULT);
+    heap_caps_monitor_local_minimum_free_size_stop();
+#else
+    result.heapPeakBytes = -1;
+#endif
+    result.heapNetBytes = freeBefore - (int32_t)heap_caps_get_free_size(MALLOC_CAP_DEFAULT);
+    result.baselineNs = 0;
+    result.regressed = false;
+}
+
+// =================================================================================================
+// STAGES
+// =================================================================================================
+
+void SensythingBenchmark::benchUSBCSV() {
+    SensythingTextWriter out(textBuffer, sizeof(textBuffer));
+    sink += usb->formatAsCSV(out, sample, config);
+}
+
+void SensythingBenchmark::benchSDCSV() {
+    SensythingTextWriter out(textBuffer, sizeof(textBuffer));
+    sink += sd->formatAsCSV(out, sample, config);
+}
+
+void SensythingBenchmark::benchWiFiJSON() {
+    SensythingTextWriter out(textBuffer, sizeof(textBuffer));
+    sink += wifi->formatAsJSON(out, sample, config);
+}
+
+void SensythingBenchmark::benchBLEInt16() {
+    sink += ble->formatAsInt16Array(binaryBuffer, sample, config);
+}
+
+void SensythingBenchmark::benchStringCSV() {
+    // The USB line as it was built before SensythingTextWriter
+    String csv = "";
+    csv += String(EMOJI_DATA) + " ";
+    csv += String(sample.timestamp) + ',';
+    for (int i = 0; i < sample.channel_count; i++) {
+        csv += String(sample.channels[i], 4);
+        if (i < sample.channel_count - 1) {
+            csv += ',';
+        }
+    }
+    if (sensythingHasMetadataColumns(config)) {
+        for (int i = 0; i < sample.channel_count; i++) {
+            csv += ',';
+            csv += String(sample.metadata[i]);
+        }
+    }
+    csv += String(",0x") + String(sample.status_flags, HEX);
+    csv += ',' + String(sample.measurement_count);
+    sink += csv.length();
+}
+
+void SensythingBenchmark::benchDeltaEncode() {
+    // Triangle wave of +-40 counts per step; keyframes are included at their natural rate
+    int32_t step = (deltaPhase++ & 0x20) ? -40 : 40;
+    for (uint8_t i = 0; i < deltaSample.channel_count; i++) {
+        deltaSample.channels[i] += step;
+    }
+    deltaSample.measurement_count++;
+    deltaSample.timestamp += 10;
+    sink += deltaEncoder.encode(deltaBuffer, deltaSample);
+}
+
+void SensythingBenchmark::benchCommand() {
+    // Re-selects the current acquisition mode: parsed past most of the command
+    // chain, then enableThreadedAcquisition() returns at once without a reply
+    core.processCommand(command);
+}
+
+void SensythingBenchmark::benchStream() {
+    sink += core.queueMeasurement(sample);
+    core.drainMeasurements(SENSYTHING_SINK_DRAIN_BUDGET_US);
+}
+
+void SensythingBenchmark::benchStreamDetached() {
+    // Samples already queued belong to the live sinks
+    while (!core.sampleRing.isEmpty()) {
+        core.drainMeasurements(SENSYTHING_SINK_DRAIN_BUDGET_US);
+    }
+
+    // Detach the sinks, and keep the filters' state and the last sample out of
+    // the stage's reach; the formatter stages already time the sinks' work
+    SystemState& state = core.sysState;
+    bool usbEnabled = state.usbStreamingEnabled;
+    bool bleEnabled = state.bleStreamingEnabled;
+    bool wifiEnabled = state.wifiStreamingEnabled;
+    bool sdEnabled = state.sdLoggingEnabled;
+    state.usbStreamingEnabled = false;
+    state.bleStreamingEnabled = false;
+    state.wifiStreamingEnabled = false;
+    state.sdLoggingEnabled = false;
+    SensythingFilterBank* savedFilters = new SensythingFilterBank(core.filters);
+
+    runStage("stream", SENSYTHING_BENCH_ITERATIONS, &SensythingBenchmark::benchStream);
+
+    core.filters = *savedFilters;
+    delete savedFilters;
+    state.usbStreamingEnabled = usbEnabled;
+    state.bleStreamingEnabled = bleEnabled;
+    state.wifiStreamingEnabled = wifiEnabled;
+    state.sdLoggingEnabled = sdEnabled;
+}
+
+void SensythingBenchmark::benchRead() {
+    // Blocking read: includes any wait for the conversion
+    sink += core.readMeasurement(sample);
+}
+
+void SensythingBenchmark::benchAcquireStatic() {
+    // One burst as a data-ready pass runs it; SensythingCoreT boards read without an indirect call
+    core.sampleRing.clear();
+    sink += core.acquireBurst(sample, SENSYTHING_BENCH_BURST_SAMPLES);
+}
+
+void SensythingBenchmark::benchAcquireVirtual() {
+    // The same burst as SensythingCore implements it: one virtual readMeasurement() per sample
+    core.sampleRing.clear();
+    sink += core.SensythingCore::acquireBurst(sample, SENSYTHING_BENCH_BURST_SAMPLES);
+}
+
+void SensythingBenchmark::benchReadPoll() {
+    // The sensor work of one split-phase update() pass; the loop is free between passes
+    if (core.isMeasurementReady()) {
+        sink += core.collectMeasurement(sample);
+        core.startMeasurement();
+    }
+}
+
+// =================================================================================================
+// BASELINE AND REPORT
+// =================================================================================================
+
+void SensythingBenchmark::loadBaseline() {
+    Preferences prefs;
+    if (!prefs.begin(BENCH_PREFS_NAMESPACE, true)) {
+        return;  // No baseline stored yet
+    }
+    for (uint8_t i = 0; i < resultCount; i++) {
+        results[i].baselineNs = prefs.getUInt(results[i].stage, 0);
+    }
+    prefs.end();
+}
+
+void SensythingBenchmark::saveBaseline() {
+    Preferences prefs;
+    prefs.begin(BENCH_PREFS_NAMESPACE, false);
+    for (uint8_t i = 0; i < resultCount; i++) {
+        prefs.putUInt(results[i].stage, results[i].meanNs);
+    }
+    prefs.end();
+}
+
+void SensythingBenchmark::clearBaseline() {
+    Preferences prefs;
+    prefs.begin(BENCH_PREFS_NAMESPACE, false);
+    prefs.clear();
+    prefs.end();
+}
+
+void SensythingBenchmark::printReport(bool passed) {
+    // One line so host tools can pick it out of the console output
+    Serial.printf("{\"benchmark\":{\"board\":\"%s\",\"cpu_mhz\":%u,\"tolerance_pct\":%d,\"stages\":[",
+                 config.boardName, ESP.getCpuFreqMHz(), SENSYTHING_BENCH_TOLERANCE_PCT);
+    for (uint8_t i = 0; i < resultCount; i++) {
+        const SensythingBenchResult& r = results[i];
+        Serial.printf("%s{\"stage\":\"%s\",\"iterations\":%u,\"mean_ns\":%u,\"min_ns\":%u,"
+                     "\"heap_peak_bytes\":%d,\"heap_net_bytes\":%d,\"baseline_ns\":%u,\"regressed\":%s}",
+                     i > 0 ? "," : "", r.stage, r.iterations, r.meanNs, r.minNs,
+                     r.heapPeakBytes, r.heapNetBytes, r.baselineNs, r.regressed ? "true" : "false");
+    }
+    Serial.printf("],\"pass\":%s}}\n", passed ? "true" : "false");
+}
@@ -0,0 +1,127 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Platform - Hot Path Benchmark
+//    Times the per-sample stages on the target and checks them against a stored baseline
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SENSYTHING_BENCHMARK_H
+#define SENSYTHING_BENCHMARK_H
+
+#include <Arduino.h>
+#include "SensythingTypes.h"
+#include "SensythingConfig.h"
+#include "SensythingDeltaCodec.h"
+
+class SensythingCore;
+class SensythingUSB;
+class SensythingBLE;
+class SensythingWiFi;
+class SensythingSDCard;
+
+typedef struct {
+    const char* stage;                           // Stage name (also the baseline key)
+    uint32_t iterations;                         // Calls, or samples for the per-sample stages
+    uint32_t meanNs;                             // Mean time per call (per sample)
+    uint32_t minNs;                              // Fastest call (least disturbed by interrupts)
+    int32_t heapPeakBytes;                       // Most heap in use at once during the stage (-1 = unknown)
+    int32_t heapNetBytes;                        // Heap still held after the stage
+    uint32_t baselineNs;                         // Stored baseline mean (0 = none)
+    bool regressed;                              // Mean exceeds baseline + SENSYTHING_BENCH_TOLERANCE_PCT
+} SensythingBenchResult;
+
+/**
+ * Runs each per-sample stage in isolation on a fixed sample and prints the
+ * results as one line of JSON. Stages:
+ *   usb_csv, sd_csv, wifi_json, ble_int16 - the sinks' formatters
+ *   csv_string - the same CSV line built with String concatenation, for
+ *                comparison with the allocation-free writer
+ *   delta_encode - one delta record of a slowly changing 19-bit PPG-like trace
+ *   command - processCommand() re-selecting the current "acq_mode" (no reply)
+ *   stream - (polled acquisition) one sample queued, filtered and fanned out
+ *            through drainMeasurements() with the sinks detached
+ *   read - a blocking readMeasurement(), conversion wait included
+ *   acquire_static - (boards with a non-blocking read, e.g. Sim when polled)
+ *                    read, decimate and queue bursts of samples through the
+ *                    board's acquireBurst(); per sample
+ *   acquire_virtual - the same bursts with one virtual readMeasurement() per
+ *                     sample, as SensythingCore runs them. On SensythingCoreT
+ *                     boards the difference is the per-sample dispatch cost
+ *   read_poll - (split-phase boards) one non-blocking poll/collect/start, the
+ *               time a split-phase read holds up each update() pass
+ *
+ * Baselines are kept in NVS: "bench save" records the current means, and
+ * later runs fail any stage that got more than SENSYTHING_BENCH_TOLERANCE_PCT
+ * slower. Sinks that are not initialized are benchmarked on a temporary
+ * instance so every stage is always measured.
+ */
+class SensythingBenchmark {
+public:
+    SensythingBenchmark(SensythingCore& core);
+    ~SensythingBenchmark();
+
+    /**
+     * Run every stage and print the JSON report
+     * @param saveBaseline Store this run's means as the new baseline
+     * @return true if no stage regressed
+     */
+    bool run(bool saveBaseline);
+
+    /**
+     * Forget the stored baseline
+     */
+    static void clearBaseline();
+
+private:
+    typedef void (SensythingBenchmark::*Operation)();
+
+    SensythingCore& core;
+    SensythingUSB* usb;
+    SensythingSDCard* sd;
+    SensythingWiFi* wifi;
+    SensythingBLE* ble;
+    bool ownsUSB;
+    bool ownsSD;
+    bool ownsWiFi;
+    bool ownsBLE;
+    SensythingWiFi* savedWiFiInstance;
+
+    MeasurementData sample;
+    const BoardConfig& config;
+    char textBuffer[SENSYTHING_JSON_BUFFER_SIZE];
+    uint8_t binaryBuffer[2 * SENSYTHING_MAX_CHANNELS];
+    String command;
+    SensythingDeltaEncoder deltaEncoder;
+    MeasurementData deltaSample;                 // Whole-valued trace for delta_encode
+    uint8_t deltaBuffer[SENSYTHING_DELTA_MAX_RECORD_SIZE];
+    uint8_t deltaPhase;
+    volatile uint32_t sink;                      // Consumes results so the work is not optimized away
+
+    SensythingBenchResult results[SENSYTHING_BENCH_MAX_STAGES];
+    uint8_t resultCount;
+
+    void runStage(const char* stage, uint32_t iterations, Operation operation, uint32_t itemsPerCall = 1);
+
+    void benchUSBCSV();
+    void benchSDCSV();
+    void benchWiFiJSON();
+    void benchBLEInt16();
+    void benchStringCSV();
+    void benchDeltaEncode();
+    void benchCommand();
+    void benchStream();
+    void benchStreamDetached();
+    void benchRead();
+    void benchAcquireStatic();
+    void benchAcquireVirtual();
+    void benchReadPoll();
+
+    void loadBaseline();
+    void saveBaseline();
+    void printReport(bool passed);
+};
+
+#endif // SENSYTHING_BENCHMARK_H
@@ -0,0 +1,28 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Platform - CRC Helpers
+//    Checksums used by the binary stream and log formats
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SENSYTHING_CRC_H
+#define SENSYTHING_CRC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define SENSYTHING_CRC16_INIT 0xFFFF
+
+/**
+ * CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF, no reflection, no final XOR)
+ * @param data Bytes to checksum
+ * @param length Number of bytes
+ * @param crc Running CRC (pass the previous result to checksum in pieces)
+ * @return Updated CRC
+ */
+uint16_t sensythingCRC16(const uint8_t* data, size_t length, uint16_t crc = SENSYTHING_CRC16_INIT);
+
+#endif // SENSYTHING_CRC_H
@@ -65,15 +65,35 @@
 #define SENSYTHING_MAX_SAMPLE_INTERVAL_MS 10000       // 0.1Hz minimum
 
 #define SENSYTHING_STATUS_UPDATE_INTERVAL_MS 10000    // Status update every 10s
+#define SENSYTHING_LOOP_STATS_WINDOW_MS 10000         // Window for the slowest update() metric
 #define SENSYTHING_FILE_ROTATION_INTERVAL_MS 3600000  // New file every hour
 
+// =================================================================================================
+// SAMPLE PIPELINE CONFIGURATION
+// =================================================================================================
+
+#define SENSYTHING_SAMPLE_RING_SIZE 32                // Samples queued between acquisition and sinks (power of two)
+#define SENSYTHING_SINK_DRAIN_BUDGET_US 5000          // Time per update() for fanning out queued samples
+
+// Threaded acquisition mode (acquisition task driven by a hardware timer)
+#define SENSYTHING_ACQ_TASK_CORE 1                    // APP CPU; WiFi/BT stacks run on core 0
+#define SENSYTHING_ACQ_TASK_PRIORITY (configMAX_PRIORITIES - 2)  // Above loopTask and sink work
+#define SENSYTHING_ACQ_TASK_STACK_SIZE 4096           // Bytes
+
 // =================================================================================================
 // SD CARD CONFIGURATION
 // =================================================================================================
 
-#define SENSYTHING_SD_BUFFER_LINES 10                 // Flush after 10 lines
+#define SENSYTHING_SD_WRITE_BUFFER_SIZE 4096          // Bytes per write buffer (multiple of 512-byte sectors)
+#define SENSYTHING_SD_SYNC_INTERVAL_MS 2000           // Write out partial buffers and sync at least this often
+#define SENSYTHING_SD_SYNC_BYTES 65536                // ...or after this many bytes since the last sync
+#define SENSYTHING_SD_QUEUE_DEPTH 8                   // Pending writer jobs
+#define SENSYTHING_SD_TASK_CORE 0                     // Keep card I/O off the acquisition core
+#define SENSYTHING_SD_TASK_PRIORITY 2                 // Above idle, below the BLE/WiFi stacks
+#define SENSYTHING_SD_TASK_STACK_SIZE 4096            // Bytes
 #define SENSYTHING_SD_CSV_HEADER true                 // Include CSV header
 #define SENSYTHING_SD_FILE_PREFIX "sensything_"       // File name prefix
+#define SENSYTHING_SD_BINARY_SYNC_RECORDS 64          // Binary log: records per CRC-checked sync block
 
 // =================================================================================================
 // WIFI CONFIGURATION
@@ -92,6 +112,11 @@
 // Web server configuration
 #define SENSYTHING_WEB_SERVER_PORT 80                 // HTTP server port
 #define SENSYTHING_WEBSOCKET_PORT 81                  // WebSocket port
+#define SENSYTHING_DASHBOARD_CACHE_CONTROL "no-cache"  // Cache, but revalidate via ETag
+
+// Binary WebSocket batching
+#define SENSYTHING_WS_BATCH_WINDOW_MS 50              // Default batching window
+#define SENSYTHING_WS_BATCH_MAX_SAMPLES 32            // Samples per binary frame
 
 // =================================================================================================
 // BLE CONFIGURATION
@@ -120,6 +145,19 @@
 // BLE device name format
 #define SENSYTHING_BLE_NAME_PREFIX "Sensything-"
 
+// Notification batching
+#define SENSYTHING_BLE_DEFAULT_MTU 23                 // ATT MTU until the client negotiates a larger one
+#define SENSYTHING_BLE_MAX_NOTIFY_PAYLOAD 244         // Largest notification built (MTU 247 - 3)
+#define SENSYTHING_BLE_BATCH_MAX_LATENCY_MS 100       // Flush a partial batch after this long
+
+// Link tuning for high-rate streaming
+#define SENSYTHING_BLE_PREFERRED_MTU 247              // Offered in the client's MTU exchange
+#define SENSYTHING_BLE_FAST_CONN_MIN_INTERVAL 6       // 7.5 ms (1.25 ms units)
+#define SENSYTHING_BLE_FAST_CONN_MAX_INTERVAL 12      // 15 ms (1.25 ms units)
+#define SENSYTHING_BLE_FAST_CONN_LATENCY 0            // Peripheral latency (intervals)
+#define SENSYTHING_BLE_FAST_CONN_TIMEOUT 400          // Supervision timeout, 4 s (10 ms units)
+#define SENSYTHING_BLE_FAST_LINK_MAX_INTERVAL_MS 50   // Sample intervals at or below this request a fast link
+
 // =================================================================================================
 // USB SERIAL CONFIGURATION
 // =================================================================================================
@@ -137,14 +175,58 @@
 #define SENSYTHING_USB_USE_EMOJIS true
 #define SENSYTHING_USB_TIMESTAMP true
 
+// CSV configuration (USB and SD card)
+#define SENSYTHING_CSV_PRECISION 4                    // Decimal places for float values
+#define SENSYTHING_CSV_LINE_SIZE 256                  // Max bytes per formatted record (4 full-width floats)
+#define SENSYTHING_CSV_HEADER_SIZE 384                // Max bytes for the header line
+
 // JSON configuration
 #define SENSYTHING_JSON_BUFFER_SIZE 512
 #define SENSYTHING_JSON_PRECISION 4  // Decimal places for float values
 
+// Delta encoding of binary streams ('encoding <sink> delta')
+#define SENSYTHING_DELTA_KEYFRAME_INTERVAL 64         // Records between self-contained keyframes
+#define SENSYTHING_DELTA_MAX_RECORD_SIZE (12 + 6 * SENSYTHING_MAX_CHANNELS)  // Worst-case record
+
+// Prometheus /api/metrics
+#define SENSYTHING_METRICS_CHUNK_SIZE 768             // Stack buffer per metric family sent
+
+// =================================================================================================
+// BENCHMARK CONFIGURATION
+// =================================================================================================
+
+#define SENSYTHING_BENCH_ITERATIONS 1000              // Calls per formatting/stream stage
+#define SENSYTHING_BENCH_COMMAND_ITERATIONS 50        // Calls for the command stage (a silent no-op)
+#define SENSYTHING_BENCH_READ_ITERATIONS 20           // Blocking sensor reads (each may wait a full conversion)
+#define SENSYTHING_BENCH_BURST_SAMPLES 32             // Reads per call in the acquire_* stages
+#define SENSYTHING_BENCH_TOLERANCE_PCT 20             // Slowdown over the baseline that fails a stage
+#define SENSYTHING_BENCH_MAX_STAGES 14
+
+// =================================================================================================
+// STREAMING FILTERS
+// =================================================================================================
+
+#define SENSYTHING_FILTER_MAX_STAGES 4                // Stages per channel
+#define SENSYTHING_FILTER_MA_MAX_LENGTH 32            // Longest moving average (samples)
+#define SENSYTHING_FILTER_NOTCH_Q 30.0f               // Notch quality factor (-3 dB width = f / Q)
+#define SENSYTHING_FILTER_DC_CUTOFF_HZ 0.5f           // Default DC removal corner
+#define SENSYTHING_MAX_OVERSAMPLING 64                // Highest decimation ratio ('oversample')
+#define SENSYTHING_MAX_SINK_RATE_DIVISOR 100          // Highest per-sink divisor ('sink_rate')
+
 // =================================================================================================
 // STATUS FLAGS — Canonical definitions are in SensythingTypes.h
 // =================================================================================================
 
+// =================================================================================================
+// PERFORMANCE PROBES
+// =================================================================================================
+
+#ifndef SENSYTHING_PERF
+#define SENSYTHING_PERF 1                             // Set to 0 to compile the 'perf' stage probes out
+#endif
+
+#define SENSYTHING_PERF_SUB_BUCKET_BITS 2             // 4 histogram buckets per power of two (p99 within 25%)
+
 // =================================================================================================
 // EMOJI PREFIXES (for user-friendly serial output)
 // =================================================================================================
@@ -173,6 +255,17 @@
 #define CMD_TOGGLE_SD "toggle_sd"
 #define CMD_ROTATE_FILE "rotate_file"
 #define CMD_SET_RATE "set_rate"
+#define CMD_ACQ_MODE "acq_mode"
+#define CMD_USB_FORMAT "usb_format"
+#define CMD_BLE_BATCH "ble_batch"
+#define CMD_WS_BATCH "ws_batch"
+#define CMD_SD_FORMAT "sd_format"
+#define CMD_BENCH "bench"
+#define CMD_PERF "perf"
+#define CMD_FILTER "filter"
+#define CMD_OVERSAMPLE "oversample"
+#define CMD_SINK_RATE "sink_rate"
+#define CMD_ENCODING "encoding"
 
 // =================================================================================================
 // DEBUGGING
@@ -12,6 +12,7 @@
 #include "../communication/SensythingBLE.h"
 #include "../communication/SensythingWiFi.h"
 #include "../communication/SensythingSDCard.h"
+#include "SensythingBenchmark.h"
 
 // =================================================================================================
 // CONSTRUCTOR / DESTRUCTOR
@@ -24,11 +25,39 @@ SensythingCore::SensythingCore() {
     wifiModule = nullptr;
     sdModule = nullptr;
     
+    // Threaded acquisition is opt-in
+    threadedAcquisition = false;
+    splitPhasePending = false;
+    acqTaskStopRequested = false;
+    acqTaskHandle = nullptr;
+    acqTaskExited = nullptr;
+    acqTimerCallbacks = 0;
+    acqTimer = nullptr;
+    lastAcqTickUs = 0;
+    memset(&acqStats, 0, sizeof(AcquisitionStats));
+    memset(&acqMeasurement, 0, sizeof(MeasurementData));
+    memset(&loopStats, 0, sizeof(LoopStats));
+    memset(&boardConfig, 0, sizeof(BoardConfig));  // Filled in by the board constructor
+    memset(sinkSequence, 0, sizeof(sinkSequence));
+    
+    benchmarkPending = false;
+    benchmarkSaveBaseline = false;
+    benchmarkRunning = false;
+    
     // Initialize system state
     initSystemState();
 }
 
 SensythingCore::~SensythingCore() {
+    // Stop the acquisition task before the sensor and modules go away
+    enableThreadedAcquisition(false);
+    if (acqTimer) {
+        esp_timer_delete(acqTimer);
+    }
+    if (acqTaskExited) {
+        vSemaphoreDelete(acqTaskExited);
+    }
+    
     // Clean up communication modules
     if (usbModule) delete usbModule;
     if (bleModule) delete bleModule;
@@ -43,16 +72,23 @@ SensythingCore::~SensythingCore() {
 void SensythingCore::initSystemState() {
     sysState.sampleInterval = SENSYTHING_DEFAULT_SAMPLE_INTERVAL_MS;
     sysState.lastMeasurement = 0;
+    sysState.oversampleRatio = 1;
     sysState.lastStatusUpdate = 0;
     sysState.lastFileRotation = 0;
     
     sysState.measurementActive = false;
     sysState.measurementCount = 0;
+    sysState.samplesAcquired = 0;
+    sysState.droppedSamples = 0;
+    sysState.queuePeak = 0;
     
     sysState.usbStreamingEnabled = false;
     sysState.bleStreamingEnabled = false;
     sysState.wifiStreamingEnabled = false;
     sysState.sdLoggingEnabled = false;
+    for (uint8_t i = 0; i < SENSYTHING_SINK_COUNT; i++) {
+        sysState.sinkRateDivisor[i] = 1;
+    }
     
     sysState.bleConnected = false;
     sysState.wifiConnected = false;
@@ -74,11 +110,8 @@ bool SensythingCore::initPlatform() {
     Serial.printf("Version: %s\n", SENSYTHING_ES3_VERSION);
     Serial.println("=================================");
     
-    // Get board configuration
-    boardConfig = getBoardConfig();
-    
-    Serial.printf("Board: %s\n", getBoardName().c_str());
-    Serial.printf("Sensor: %s\n", getSensorType().c_str());
+    Serial.printf("Board: %s\n", getBoardName());
+    Serial.printf("Sensor: %s\n", getSensorType());
     Serial.println();
     
     // Initialize sensor
@@ -110,7 +143,7 @@ bool SensythingCore::initSensorOnly() {
     Serial.begin(SENSYTHING_SERIAL_BAUD_RATE);
     delay(100);
     
-    Serial.printf("Initializing %s sensor... ", getSensorType().c_str());
+    Serial.printf("Initializing %s sensor... ", getSensorType());
     
     if (initSensor()) {
         Serial.println(String(EMOJI_SUCCESS) + " Success");
@@ -150,7 +183,7 @@ bool SensythingCore::initWiFi(const char* ssid, const char* password) {
     }
     
     // Generate SSID if not provided
-    String apSSID = ssid ? String(ssid) : (getBoardName() + "-" + String(ESP.getEfuseMac(), HEX).substring(6));
+    String apSSID = ssid ? String(ssid) : (String(getBoardName()) + "-" + String(ESP.getEfuseMac(), HEX).substring(6));
     String apPassword = password ? String(password) : "";
     
     wifiModule = new SensythingWiFi();
@@ -252,6 +285,7 @@ void SensythingCore::enableBLE(bool enable) {
     }
     
     sysState.bleStreamingEnabled = enable;
+    updateBLELinkPolicy();
     
     if (enable) {
         Serial.println(String(EMOJI_BLUETOOTH) + " BLE streaming enabled");
@@ -311,25 +345,100 @@ void SensythingCore::disableAll() {
 // =================================================================================================
 
 bool SensythingCore::setSampleRate(unsigned long intervalMs) {
-    if (intervalMs < SENSYTHING_MIN_SAMPLE_INTERVAL_MS || 
-        intervalMs > SENSYTHING_MAX_SAMPLE_INTERVAL_MS) {
+    // Limits come from the board (the sensor's conversion rate)
+    if (intervalMs < boardConfig.minSampleInterval || 
+        intervalMs > boardConfig.maxSampleInterval) {
         Serial.printf("%s Invalid sample rate (valid range: %lu-%lu ms)\n", 
                      EMOJI_ERROR,
-                     SENSYTHING_MIN_SAMPLE_INTERVAL_MS,
-                     SENSYTHING_MAX_SAMPLE_INTERVAL_MS);
+                     boardConfig.minSampleInterval,
+                     boardConfig.maxSampleInterval);
         return false;
     }
     
+    // Oversampled reads must still fit the board's fastest rate
+    unsigned long maxRatio = intervalMs / boardConfig.minSampleInterval;
+    if (!isDataReadyDriven() && sysState.oversampleRatio > maxRatio) {
+        sysState.oversampleRatio = maxRatio > 0 ? maxRatio : 1;
+        Serial.printf("%s Oversampling reduced to x%u\n", EMOJI_INFO, sysState.oversampleRatio);
+    }
+    
     sysState.sampleInterval = intervalMs;
+    if (threadedAcquisition) {
+        restartAcquisitionTimer();
+    }
+    updateBLELinkPolicy();
+    filters.setSampleRate(getSampleRateHz());
     Serial.printf("%s Sample rate set to %.2f Hz (%lu ms interval)\n", 
                  EMOJI_SUCCESS, getSampleRateHz(), intervalMs);
     return true;
 }
 
+void SensythingCore::updateBLELinkPolicy() {
+    if (!bleModule) {
+        return;
+    }
+    
+    // Fast sampling or batched streaming needs more than the default link gives;
+    // a reduced BLE stream is judged by its own rate
+    unsigned long bleInterval = sysState.sampleInterval * sysState.sinkRateDivisor[SENSYTHING_SINK_BLE];
+    bool highRate = sysState.bleStreamingEnabled &&
+                    (bleModule->isBatching() ||
+                     bleInterval <= SENSYTHING_BLE_FAST_LINK_MAX_INTERVAL_MS);
+    bleModule->setHighThroughput(highRate);
+}
+
 float SensythingCore::getSampleRateHz() {
     return 1000.0f / sysState.sampleInterval;
 }
 
+bool SensythingCore::setSinkRateDivisor(SensythingSink sink, uint8_t divisor) {
+    if (sink >= SENSYTHING_SINK_COUNT || divisor < 1 || divisor > SENSYTHING_MAX_SINK_RATE_DIVISOR) {
+        Serial.printf("%s Invalid sink rate divisor (valid range: 1-%d)\n", EMOJI_ERROR, SENSYTHING_MAX_SINK_RATE_DIVISOR);
+        return false;
+    }
+    
+    // The streaming context picks the new divisor up before the sink's next sample
+    sysState.sinkRateDivisor[sink] = divisor;
+    if (sink == SENSYTHING_SINK_BLE) {
+        updateBLELinkPolicy();
+    }
+    Serial.printf("%s %s rate: %.2f Hz (1/%u)\n", EMOJI_SUCCESS, sensythingSinkName(sink),
+                 getSampleRateHz() / divisor, divisor);
+    return true;
+}
+
+bool SensythingCore::setOversampling(uint8_t ratio) {
+    if (ratio < 1 || ratio > SENSYTHING_MAX_OVERSAMPLING) {
+        Serial.printf("%s Invalid oversampling (valid range: 1-%d)\n", EMOJI_ERROR, SENSYTHING_MAX_OVERSAMPLING);
+        return false;
+    }
+    
+    // Timed boards read `ratio` times per interval; sensor-paced boards set their own rate
+    if (!isDataReadyDriven() &&
+        sysState.sampleInterval * 1000UL / ratio < boardConfig.minSampleInterval * 1000UL) {
+        Serial.printf("%s Oversampling x%u needs a read every %.2f ms (board minimum %lu ms)\n",
+                     EMOJI_ERROR, ratio, sysState.sampleInterval / (float)ratio, boardConfig.minSampleInterval);
+        return false;
+    }
+    
+    sysState.oversampleRatio = ratio;
+    if (threadedAcquisition) {
+        restartAcquisitionTimer();
+    }
+    
+    if (ratio == 1) {
+        Serial.println(String(EMOJI_SUCCESS) + " Oversampling off");
+    } else if (isDataReadyDriven()) {
+        Serial.printf("%s Oversampling x%u: averaging every %u sensor samples (white-noise SNR +%.1f dB)\n",
+                     EMOJI_SUCCESS, ratio, ratio, 10.0f * log10f(ratio));
+    } else {
+        Serial.printf("%s Oversampling x%u: reading at %.2f Hz, streaming at %.2f Hz (white-noise SNR +%.1f dB)\n",
+                     EMOJI_SUCCESS, ratio, 1000000.0f / getAcquisitionIntervalUs(), getSampleRateHz(),
+                     10.0f * log10f(ratio));
+    }
+    return true;
+}
+
 void SensythingCore::startMeasurements() {
     sysState.measurementActive = true;
     Serial.println(String(EMOJI_SUCCESS) + " Measurements started");
@@ -342,6 +451,11 @@ void SensythingCore::stopMeasurements() {
 
 void SensythingCore::resetMeasurementCount() {
     sysState.measurementCount = 0;
+    sysState.droppedSamples = 0;
+    sysState.queuePeak = 0;
+    memset(sinkSequence, 0, sizeof(sinkSequence));
+    memset(&acqStats, 0, sizeof(AcquisitionStats));
+    acqStats.intervalUs = getAcquisitionIntervalUs();
     Serial.println(String(EMOJI_SUCCESS) + " Measurement count reset");
 }
 
@@ -352,37 +466,153 @@ void SensythingCore::resetMeasurementCount() {
 bool SensythingCore::shouldTakeMeasurement() {
     if (!sysState.measurementActive) return false;
     
-    unsigned long now = millis();
-    if (now - sysState.lastMeasurement >= sysState.sampleInterval) {
+    unsigned long now = micros();
+    if (now - sysState.lastMeasurement >= getAcquisitionIntervalUs()) {
         sysState.lastMeasurement = now;
         return true;
     }
     return false;
 }
 
-void SensythingCore::streamMeasurement() {
+void SensythingCore::runAcquisition(MeasurementData& data, bool timerTick) {
+    runAcquisitionWith(data, timerTick, [this](MeasurementData& sample) { return readMeasurement(sample); });
+}
+
+size_t SensythingCore::acquireBurst(MeasurementData& data, size_t maxSamples) {
+    return acquireBurstWith(data, maxSamples, [this](MeasurementData& sample) { return readMeasurement(sample); });
+}
+
+void SensythingCore::acquireSplitPhaseMeasurement(MeasurementData& data) {
+    if (!splitPhasePending) {
+        if (shouldTakeMeasurement()) {
+            splitPhasePending = startMeasurement();
+        }
+        return;  // Give the sinks a pass before the first poll
+    }
+    
+    if (!isMeasurementReady()) {
+        return;
+    }
+    splitPhasePending = false;
+    
+    SENSYTHING_PERF_BEGIN(READ);
+    if (!collectMeasurement(data)) {
+        return;
+    }
+    SENSYTHING_PERF_END(READ);
+    
+    // A conversion that finishes after 'stop' is discarded
+    if (sysState.measurementActive) {
+        recordMeasurement(data);
+    }
+}
+
+void SensythingCore::recordMeasurement(MeasurementData& data) {
+    sysState.samplesAcquired++;
+    
+    // Only complete oversampling blocks go on to the sinks
+    if (decimator.getRatio() != sysState.oversampleRatio) {
+        decimator.setRatio(sysState.oversampleRatio);
+    }
+    if (!decimator.push(data)) {
+        return;
+    }
+    
+    data.measurement_count = ++sysState.measurementCount;
+    queueMeasurement(data);
+}
+
+bool SensythingCore::queueMeasurement(const MeasurementData& data) {
+    if (!sampleRing.push(data)) {
+        // Sinks have fallen behind; drop the new sample rather than stall acquisition
+        sysState.droppedSamples++;
+        return false;
+    }
+    uint32_t queued = sampleRing.size();
+    if (queued > sysState.queuePeak) {
+        sysState.queuePeak = queued;
+    }
+    return true;
+}
+
+void SensythingCore::drainMeasurements(uint32_t budgetUs) {
+    MeasurementData data;
+    int64_t start = esp_timer_get_time();
+    while (sampleRing.pop(data)) {
+        if (filters.isActive()) {
+            SENSYTHING_PERF_BEGIN(FILTER);
+            filters.process(data);
+            SENSYTHING_PERF_END(FILTER);
+        }
+        if (threadedAcquisition) {
+            currentMeasurement = data;  // Acquisition task owns its own buffer
+        }
+        streamMeasurement(data);
+        
+        // A slow sink leaves the rest for the next pass instead of starving acquisition
+        if (esp_timer_get_time() - start >= budgetUs) {
+            break;
+        }
+    }
+}
+
+const MeasurementData* SensythingCore::sinkSample(SensythingSink sink, const MeasurementData& data,
+                                                  MeasurementData& scratch) {
+    SensythingDecimator& divider = sinkDecimators[sink];
+    if (divider.getRatio() != sysState.sinkRateDivisor[sink]) {
+        divider.setRatio(sysState.sinkRateDivisor[sink]);
+    }
+    if (divider.getRatio() <= 1) {
+        sinkSequence[sink] = data.measurement_count;
+        return &data;
+    }
+    scratch = data;
+    if (!divider.push(scratch)) {
+        return nullptr;
+    }
+    
+    // The block carries its last read's number; a step of n would look like a gap to the batchers
+    scratch.measurement_count = ++sinkSequence[sink];
+    return &scratch;
+}
+
+void SensythingCore::streamMeasurement(const MeasurementData& data) {
+    MeasurementData reduced;
+    const MeasurementData* sample;
+    
     // Stream to USB if enabled
-    if (sysState.usbStreamingEnabled && usbModule) {
-        usbModule->streamData(currentMeasurement, boardConfig);
+    if (sysState.usbStreamingEnabled && usbModule &&
+        (sample = sinkSample(SENSYTHING_SINK_USB, data, reduced))) {
+        SENSYTHING_PERF_BEGIN(USB);
+        usbModule->streamData(*sample, boardConfig);
+        SENSYTHING_PERF_END(USB);
     }
     
     // Stream to BLE if enabled
-    if (sysState.bleStreamingEnabled && bleModule) {
-        bleModule->streamData(currentMeasurement, boardConfig);
+    if (sysState.bleStreamingEnabled && bleModule &&
+        (sample = sinkSample(SENSYTHING_SINK_BLE, data, reduced))) {
+        SENSYTHING_PERF_BEGIN(BLE);
+        bleModule->streamData(*sample, boardConfig);
+        SENSYTHING_PERF_END(BLE);
         // Update connection state
         sysState.bleConnected = bleModule->isConnected();
     }
     
     // Stream to WiFi if enabled
-    if (sysState.wifiStreamingEnabled && wifiModule) {
-        wifiModule->streamData(currentMeasurement, boardConfig);
+    if (sysState.wifiStreamingEnabled && wifiModule &&
+        (sample = sinkSample(SENSYTHING_SINK_WIFI, data, reduced))) {
+        SENSYTHING_PERF_BEGIN(WIFI);
+        wifiModule->streamData(*sample, boardConfig);
+        SENSYTHING_PERF_END(WIFI);
         // Update connection state
         sysState.wifiConnected = wifiModule->hasClients();
     }
     
     // Log to SD Card if enabled
-    if (sysState.sdLoggingEnabled && sdModule) {
-        sdModule->logData(currentMeasurement, boardConfig);
+    if (sysState.sdLoggingEnabled && sdModule &&
+        (sample = sinkSample(SENSYTHING_SINK_SD, data, reduced))) {
+        SENSYTHING_PERF_BEGIN(SD);
+        sdModule->logData(*sample, boardConfig);
         // Update SD card state
         sysState.sdCardReady = sdModule->isReady();
         
@@ -392,6 +622,7 @@ void SensythingCore::streamMeasurement() {
             sdModule->rotateFile();
             sysState.lastFileRotation = now;
         }
+        SENSYTHING_PERF_END(SD);
     }
 }
 
@@ -407,24 +638,210 @@ void SensythingCore::periodicStatusUpdate() {
 }
 
 void SensythingCore::update() {
+    SENSYTHING_PERF_BEGIN(LOOP);
+    int64_t loopStartUs = esp_timer_get_time();
+    
     // Check for serial commands
+    SENSYTHING_PERF_BEGIN(COMMANDS);
     processSerialCommands();
+    SENSYTHING_PERF_END(COMMANDS);
+    
+    if (benchmarkPending) {
+        benchmarkPending = false;
+        benchmarkRunning = true;
+        SensythingBenchmark benchmark(*this);
+        benchmark.run(benchmarkSaveBaseline);
+        benchmarkRunning = false;
+#if SENSYTHING_PERF
+        // The benchmark's stages would swamp the live figures
+        perf.reset();
+#endif
+        return;
+    }
     
     // Handle WiFi/WebSocket events
     if (wifiModule) {
+        SENSYTHING_PERF_BEGIN(WIFI_UPDATE);
         wifiModule->update();
+        SENSYTHING_PERF_END(WIFI_UPDATE);
     }
     
-    // Take measurement if it's time
-    if (shouldTakeMeasurement()) {
-        if (readMeasurement(currentMeasurement)) {
-            currentMeasurement.measurement_count = ++sysState.measurementCount;
-            streamMeasurement();
-        }
+    // Send partial BLE batches that have waited long enough
+    if (bleModule && sysState.bleStreamingEnabled) {
+        bleModule->update();
     }
     
+    // Take measurement if it's time (the acquisition task does this in threaded mode)
+    if (!threadedAcquisition) {
+        runAcquisition(currentMeasurement, false);
+    }
+    
+    // Fan out queued samples; time-bounded so a slow sink cannot starve acquisition
+    drainMeasurements(SENSYTHING_SINK_DRAIN_BUDGET_US);
+    
     // Periodic status update
     periodicStatusUpdate();
+    
+    SENSYTHING_PERF_END(LOOP);
+    recordLoopTime((uint32_t)(esp_timer_get_time() - loopStartUs));
+}
+
+void SensythingCore::recordLoopTime(uint32_t elapsedUs) {
+    loopStats.count++;
+    loopStats.totalUs += elapsedUs;
+    if (elapsedUs > loopStats.windowMaxUs) {
+        loopStats.windowMaxUs = elapsedUs;
+    }
+    
+    // Keep the previous window so a scrape never sees a freshly emptied maximum
+    unsigned long now = millis();
+    if (now - loopStats.windowStartMs >= SENSYTHING_LOOP_STATS_WINDOW_MS) {
+        loopStats.lastWindowMaxUs = loopStats.windowMaxUs;
+        loopStats.windowMaxUs = 0;
+        loopStats.windowStartMs = now;
+    }
+}
+
+// =================================================================================================
+// THREADED ACQUISITION
+// =================================================================================================
+
+bool SensythingCore::enableThreadedAcquisition(bool enable) {
+    if (enable == threadedAcquisition) {
+        return true;
+    }
+    
+    if (enable) {
+        if (!acqTimer) {
+            esp_timer_create_args_t timerArgs = {};
+            timerArgs.callback = &SensythingCore::acquisitionTimerCallback;
+            timerArgs.arg = this;
+            timerArgs.dispatch_method = ESP_TIMER_TASK;
+            timerArgs.name = "sensything_acq";
+            if (esp_timer_create(&timerArgs, &acqTimer) != ESP_OK) {
+                Serial.println(String(EMOJI_ERROR) + " Failed to create acquisition timer");
+                acqTimer = nullptr;
+                return false;
+            }
+        }
+        if (!acqTaskExited) {
+            acqTaskExited = xSemaphoreCreateBinary();
+            if (!acqTaskExited) {
+                Serial.println(String(EMOJI_ERROR) + " Failed to create acquisition task semaphore");
+                return false;
+            }
+        }
+        
+        // Polled acquisition in update() stops as soon as the flag is set,
+        // so the task becomes the only producer on the sample ring
+        acqTaskStopRequested = false;
+        threadedAcquisition = true;
+        splitPhasePending = false;               // The task starts its own conversions
+        
+        TaskHandle_t task = nullptr;
+        BaseType_t created = xTaskCreatePinnedToCore(
+            &SensythingCore::acquisitionTaskEntry, "sensything_acq",
+            SENSYTHING_ACQ_TASK_STACK_SIZE, this, SENSYTHING_ACQ_TASK_PRIORITY,
+            &task, SENSYTHING_ACQ_TASK_CORE);
+        if (created != pdPASS) {
+            Serial.println(String(EMOJI_ERROR) + " Failed to start acquisition task");
+            threadedAcquisition = false;
+            return false;
+        }
+        acqTaskHandle = task;                    // Timer is not running yet, so no tick is lost
+        
+        restartAcquisitionTimer();
+        Serial.printf("%s Threaded acquisition enabled (core %d)\n", EMOJI_SUCCESS, SENSYTHING_ACQ_TASK_CORE);
+        return true;
+    }
+    
+    // Stop ticks first, then ask the task to leave its loop between reads so
+    // it never dies while holding the sensor bus. esp_timer_stop() does not
+    // wait for a callback already running, so the handle is withdrawn and any
+    // callback still holding it drained; the task is deleted here only after
+    // it has acknowledged, so nothing can notify a freed task.
+    esp_timer_stop(acqTimer);
+    acqTaskStopRequested = true;
+    TaskHandle_t task = acqTaskHandle.exchange(nullptr);
+    while (acqTimerCallbacks.load() != 0) {
+        taskYIELD();
+    }
+    xTaskNotifyGive(task);
+    xSemaphoreTake(acqTaskExited, portMAX_DELAY);
+    vTaskDelete(task);
+    
+    threadedAcquisition = false;
+    sysState.lastMeasurement = micros();
+    Serial.println(String(EMOJI_SUCCESS) + " Threaded acquisition disabled (polling in update())");
+    return true;
+}
+
+void SensythingCore::restartAcquisitionTimer() {
+    if (!acqTimer) {
+        return;
+    }
+    
+    esp_timer_stop(acqTimer);  // Harmless if not running
+    acqStats.intervalUs = getAcquisitionIntervalUs();
+    lastAcqTickUs = 0;
+    esp_timer_start_periodic(acqTimer, acqStats.intervalUs);
+}
+
+void SensythingCore::acquisitionTimerCallback(void* arg) {
+    SensythingCore* core = static_cast<SensythingCore*>(arg);
+    
+    // Counted in before the handle is read, so the stopper either sees this
+    // callback or this callback sees the cleared handle
+    core->acqTimerCallbacks++;
+    TaskHandle_t task = core->acqTaskHandle.load();
+    if (task) {
+        xTaskNotifyGive(task);
+    }
+    core->acqTimerCallbacks--;
+}
+
+void SensythingCore::acquisitionTaskEntry(void* arg) {
+    SensythingCore* core = static_cast<SensythingCore*>(arg);
+    core->acquisitionTaskLoop();
+    
+    // Acknowledge and park; enableThreadedAcquisition() deletes the task
+    xSemaphoreGive(core->acqTaskExited);
+    vTaskSuspend(nullptr);
+}
+
+void SensythingCore::acquisitionTaskLoop() {
+    while (true) {
+        // Each timer tick adds one notification; more than one pending means
+        // the previous read overran the sample interval
+        uint32_t ticks = ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        if (acqTaskStopRequested) {
+            return;
+        }
+        if (ticks > 1) {
+            acqStats.timerOverruns += ticks - 1;
+        }
+        
+        int64_t now = esp_timer_get_time();
+        if (lastAcqTickUs != 0) {
+            int64_t deviation = (now - lastAcqTickUs) - (int64_t)acqStats.intervalUs;
+            uint32_t jitter = (uint32_t)(deviation < 0 ? -deviation : deviation);
+            acqStats.lastJitterUs = jitter;
+            acqStats.totalJitterUs += jitter;
+            acqStats.timerTicks++;
+            if (jitter > acqStats.maxJitterUs) {
+                acqStats.maxJitterUs = jitter;
+            }
+        }
+        lastAcqTickUs = now;
+        
+        if (!sysState.measurementActive) {
+            continue;
+        }
+        
+        uint32_t before = sysState.samplesAcquired;
+        runAcquisition(acqMeasurement, true);
+        acqStats.samplesAcquired += sysState.samplesAcquired - before;
+    }
 }
 
 // =================================================================================================
@@ -487,6 +904,186 @@ void SensythingCore::processCommand(String command) {
             Serial.println(String(EMOJI_ERROR) + " Usage: set_rate <milliseconds>");
         }
         
+    } else if (command.startsWith(CMD_USB_FORMAT)) {
+        String format = command.substring(strlen(CMD_USB_FORMAT));
+        format.trim();
+        if (!usbModule) {
+            Serial.println(String(EMOJI_ERROR) + " USB streaming not initialized");
+        } else if (format == "binary") {
+            Serial.println(String(EMOJI_SUCCESS) + " USB format: binary frames");
+            usbModule->setFormat(SENSYTHING_USB_BINARY);
+        } else if (format == "csv") {
+            usbModule->setFormat(SENSYTHING_USB_CSV);
+            Serial.println(String(EMOJI_SUCCESS) + " USB format: CSV");
+        } else {
+            Serial.println(String(EMOJI_ERROR) + " Usage: usb_format <csv|binary>");
+        }
+        
+    } else if (command.startsWith(CMD_BLE_BATCH)) {
+        String arg = command.substring(strlen(CMD_BLE_BATCH));
+        arg.trim();
+        long latency = arg.toInt();
+        if (!bleModule) {
+            Serial.println(String(EMOJI_ERROR) + " BLE not initialized");
+        } else if (arg == "off") {
+            bleModule->setBatching(false);
+            Serial.println(String(EMOJI_BLUETOOTH) + " BLE batching disabled");
+        } else if (arg == "on" || (latency > 0 && latency <= 60000)) {
+            bleModule->setBatching(true, arg == "on" ? SENSYTHING_BLE_BATCH_MAX_LATENCY_MS : (uint16_t)latency);
+            updateBLELinkPolicy();
+            Serial.printf("%s BLE batching enabled (max latency %u ms)\n", EMOJI_BLUETOOTH,
+                         bleModule->getBatchMaxLatency());
+        } else {
+            Serial.println(String(EMOJI_ERROR) + " Usage: ble_batch <on|off|max_latency_ms>");
+        }
+        
+    } else if (command.startsWith(CMD_WS_BATCH)) {
+        String arg = command.substring(strlen(CMD_WS_BATCH));
+        arg.trim();
+        long window = arg.toInt();
+        if (!wifiModule) {
+            Serial.println(String(EMOJI_ERROR) + " WiFi module not initialized");
+        } else if (arg == "off") {
+            wifiModule->setBinaryStreaming(false);
+            Serial.println(String(EMOJI_WIFI) + " WebSocket streaming: JSON per sample");
+        } else if (arg == "on" || (window > 0 && window <= 60000)) {
+            wifiModule->setBinaryStreaming(true, arg == "on" ? SENSYTHING_WS_BATCH_WINDOW_MS : (uint16_t)window);
+            Serial.printf("%s WebSocket streaming: binary frames (window %u ms)\n", EMOJI_WIFI,
+                         wifiModule->getBatchWindow());
+        } else {
+            Serial.println(String(EMOJI_ERROR) + " Usage: ws_batch <on|off|window_ms>");
+        }
+        
+    } else if (command.startsWith(CMD_SD_FORMAT)) {
+        String format = command.substring(strlen(CMD_SD_FORMAT));
+        format.trim();
+        if (!sdModule) {
+            Serial.println(String(EMOJI_ERROR) + " SD Card not initialized");
+        } else if (format == "binary") {
+            sdModule->setFormat(SENSYTHING_SD_BINARY);
+            Serial.println(String(EMOJI_STORAGE) + " SD log format: binary (.bin)");
+        } else if (format == "csv") {
+            sdModule->setFormat(SENSYTHING_SD_CSV);
+            Serial.println(String(EMOJI_STORAGE) + " SD log format: CSV (.csv)");
+        } else {
+            Serial.println(String(EMOJI_ERROR) + " Usage: sd_format <csv|binary>");
+        }
+        
+    } else if (command.startsWith(CMD_BENCH)) {
+        String arg = command.substring(strlen(CMD_BENCH));
+        arg.trim();
+        if (benchmarkRunning) {
+            Serial.println(String(EMOJI_ERROR) + " Benchmark already running");
+        } else if (arg.length() == 0 || arg == "save") {
+            // Runs from update() so it never nests inside a WiFi or BLE callback
+            benchmarkPending = true;
+            benchmarkSaveBaseline = (arg == "save");
+        } else if (arg == "clear") {
+            SensythingBenchmark::clearBaseline();
+            Serial.println(String(EMOJI_SUCCESS) + " Benchmark baseline cleared");
+        } else {
+            Serial.println(String(EMOJI_ERROR) + " Usage: bench [save|clear]");
+        }
+        
+    } else if (command.startsWith(CMD_PERF)) {
+        String arg = command.substring(strlen(CMD_PERF));
+        arg.trim();
+#if SENSYTHING_PERF
+        if (arg.length() == 0) {
+            perf.print();
+        } else if (arg == "reset") {
+            perf.reset();
+            Serial.println(String(EMOJI_SUCCESS) + " Stage timing reset");
+        } else {
+            Serial.println(String(EMOJI_ERROR) + " Usage: perf [reset]");
+        }
+#else
+        Serial.println(String(EMOJI_ERROR) + " Stage timing not compiled in (build with SENSYTHING_PERF 1)");
+#endif
+        
+    } else if (command.startsWith(CMD_FILTER)) {
+        handleFilterCommand(command.substring(strlen(CMD_FILTER)));
+        
+    } else if (command.startsWith(CMD_OVERSAMPLE)) {
+        int spaceIndex = command.indexOf(' ');
+        if (spaceIndex > 0) {
+            int ratio = command.substring(spaceIndex + 1).toInt();
+            setOversampling(ratio > 0 && ratio <= 255 ? (uint8_t)ratio : 0);
+        } else {
+            Serial.println(String(EMOJI_ERROR) + " Usage: oversample <1-" + String(SENSYTHING_MAX_OVERSAMPLING) + ">");
+        }
+        
+    } else if (command.startsWith(CMD_SINK_RATE)) {
+        // "sink_rate <usb|ble|wifi|sd> <divisor>"
+        String args = command.substring(strlen(CMD_SINK_RATE));
+        args.trim();
+        int spaceIndex = args.indexOf(' ');
+        String name = spaceIndex > 0 ? args.substring(0, spaceIndex) : args;
+        int divisor = spaceIndex > 0 ? args.substring(spaceIndex + 1).toInt() : 0;
+        
+        int sink = -1;
+        for (uint8_t i = 0; i < SENSYTHING_SINK_COUNT; i++) {
+            if (name == sensythingSinkName((SensythingSink)i)) {
+                sink = i;
+            }
+        }
+        if (sink >= 0 && divisor > 0 && divisor <= 255) {
+            setSinkRateDivisor((SensythingSink)sink, (uint8_t)divisor);
+        } else {
+            Serial.println(String(EMOJI_ERROR) + " Usage: sink_rate <usb|ble|wifi|sd> <divisor>");
+        }
+        
+    } else if (command.startsWith(CMD_ENCODING)) {
+        // "encoding <usb|ble|wifi> <raw|delta>"
+        String args = command.substring(strlen(CMD_ENCODING));
+        args.trim();
+        int spaceIndex = args.indexOf(' ');
+        String name = spaceIndex > 0 ? args.substring(0, spaceIndex) : args;
+        String mode = spaceIndex > 0 ? args.substring(spaceIndex + 1) : "";
+        mode.trim();
+        bool delta = (mode == "delta");
+        
+        if (mode != "raw" && !delta) {
+            Serial.println(String(EMOJI_ERROR) + " Usage: encoding <usb|ble|wifi> <raw|delta>");
+        } else if (name == "usb" && usbModule) {
+            usbModule->setDeltaEncoding(delta);
+            Serial.println(String(EMOJI_SUCCESS) + " USB binary frames: " + mode);
+            if (delta && usbModule->getFormat() != SENSYTHING_USB_BINARY) {
+                Serial.println(String(EMOJI_INFO) + " Takes effect with 'usb_format binary'");
+            }
+        } else if (name == "ble" && bleModule) {
+            bleModule->setDeltaEncoding(delta);
+            Serial.println(String(EMOJI_BLUETOOTH) + " BLE batched notifications: " + mode);
+            if (delta && !bleModule->isBatching()) {
+                Serial.println(String(EMOJI_INFO) + " Takes effect with 'ble_batch on'");
+            }
+            if (delta && sysState.bleConnected && bleModule->getMTU() < SENSYTHING_BLE_DELTA_MIN_MTU) {
+                Serial.printf("%s MTU %u is below the %u delta notifications need; samples are dropped\n",
+                             EMOJI_WARNING, bleModule->getMTU(), SENSYTHING_BLE_DELTA_MIN_MTU);
+            }
+        } else if (name == "wifi" && wifiModule) {
+            wifiModule->setDeltaEncoding(delta);
+            Serial.println(String(EMOJI_WIFI) + " WebSocket binary frames: " + mode);
+            if (delta && !wifiModule->isBinaryStreaming()) {
+                Serial.println(String(EMOJI_INFO) + " Takes effect with 'ws_batch on'");
+            }
+        } else if (name == "usb" || name == "ble" || name == "wifi") {
+            Serial.println(String(EMOJI_ERROR) + " " + name + " not initialized");
+        } else {
+            Serial.println(String(EMOJI_ERROR) + " Usage: encoding <usb|ble|wifi> <raw|delta>");
+        }
+        
+    } else if (command.startsWith(CMD_ACQ_MODE)) {
+        String mode = command.substring(strlen(CMD_ACQ_MODE));
+        mode.trim();
+        if (mode == "threaded") {
+            enableThreadedAcquisition(true);
+        } else if (mode == "polled") {
+            enableThreadedAcquisition(false);
+        } else {
+            Serial.println(String(EMOJI_ERROR) + " Usage: acq_mode <polled|threaded>");
+        }
+        
     } else if (command == "forget_wifi" || command == "clear_wifi") {
         if (wifiModule) {
             Serial.println(String(EMOJI_INFO) + " Clearing saved WiFi credentials...");
@@ -501,12 +1098,78 @@ void SensythingCore::processCommand(String command) {
             Serial.println(String(EMOJI_ERROR) + " WiFi module not initialized");
         }
         
+    } else if (handleBoardCommand(command)) {
+        // Handled by the board implementation
+        
     } else {
         Serial.printf("%s Unknown command: '%s' (type 'help' for commands)\n", 
                      EMOJI_ERROR, command.c_str());
     }
 }
 
+void SensythingCore::handleFilterCommand(String args) {
+    args.trim();
+    if (args.length() == 0) {
+        filters.print(boardConfig);
+        return;
+    }
+    if (args == "clear") {
+        filters.clear();
+        Serial.println(String(EMOJI_SUCCESS) + " All filters cleared (streaming raw data)");
+        return;
+    }
+    
+    // "<ch|all> <type> [a] [b]"
+    int spaceIndex = args.indexOf(' ');
+    String target = spaceIndex > 0 ? args.substring(0, spaceIndex) : args;
+    char type[12] = "";
+    float a = 0.0f;
+    float b = 0.0f;
+    int fields = spaceIndex > 0 ? sscanf(args.c_str() + spaceIndex + 1, "%11s %f %f", type, &a, &b) : 0;
+    
+    uint8_t first = 0;
+    uint8_t last = boardConfig.channelCount - 1;
+    if (target != "all") {
+        if (target.length() == 0 || target[0] < '0' || target[0] > '9' ||
+            target.toInt() >= boardConfig.channelCount) {
+            fields = 0;
+        } else {
+            first = last = (uint8_t)target.toInt();
+        }
+    }
+    
+    bool valid = fields >= 1;
+    bool added = true;
+    for (uint8_t ch = first; valid && ch <= last; ch++) {
+        SensythingFilterChain& chain = filters.getChain(ch);
+        if (strcmp(type, "clear") == 0) {
+            chain.clear();
+        } else if (strcmp(type, "bandpass") == 0 && fields == 3) {
+            added &= chain.addBandPass(a, b);
+        } else if (strcmp(type, "notch") == 0 && fields >= 2) {
+            added &= chain.addNotch(a);
+        } else if (strcmp(type, "average") == 0 && fields >= 2) {
+            // Range-checked before the cast; a negative or NaN length has no uint8_t value
+            added &= a >= 2 && a <= SENSYTHING_FILTER_MA_MAX_LENGTH && chain.addMovingAverage((uint8_t)a);
+        } else if (strcmp(type, "dc") == 0) {
+            added &= chain.addDCBlock(fields >= 2 ? a : SENSYTHING_FILTER_DC_CUTOFF_HZ);
+        } else {
+            valid = false;
+        }
+    }
+    filters.refresh();
+    
+    if (!valid) {
+        Serial.println(String(EMOJI_ERROR) + " Usage: filter [clear | <ch|all> <bandpass lo hi | notch hz | average n | dc [hz] | clear>]");
+        return;
+    }
+    if (!added) {
+        Serial.printf("%s Filter not added: chain full (%d stages), bad parameters or corner above Nyquist (%.2f Hz)\n",
+                     EMOJI_ERROR, SENSYTHING_FILTER_MAX_STAGES, getSampleRateHz() / 2.0f);
+    }
+    filters.print(boardConfig);
+}
+
 void SensythingCore::printHelp() {
     Serial.println("=================================");
     Serial.println("AVAILABLE COMMANDS");
@@ -517,8 +1180,22 @@ void SensythingCore::printHelp() {
     Serial.println("reset_count     - Reset measurement count");
     Serial.println("toggle_sd       - Toggle SD Card logging");
     Serial.println("rotate_file     - Force new SD file");
-    Serial.println("set_rate <ms>   - Set sample rate (20-10000)");
+    Serial.printf("set_rate <ms>   - Set sample rate (%lu-%lu)\n",
+                 boardConfig.minSampleInterval, boardConfig.maxSampleInterval);
+    Serial.println("acq_mode <mode> - Acquisition: polled | threaded");
+    Serial.println("oversample <n>  - Average n sensor reads into each sample (1 = off)");
+    Serial.println("sink_rate <sink> <n> - Send usb|ble|wifi|sd the average of every n samples");
+    Serial.println("usb_format <f>  - USB output: csv | binary");
+    Serial.println("ble_batch <x>   - BLE batching: on | off | <max latency ms>");
+    Serial.println("ws_batch <x>    - WebSocket binary frames: on | off | <window ms>");
+    Serial.println("encoding <sink> <e> - Binary payload of usb|ble|wifi: raw | delta (lossless)");
+    Serial.println("sd_format <f>   - SD log format: csv | binary");
+    Serial.println("bench [save|clear] - Benchmark the hot path (save = new baseline)");
+    Serial.println("perf [reset]    - Per-stage loop timing (min/mean/p99/max)");
+    Serial.println("filter [clear|<ch|all> <spec>] - Per-channel filters; spec: bandpass <lo> <hi>,");
+    Serial.println("                  notch <hz>, average <n>, dc [hz] or clear");
     Serial.println("forget_wifi     - Clear saved WiFi credentials");
+    printBoardHelp();
     Serial.println("help            - Show this help");
     Serial.println("=================================");
 }
@@ -538,6 +1215,7 @@ SystemStatus SensythingCore::getStatus() {
     status.uptimeSeconds = millis() / 1000;
     status.sampleRateHz = getSampleRateHz();
     status.totalMeasurements = sysState.measurementCount;
+    status.droppedSamples = sysState.droppedSamples;
     
     status.activeInterfaces = 0;
     if (sysState.usbStreamingEnabled) status.activeInterfaces |= INTERFACE_USB;
@@ -546,6 +1224,10 @@ SystemStatus SensythingCore::getStatus() {
     if (sysState.sdLoggingEnabled) status.activeInterfaces |= INTERFACE_SD_CARD;
     
     status.bleConnected = sysState.bleConnected;
+    status.bleMTU = bleModule ? bleModule->getMTU() : 0;
+    status.bleConnIntervalUs = bleModule ? bleModule->getConnIntervalUs() : 0;
+    status.blePHY = bleModule ? bleModule->getPHY() : 0;
+    status.bleNotificationsPerSec = bleModule ? bleModule->getNotificationRate() : 0;
     status.wifiConnected = sysState.wifiConnected;
     status.sdCardReady = sysState.sdCardReady;
     
@@ -559,30 +1241,144 @@ void SensythingCore::printStatus() {
     Serial.println("=================================");
     Serial.printf("%s SYSTEM STATUS\n", EMOJI_INFO);
     Serial.println("=================================");
-    Serial.printf("Board: %s\n", getBoardName().c_str());
-    Serial.printf("Sensor: %s\n", getSensorType().c_str());
+    Serial.printf("Board: %s\n", getBoardName());
+    Serial.printf("Sensor: %s\n", getSensorType());
     Serial.printf("Firmware: %s\n", SENSYTHING_ES3_VERSION);
     Serial.println();
     Serial.printf("%s Uptime: %lu seconds\n", EMOJI_TIME, millis() / 1000);
     Serial.printf("%s Sample Rate: %.2f Hz (%lu ms)\n", EMOJI_CONFIG,
                  getSampleRateHz(), sysState.sampleInterval);
+    if (sysState.oversampleRatio > 1) {
+        Serial.printf("%s Oversampling: x%u (reads at %.2f Hz)\n", EMOJI_CONFIG, sysState.oversampleRatio,
+                     isDataReadyDriven() ? 0.0f : 1000000.0f / getAcquisitionIntervalUs());
+    }
     Serial.printf("%s Measurements: %u\n", EMOJI_DATA, sysState.measurementCount);
+    Serial.printf("%s Dropped Samples: %u (queued: %u/%u, peak %u)\n", EMOJI_DATA, sysState.droppedSamples,
+                 (unsigned)sampleRing.size(), (unsigned)sampleRing.capacity(), sysState.queuePeak);
+    if (threadedAcquisition) {
+        uint32_t meanJitter = acqStats.timerTicks > 0 ?
+            (uint32_t)(acqStats.totalJitterUs / acqStats.timerTicks) : 0;
+        Serial.printf("%s Acquisition: threaded (core %d), overruns: %u\n", EMOJI_TIME,
+                     SENSYTHING_ACQ_TASK_CORE, acqStats.timerOverruns);
+        Serial.printf("%s Jitter: last %u us, mean %u us, max %u us\n", EMOJI_TIME,
+                     acqStats.lastJitterUs, meanJitter, acqStats.maxJitterUs);
+    } else {
+        Serial.printf("%s Acquisition: polled in update()\n", EMOJI_TIME);
+    }
+    printBoardStatus();
     Serial.println();
     Serial.println("Active Interfaces:");
-    Serial.printf("  %s USB: %s\n", EMOJI_NETWORK, 
-                 sysState.usbStreamingEnabled ? "ON" : "OFF");
+    Serial.printf("  %s USB: %s%s\n", EMOJI_NETWORK, 
+                 sysState.usbStreamingEnabled ? "ON" : "OFF",
+                 (usbModule && usbModule->getFormat() == SENSYTHING_USB_BINARY) ? " (binary)" : "");
     Serial.printf("  %s BLE: %s%s\n", EMOJI_BLUETOOTH,
                  sysState.bleStreamingEnabled ? "ON" : "OFF",
                  sysState.bleConnected ? " (Connected)" : "");
-    Serial.printf("  %s WiFi: %s%s\n", EMOJI_WIFI,
+    if (bleModule && sysState.bleConnected) {
+        Serial.printf("      MTU %u, interval %.2f ms, PHY %uM%s, %.1f notifications/s\n",
+                     bleModule->getMTU(), bleModule->getConnIntervalUs() / 1000.0f,
+                     bleModule->getPHY(), bleModule->isHighThroughput() ? " (fast link)" : "",
+                     bleModule->getNotificationRate());
+    }
+    if (bleModule && bleModule->isBatching()) {
+        Serial.printf("      batched, max latency %u ms, %u notifications\n",
+                     bleModule->getBatchMaxLatency(), bleModule->getNotificationCount());
+    }
+    Serial.printf("  %s WiFi: %s%s%s\n", EMOJI_WIFI,
                  sysState.wifiStreamingEnabled ? "ON" : "OFF",
-                 sysState.wifiConnected ? " (Connected)" : "");
-    Serial.printf("  %s SD Card: %s%s\n", EMOJI_STORAGE,
+                 sysState.wifiConnected ? " (Connected)" : "",
+                 (wifiModule && wifiModule->isBinaryStreaming()) ? " (binary)" : "");
+    Serial.printf("  %s SD Card: %s%s%s\n", EMOJI_STORAGE,
                  sysState.sdLoggingEnabled ? "ON" : "OFF",
-                 sysState.sdCardReady ? " (Ready)" : "");
+                 sysState.sdCardReady ? " (Ready)" : "",
+                 (sdModule && sdModule->getFormat() == SENSYTHING_SD_BINARY) ? " (binary)" : "");
+    Serial.print("  Output rates:");
+    for (uint8_t i = 0; i < SENSYTHING_SINK_COUNT; i++) {
+        uint8_t divisor = sysState.sinkRateDivisor[i];
+        Serial.printf("%s %s %.2f Hz", i > 0 ? "," : "", sensythingSinkName((SensythingSink)i),
+                     getSampleRateHz() / divisor);
+        if (divisor > 1) {
+            Serial.printf(" (1/%u)", divisor);
+        }
+    }
+    Serial.println();
+    
+    // Compression achieved by the delta-encoded sinks (SD logs are never delta encoded)
+    const SensythingDeltaEncoder* deltaEncoders[SENSYTHING_SINK_COUNT] = {
+        (usbModule && usbModule->isDeltaEncoding()) ? &usbModule->getDeltaEncoder() : nullptr,
+        (bleModule && bleModule->isDeltaEncoding()) ? &bleModule->getDeltaEncoder() : nullptr,
+        (wifiModule && wifiModule->isDeltaEncoding()) ? &wifiModule->getDeltaEncoder() : nullptr,
+        nullptr
+    };
+    bool anyDelta = false;
+    for (uint8_t i = 0; i < SENSYTHING_SINK_COUNT; i++) {
+        const SensythingDeltaEncoder* encoder = deltaEncoders[i];
+        if (!encoder) {
+            continue;
+        }
+        Serial.printf("%s %s %.2f:1 (%.2f us/record)", anyDelta ? "," : "  Delta encoding:",
+                     sensythingSinkName((SensythingSink)i), encoder->getCompressionRatio(),
+                     (float)encoder->getCyclesPerRecord() / ESP.getCpuFreqMHz());
+        anyDelta = true;
+    }
+    if (anyDelta) {
+        Serial.println();
+    }
+    if (sdModule && sysState.sdLoggingEnabled) {
+        SDWriterStats sdStats = sdModule->getWriterStats();
+        Serial.printf("      %u buffers, %u syncs, %u overruns, write max %.1f ms\n",
+                     sdStats.buffersWritten, sdStats.syncs, sdStats.overruns,
+                     sdStats.maxLatencyUs / 1000.0f);
+        Serial.print("      write latency:");
+        for (uint8_t i = 0; i < SENSYTHING_SD_LATENCY_BUCKETS; i++) {
+            uint32_t limit = SensythingSDCard::getLatencyBucketLimitUs(i);
+            if (limit > 0) {
+                Serial.printf(" <%ums:%u", limit / 1000, sdStats.latencyHistogram[i]);
+            } else {
+                Serial.printf(" >=%ums:%u", SensythingSDCard::getLatencyBucketLimitUs(i - 1) / 1000,
+                             sdStats.latencyHistogram[i]);
+            }
+        }
+        Serial.println();
+    }
     Serial.println("=================================");
 }
 
+void SensythingCore::getMetrics(SensythingMetrics& metrics) {
+    memset(&metrics, 0, sizeof(SensythingMetrics));
+    
+    metrics.uptimeSeconds = millis() / 1000;
+    metrics.samplesAcquired = sysState.samplesAcquired;
+    metrics.samplesDropped = sysState.droppedSamples;
+    metrics.queuePeak = sysState.queuePeak;
+    
+    if (sysState.usbStreamingEnabled) metrics.activeInterfaces |= INTERFACE_USB;
+    if (sysState.bleStreamingEnabled) metrics.activeInterfaces |= INTERFACE_BLE;
+    if (sysState.wifiStreamingEnabled) metrics.activeInterfaces |= INTERFACE_WIFI;
+    if (sysState.sdLoggingEnabled) metrics.activeInterfaces |= INTERFACE_SD_CARD;
+    
+    if (usbModule) metrics.sinks[SENSYTHING_SINK_USB] = usbModule->getSinkStats();
+    if (bleModule) metrics.sinks[SENSYTHING_SINK_BLE] = bleModule->getSinkStats();
+    if (wifiModule) {
+        metrics.sinks[SENSYTHING_SINK_WIFI] = wifiModule->getSinkStats();
+        metrics.wsClients = wifiModule->getClientCount();
+    }
+    if (sdModule) {
+        metrics.sinks[SENSYTHING_SINK_SD] = sdModule->getSinkStats();
+        metrics.sdWriter = sdModule->getWriterStats();
+    }
+    
+    metrics.heapFree = ESP.getFreeHeap();
+    metrics.heapMinFree = ESP.getMinFreeHeap();
+    metrics.heapLargestBlock = ESP.getMaxAllocHeap();
+    metrics.psramSize = ESP.getPsramSize();
+    metrics.psramFree = ESP.getFreePsram();
+    
+    metrics.loopCount = loopStats.count;
+    metrics.loopTotalUs = loopStats.totalUs;
+    metrics.loopMaxUs = max(loopStats.windowMaxUs, loopStats.lastWindowMaxUs);
+}
+
 const MeasurementData& SensythingCore::getCurrentMeasurement() {
     return currentMeasurement;
 }
@@ -19,8 +19,15 @@
 #define SENSYTHING_CORE_H
 
 #include <Arduino.h>
+#include <esp_timer.h>
+#include <freertos/semphr.h>
+#include <atomic>
 #include "SensythingTypes.h"
 #include "SensythingConfig.h"
+#include "SensythingRingBuffer.h"
+#include "SensythingPerf.h"
+#include "../dsp/SensythingFilter.h"
+#include "../dsp/SensythingDecimator.h"
 
 // Forward declarations for communication modules
 class SensythingUSB;
@@ -50,23 +57,70 @@ public:
      */
     virtual bool readMeasurement(MeasurementData& data) = 0;
     
+    // =================================================================================================
+    // OPTIONAL BOARD HOOKS - Override in board-specific classes as needed
+    // =================================================================================================
+    
     /**
-     * Get the board name (e.g., "Sensything Cap", "Sensything OX")
-     * @return Board name string
+     * Report whether the board buffers samples on its own (e.g. from a data-ready
+     * interrupt). When true, the platform ignores the sample interval and calls
+     * readMeasurement() until it returns false, so every buffered sample is streamed.
+     * @return true if acquisition is paced by the sensor
      */
-    virtual String getBoardName() = 0;
+    virtual bool isDataReadyDriven() { return false; }
     
     /**
-     * Get the sensor type description (e.g., "FDC1004 Capacitance", "AFE4400 PPG/SpO2")
-     * @return Sensor type string
+     * Report whether the board implements the split-phase read below. When true
+     * and acquisition is polled, update() starts a conversion when the sample is
+     * due and keeps servicing the sinks until it is ready, instead of blocking in
+     * readMeasurement(). The threaded acquisition task always uses readMeasurement().
+     * @return true if startMeasurement()/isMeasurementReady()/collectMeasurement() are usable
      */
-    virtual String getSensorType() = 0;
+    virtual bool isSplitPhase() { return false; }
     
     /**
-     * Get board-specific configuration
-     * @return BoardConfig structure with board details
+     * Report whether readMeasurement() returns at once with a fresh sample (no
+     * conversion wait, never empty). Only the benchmark uses this, to time the
+     * acquisition path without sensor latency.
+     * @return true for compute-only sources such as the simulator
      */
-    virtual BoardConfig getBoardConfig() = 0;
+    virtual bool isReadNonBlocking() { return false; }
+    
+    /**
+     * Begin a conversion without waiting for it (split-phase read)
+     * @return true if a conversion is now in flight
+     */
+    virtual bool startMeasurement() { return false; }
+    
+    /**
+     * Check the conversion started by startMeasurement() without blocking
+     * @return true once collectMeasurement() can be called (done or timed out)
+     */
+    virtual bool isMeasurementReady() { return true; }
+    
+    /**
+     * Fetch the result of a ready conversion
+     * @param data Reference to measurement data structure to fill
+     * @return true if a sample was produced
+     */
+    virtual bool collectMeasurement(MeasurementData& data) { return readMeasurement(data); }
+    
+    /**
+     * Handle a board-specific command not recognized by the platform
+     * @param command Trimmed, lower-case command string
+     * @return true if the command was handled
+     */
+    virtual bool handleBoardCommand(const String& command) { return false; }
+    
+    /**
+     * Print board-specific lines for the status report
+     */
+    virtual void printBoardStatus() {}
+    
+    /**
+     * Print board-specific lines for the help text
+     */
+    virtual void printBoardHelp() {}
     
     // =================================================================================================
     // PLATFORM INITIALIZATION
@@ -183,6 +237,36 @@ public:
      */
     float getSampleRateHz();
     
+    /**
+     * Oversample and decimate: read the sensor `ratio` times per sample
+     * interval and stream the boxcar average of each block, so the output rate
+     * stays at setSampleRate() while white noise drops by sqrt(ratio).
+     * Sensor-paced (data-ready) boards average every `ratio` buffered samples.
+     * @param ratio Reads per output sample (1 = off, up to SENSYTHING_MAX_OVERSAMPLING)
+     * @return true if successful, false if the reads would exceed the board's fastest rate
+     */
+    bool setOversampling(uint8_t ratio);
+    
+    uint8_t getOversampling() { return sysState.oversampleRatio; }
+    
+    /**
+     * Get the interval between sensor reads (sample interval / oversampling)
+     * @return Acquisition interval in microseconds
+     */
+    unsigned long getAcquisitionIntervalUs() { return sysState.sampleInterval * 1000UL / sysState.oversampleRatio; }
+    
+    /**
+     * Give one sink a lower rate than the stream, e.g. full rate to SD and USB
+     * but a few Hz to BLE and the dashboard. The sink receives the average of
+     * every `divisor` samples, so slow links neither alias nor hold up the others.
+     * @param sink Sink to configure
+     * @param divisor Samples averaged per delivered sample (1 = full rate)
+     * @return true if successful, false if out of range
+     */
+    bool setSinkRateDivisor(SensythingSink sink, uint8_t divisor);
+    
+    uint8_t getSinkRateDivisor(SensythingSink sink) { return sysState.sinkRateDivisor[sink]; }
+    
     /**
      * Start measurements
      */
@@ -198,6 +282,30 @@ public:
      */
     void resetMeasurementCount();
     
+    /**
+     * Enable/disable threaded acquisition
+     * 
+     * When enabled, a high-priority task pinned to SENSYTHING_ACQ_TASK_CORE is
+     * woken by a hardware timer every sample interval and reads the sensor, while
+     * update() only services commands, WiFi and the sinks. Samples are handed over
+     * through the bounded sample ring.
+     * @param enable true for threaded mode, false for millis() polling in update()
+     * @return true if the requested mode is active
+     */
+    bool enableThreadedAcquisition(bool enable);
+    
+    /**
+     * Check whether threaded acquisition is active
+     * @return true if the acquisition task is running
+     */
+    bool isThreadedAcquisition() { return threadedAcquisition; }
+    
+    /**
+     * Get timing statistics of the acquisition task
+     * @return AcquisitionStats snapshot
+     */
+    AcquisitionStats getAcquisitionStats() { return acqStats; }
+    
     // =================================================================================================
     // MAIN LOOP HANDLER
     // =================================================================================================
@@ -243,6 +351,15 @@ public:
      */
     void printStatus();
     
+    /**
+     * Snapshot the counters exported by /api/metrics
+     * 
+     * Only reads counters the sinks and the loop keep up to date, so it is
+     * cheap enough to call on every scrape.
+     * @param metrics Snapshot to fill
+     */
+    void getMetrics(SensythingMetrics& metrics);
+    
     /**
      * Get current measurement data
      * @return Reference to last measurement
@@ -253,6 +370,16 @@ public:
     // GETTER METHODS
     // =================================================================================================
     
+    /**
+     * Get the board configuration the board filled in at construction
+     * @return Reference to the configuration (valid for the lifetime of the board)
+     */
+    const BoardConfig& getBoardConfig() const { return boardConfig; }
+    
+    // Board name (e.g., "Sensything Cap") and sensor description (e.g., "FDC1004 Capacitance")
+    const char* getBoardName() const { return boardConfig.boardName; }
+    const char* getSensorType() const { return boardConfig.sensorType; }
+    
     bool isUSBEnabled() { return sysState.usbStreamingEnabled; }
     bool isBLEEnabled() { return sysState.bleStreamingEnabled; }
     bool isWiFiEnabled() { return sysState.wifiStreamingEnabled; }
@@ -261,6 +388,7 @@ public:
     bool isWiFiConnected() { return sysState.wifiConnected; }
     bool isSDReady() { return sysState.sdCardReady; }
     uint32_t getMeasurementCount() { return sysState.measurementCount; }
+    uint32_t getDroppedSampleCount() { return sysState.droppedSamples; }
     
 protected:
     // =================================================================================================
@@ -269,7 +397,46 @@ protected:
     
     SystemState sysState;
     MeasurementData currentMeasurement;
-    BoardConfig boardConfig;
+    BoardConfig boardConfig;                     // Set by the board constructor from its descriptor
+    
+    // Samples waiting to be fanned out to the sinks (acquisition -> streaming)
+    SensythingRingBuffer<MeasurementData, SENSYTHING_SAMPLE_RING_SIZE> sampleRing;
+    
+    // Threaded acquisition state
+    volatile bool threadedAcquisition;
+    volatile bool acqTaskStopRequested;
+    std::atomic<TaskHandle_t> acqTaskHandle;     // Owned by enableThreadedAcquisition(); the task never clears it
+    SemaphoreHandle_t acqTaskExited;             // Given by the task when it has left its loop
+    std::atomic<uint32_t> acqTimerCallbacks;     // Timer callbacks currently holding acqTaskHandle
+    esp_timer_handle_t acqTimer;
+    AcquisitionStats acqStats;
+    int64_t lastAcqTickUs;
+    MeasurementData acqMeasurement;              // Written only by the acquisition task
+    bool splitPhasePending;                      // startMeasurement() issued, not yet collected
+    
+    // update() timing for /api/metrics
+    LoopStats loopStats;
+    
+    // Benchmark requested by the 'bench' command, run at the top of update()
+    bool benchmarkPending;
+    bool benchmarkSaveBaseline;
+    bool benchmarkRunning;                       // A stage's commands must not queue another run
+    
+    // Per-channel filters applied to every sample before the sinks
+    SensythingFilterBank filters;
+    
+    // Oversampling; owned by the acquisition context, which picks up ratio
+    // changes from sysState.oversampleRatio
+    SensythingDecimator decimator;
+    
+    // Per-sink rate reduction, run in the streaming context
+    SensythingDecimator sinkDecimators[SENSYTHING_SINK_COUNT];
+    uint32_t sinkSequence[SENSYTHING_SINK_COUNT];  // Last sample number each sink was given
+    
+#if SENSYTHING_PERF
+    // Stage latency probes reported by the 'perf' command
+    SensythingPerf perf;
+#endif
     
     // Communication module pointers (managed by platform)
     SensythingUSB* usbModule;
@@ -293,14 +460,158 @@ protected:
     bool shouldTakeMeasurement();
     
     /**
-     * Stream current measurement to all active interfaces
+     * Take whatever samples are due: called once per update() pass when
+     * polling, and once per timer tick by the acquisition task. This is the
+     * only virtual call on the acquisition path; SensythingCoreT implements it
+     * with the board's read bound statically, so nothing inside the per-sample
+     * loop is dispatched through the vtable.
+     * @param data Buffer the board fills
+     * @param timerTick true when called by the acquisition task (the timer paces the reads)
      */
-    void streamMeasurement();
+    virtual void runAcquisition(MeasurementData& data, bool timerTick);
+    
+    /**
+     * Read back to back until the board has nothing more (the data-ready path)
+     * @param data Buffer the board fills
+     * @param maxSamples Upper bound on the reads
+     * @return Samples read
+     */
+    virtual size_t acquireBurst(MeasurementData& data, size_t maxSamples);
+    
+    /**
+     * The body of runAcquisition(), shared by SensythingCore and SensythingCoreT
+     * @param read Callable bool(MeasurementData&) that reads one sample
+     */
+    template <typename Reader>
+    void runAcquisitionWith(MeasurementData& data, bool timerTick, Reader read) {
+        if (isDataReadyDriven()) {
+            if (sysState.measurementActive) {
+                // Bounded by the free ring space, so a sensor running faster than
+                // the sinks cannot pin us here or overflow the ring; the rest
+                // waits in the board's own buffer for the next pass
+                size_t room = (sampleRing.capacity() - sampleRing.size()) * sysState.oversampleRatio;
+                acquireBurstWith(data, room, read);
+            }
+        } else if (timerTick) {
+            acquireWith(data, read);  // Blocking read, split-phase boards included
+        } else if (splitPhasePending || isSplitPhase()) {
+            acquireSplitPhaseMeasurement(data);
+        } else if (shouldTakeMeasurement()) {
+            acquireWith(data, read);
+        }
+    }
+    
+    template <typename Reader>
+    size_t acquireBurstWith(MeasurementData& data, size_t maxSamples, Reader read) {
+        size_t count = 0;
+        while (count < maxSamples && acquireWith(data, read)) {
+            count++;
+        }
+        return count;
+    }
+    
+    /**
+     * Read one sample, then number and queue it for streaming
+     * @return true if a sample was read
+     */
+    template <typename Reader>
+    bool acquireWith(MeasurementData& data, Reader read) {
+        SENSYTHING_PERF_BEGIN(READ);
+        if (!read(data)) {
+            return false;  // Empty data-ready polls are not timed
+        }
+        SENSYTHING_PERF_END(READ);
+        recordMeasurement(data);
+        return true;
+    }
+    
+    /**
+     * Advance a split-phase read: start a conversion when one is due, collect it
+     * once the board reports it ready
+     * @param data Buffer the board fills
+     */
+    void acquireSplitPhaseMeasurement(MeasurementData& data);
+    
+    /**
+     * Forget a split-phase read in flight. Boards call this when they take the
+     * bus away from update() or hand it back (e.g. a data-ready mode), so a
+     * conversion started before the switch is never collected after it.
+     */
+    void resetSplitPhase() { splitPhasePending = false; }
+    
+    /**
+     * Decimate an acquired read, then number and queue each output sample
+     * @param data Sample the board filled
+     */
+    void recordMeasurement(MeasurementData& data);
+    
+    /**
+     * Apply a sink's rate divisor to a sample. A reduced sink's samples are
+     * numbered consecutively, so receivers batch them and check for gaps as
+     * they do at full rate.
+     * @param sink Sink about to receive the sample
+     * @param data Sample from the stream
+     * @param scratch Buffer for the averaged sample
+     * @return Sample to deliver, or nullptr if the sink skips this one
+     */
+    const MeasurementData* sinkSample(SensythingSink sink, const MeasurementData& data, MeasurementData& scratch);
+    
+    /**
+     * Parse and apply a 'filter' command
+     * @param args Text after "filter"
+     */
+    void handleFilterCommand(String args);
+    
+    /**
+     * Queue an acquired sample for streaming
+     * @param data Sample to queue (copied into the sample ring)
+     * @return true if queued, false if the ring was full and the sample was dropped
+     */
+    bool queueMeasurement(const MeasurementData& data);
+    
+    /**
+     * Fan out queued samples to the sinks until the ring is empty or the
+     * budget is spent (at least one sample is always streamed)
+     * @param budgetUs Time allowed for this call in microseconds
+     */
+    void drainMeasurements(uint32_t budgetUs);
+    
+    /**
+     * Stream a measurement to all active interfaces
+     * @param data Measurement to stream
+     */
+    void streamMeasurement(const MeasurementData& data);
+    
+    /**
+     * Ask the BLE module for a fast link when the sample rate or batching needs it
+     */
+    void updateBLELinkPolicy();
     
     /**
      * Periodic status update
      */
     void periodicStatusUpdate();
+    
+    /**
+     * Add one update() duration to loopStats
+     * @param elapsedUs Duration in microseconds
+     */
+    void recordLoopTime(uint32_t elapsedUs);
+    
+    /**
+     * (Re)program the acquisition timer period from sysState.sampleInterval
+     */
+    void restartAcquisitionTimer();
+    
+    /**
+     * Body of the acquisition task (runs until acqTaskStopRequested)
+     */
+    void acquisitionTaskLoop();
+    
+    static void acquisitionTaskEntry(void* arg);
+    static void acquisitionTimerCallback(void* arg);
+    
+    friend class SensythingBenchmark;
 };
 
 #endif // SENSYTHING_CORE_H
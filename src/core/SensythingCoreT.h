@@ -0,0 +1,66 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    SensythingES3 - Statically Dispatched Core
+//    CRTP base that binds a board's sensor read at compile time
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SENSYTHING_CORE_T_H
+#define SENSYTHING_CORE_T_H
+
+#include "SensythingCore.h"
+
+/**
+ * Base for boards with a fixed channel layout. The board derives from
+ * SensythingCoreT<itself> and provides
+ *
+ *   static const uint8_t CHANNELS;               // Channels in every sample
+ *   bool readSample(MeasurementData& data);      // Same contract as readMeasurement()
+ *
+ * runAcquisition() is instantiated with readSample() called by name, so the
+ * whole per-sample loop (read, oversampling, queueing) runs without virtual
+ * dispatch and the compiler may inline the read into it; the only indirect
+ * call left is runAcquisition() itself, once per update() pass or timer tick.
+ * Split-phase polls still go through the board's virtual hooks. Code holding a
+ * SensythingCore& reads through readMeasurement(), which forwards here; boards
+ * with a layout only known at run time (e.g. SensythingReplay) derive from
+ * SensythingCore as before.
+ *
+ * The instantiation for a board is emitted with the board's constructor, in
+ * the translation unit that defines readSample().
+ */
+template <typename Board>
+class SensythingCoreT : public SensythingCore {
+public:
+    bool readMeasurement(MeasurementData& data) override final {
+        return board().readSample(data);
+    }
+
+protected:
+    void runAcquisition(MeasurementData& data, bool timerTick) override final {
+        runAcquisitionWith(data, timerTick, StaticRead(board()));
+    }
+
+    size_t acquireBurst(MeasurementData& data, size_t maxSamples) override final {
+        return acquireBurstWith(data, maxSamples, StaticRead(board()));
+    }
+
+private:
+    // Calls Board::readSample() by name, so the instantiated loops contain no indirect call
+    struct StaticRead {
+        Board& target;
+        explicit StaticRead(Board& board) : target(board) {}
+        bool operator()(MeasurementData& data) const { return target.readSample(data); }
+    };
+
+    Board& board() {
+        static_assert(Board::CHANNELS > 0 && Board::CHANNELS <= SENSYTHING_MAX_CHANNELS,
+                      "Board::CHANNELS must fit in MeasurementData");
+        return *static_cast<Board*>(this);
+    }
+};
+
+#endif // SENSYTHING_CORE_T_H
@@ -0,0 +1,146 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Platform - Delta Codec Implementation
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#include "SensythingDeltaCodec.h"
+#include <math.h>
+
+#define DELTA_EXACT_LIMIT 16777216.0f            // 2^24, the largest whole float without gaps
+
+static inline size_t putVarint(uint8_t* buffer, uint32_t value) {
+    size_t length = 0;
+    while (value >= 0x80) {
+        buffer[length++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    buffer[length++] = (uint8_t)value;
+    return length;
+}
+
+static inline uint32_t zigzag(int32_t value) {
+    return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+static inline bool isWholeValue(float value) {
+    // Also false for NaN and infinity
+    return fabsf(value) <= DELTA_EXACT_LIMIT && value == (float)(int32_t)value;
+}
+
+SensythingDeltaEncoder::SensythingDeltaEncoder() {
+    keyframeInterval = SENSYTHING_DELTA_KEYFRAME_INTERVAL;
+    reset();
+    resetStats();
+}
+
+void SensythingDeltaEncoder::setKeyframeInterval(uint16_t interval) {
+    keyframeInterval = interval > 0 ? interval : 1;
+    reset();
+}
+
+void SensythingDeltaEncoder::reset() {
+    needKeyframe = true;
+    sinceKeyframe = 0;
+    channelCount = 0;
+    previousSequence = 0;
+    previousTimestamp = 0;
+    memset(reference, 0, sizeof(reference));
+    memset(previousMetadata, 0, sizeof(previousMetadata));
+}
+
+void SensythingDeltaEncoder::resetStats() {
+    records = 0;
+    rawBytes = 0;
+    encodedBytes = 0;
+    totalCycles = 0;
+}
+
+size_t SensythingDeltaEncoder::encode(uint8_t* buffer, const MeasurementData& data) {
+    uint32_t start = ESP.getCycleCount();
+    uint8_t channels = data.channel_count < SENSYTHING_MAX_CHANNELS ? data.channel_count : SENSYTHING_MAX_CHANNELS;
+
+    size_t length;
+    if (needKeyframe || channels != channelCount || sinceKeyframe >= keyframeInterval) {
+        length = encodeKeyframe(buffer, data, channels);
+    } else {
+        length = encodeDelta(buffer, data, channels);
+    }
+
+    previousSequence = data.measurement_count;
+    previousTimestamp = data.timestamp;
+    memcpy(previousMetadata, data.metadata, channels);
+
+    records++;
+    rawBytes += SENSYTHING_DELTA_RAW_RECORD_SIZE(channels);
+    encodedBytes += length;
+    totalCycles += ESP.getCycleCount() - start;
+    return length;
+}
+
+size_t SensythingDeltaEncoder::encodeKeyframe(uint8_t* buffer, const MeasurementData& data, uint8_t channels) {
+    size_t index = 0;
+    buffer[index++] = SENSYTHING_DELTA_KEYFRAME | channels;
+    memcpy(&buffer[index], &data.measurement_count, 4);
+    index += 4;
+    memcpy(&buffer[index], &data.timestamp, 4);
+    index += 4;
+    buffer[index++] = data.status_flags;
+    memcpy(&buffer[index], data.channels, 4 * channels);
+    index += 4 * channels;
+    memcpy(&buffer[index], data.metadata, channels);
+    index += channels;
+
+    for (uint8_t i = 0; i < channels; i++) {
+        reference[i] = isWholeValue(data.channels[i]) ? (int32_t)data.channels[i] : 0;
+    }
+    channelCount = channels;
+    sinceKeyframe = 1;
+    needKeyframe = false;
+    return index;
+}
+
+size_t SensythingDeltaEncoder::encodeDelta(uint8_t* buffer, const MeasurementData& data, uint8_t channels) {
+    uint8_t header = 0;
+    if (memcmp(previousMetadata, data.metadata, channels) != 0) {
+        header |= SENSYTHING_DELTA_METADATA;
+    }
+
+    size_t index = 1;  // Header byte, filled in below
+    index += putVarint(&buffer[index], data.measurement_count - previousSequence);
+    index += putVarint(&buffer[index], data.timestamp - previousTimestamp);
+    buffer[index++] = data.status_flags;
+
+    for (uint8_t i = 0; i < channels; i++) {
+        float value = data.channels[i];
+        if (isWholeValue(value)) {
+            int32_t whole = (int32_t)value;
+            index += putVarint(&buffer[index], zigzag(whole - reference[i]));
+            reference[i] = whole;
+        } else {
+            header |= (1 << i);
+            memcpy(&buffer[index], &value, 4);
+            index += 4;
+        }
+    }
+
+    if (header & SENSYTHING_DELTA_METADATA) {
+        memcpy(&buffer[index], data.metadata, channels);
+        index += channels;
+    }
+
+    buffer[0] = header;
+    sinceKeyframe++;
+    return index;
+}
+
+float SensythingDeltaEncoder::getCompressionRatio() const {
+    return encodedBytes ? (float)rawBytes / encodedBytes : 0.0f;
+}
+
+uint32_t SensythingDeltaEncoder::getCyclesPerRecord() const {
+    return records ? (uint32_t)(totalCycles / records) : 0;
+}
@@ -0,0 +1,116 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Platform - Delta Codec
+//    Lossless delta + zigzag + varint encoding of measurement streams
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SENSYTHING_DELTA_CODEC_H
+#define SENSYTHING_DELTA_CODEC_H
+
+#include <Arduino.h>
+#include "SensythingTypes.h"
+#include "SensythingConfig.h"
+
+// Record layout (little-endian). A keyframe stands alone:
+//   [0]   uint8   0x80 | channel count N
+//   [1]   uint32  sequence number (measurement_count)
+//   [5]   uint32  timestamp (ms)
+//   [9]   uint8   status flags
+//   [10]  float32 channels[N]
+//   [..]  uint8   metadata[N]
+// Any other record is relative to the one before it:
+//   [0]   uint8   bit 6: metadata follows; bits 0-3: channels sent as float32
+//         varint  sequence number - previous
+//         varint  timestamp - previous (ms)
+//         uint8   status flags
+//         per channel: float32 if its bit is set in [0], else
+//                      varint zigzag(value - reference)
+//         uint8   metadata[N] (only if bit 6 is set)
+// Varints are unsigned LEB128 (7 bits per byte, low bits first); differences
+// of the sequence number and timestamp wrap modulo 2^32. A channel is delta
+// coded when its value is a whole number no larger than 2^24 in magnitude, so
+// the float holds it exactly; its reference is the last such value sent on
+// that channel (0 after a keyframe whose value was not whole).
+#define SENSYTHING_DELTA_KEYFRAME 0x80
+#define SENSYTHING_DELTA_METADATA 0x40
+#define SENSYTHING_DELTA_FLOAT_MASK 0x0F
+#define SENSYTHING_DELTA_RAW_RECORD_SIZE(n) (10 + 5 * (n))  // Keyframe size; the uncompressed record
+
+/**
+ * Streaming encoder for one output stream.
+ *
+ * Raw ADC counts (e.g. the OX's IR/RED values) change little from sample to
+ * sample, so their differences fit in one or two varint bytes instead of a
+ * four-byte float. Channels carrying fractional values (pF, SpO2) are sent as
+ * float32 and cost nothing extra beyond the header bits. A keyframe every
+ * SENSYTHING_DELTA_KEYFRAME_INTERVAL records, on a channel count change and
+ * after reset() lets a receiver join mid-stream or recover from a lost frame.
+ */
+class SensythingDeltaEncoder {
+public:
+    SensythingDeltaEncoder();
+
+    /**
+     * Set how often a keyframe is forced
+     * @param interval Records between keyframes (1 = keyframes only)
+     */
+    void setKeyframeInterval(uint16_t interval);
+
+    /**
+     * Make the next record a keyframe (e.g. at the start of a new frame or
+     * after the receiver may have missed data)
+     */
+    void reset();
+
+    /**
+     * Encode one sample
+     * @param buffer Output, at least SENSYTHING_DELTA_MAX_RECORD_SIZE bytes
+     * @param data Sample to encode
+     * @return Record size in bytes
+     */
+    size_t encode(uint8_t* buffer, const MeasurementData& data);
+
+    /**
+     * Uncompressed record bytes per encoded byte since the last resetStats()
+     * @return Compression ratio (0 before the first record)
+     */
+    float getCompressionRatio() const;
+
+    /**
+     * Mean cost of encode()
+     * @return CPU cycles per record (0 before the first record)
+     */
+    uint32_t getCyclesPerRecord() const;
+
+    uint32_t getRecordCount() const { return records; }
+
+    /**
+     * Restart the compression and cost figures
+     */
+    void resetStats();
+
+private:
+    uint16_t keyframeInterval;
+    uint16_t sinceKeyframe;                      // Records since the last keyframe
+    bool needKeyframe;
+    uint8_t channelCount;
+    uint32_t previousSequence;
+    uint32_t previousTimestamp;
+    int32_t reference[SENSYTHING_MAX_CHANNELS];  // Last whole value sent per channel
+    uint8_t previousMetadata[SENSYTHING_MAX_CHANNELS];
+
+    // Statistics
+    uint32_t records;
+    uint64_t rawBytes;
+    uint64_t encodedBytes;
+    uint64_t totalCycles;
+
+    size_t encodeKeyframe(uint8_t* buffer, const MeasurementData& data, uint8_t channels);
+    size_t encodeDelta(uint8_t* buffer, const MeasurementData& data, uint8_t channels);
+};
+
+#endif // SENSYTHING_DELTA_CODEC_H
@@ -0,0 +1,204 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Platform - Text Formatting Implementation
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#include "SensythingFormat.h"
+#include <string.h>
+
+SensythingTextWriter::SensythingTextWriter(char* buffer, size_t size) {
+    this->buffer = buffer;
+    capacity = size - 1;
+    reset();
+}
+
+void SensythingTextWriter::reset() {
+    used = 0;
+    overflow = false;
+    buffer[0] = '\0';
+}
+
+SensythingTextWriter& SensythingTextWriter::appendBytes(const char* bytes, size_t count) {
+    if (overflow) {
+        return *this;
+    }
+    if (count > capacity - used) {
+        overflow = true;
+        return *this;
+    }
+    memcpy(&buffer[used], bytes, count);
+    used += count;
+    buffer[used] = '\0';
+    return *this;
+}
+
+SensythingTextWriter& SensythingTextWriter::append(const char* text) {
+    return appendBytes(text, strlen(text));
+}
+
+SensythingTextWriter& SensythingTextWriter::append(char c) {
+    return appendBytes(&c, 1);
+}
+
+SensythingTextWriter& SensythingTextWriter::appendUInt(uint32_t value) {
+    char digits[10];
+    size_t count = 0;
+    do {
+        digits[sizeof(digits) - 1 - count++] = '0' + (value % 10);
+        value /= 10;
+    } while (value > 0);
+    return appendBytes(&digits[sizeof(digits) - count], count);
+}
+
+SensythingTextWriter& SensythingTextWriter::appendUInt64(uint64_t value) {
+    char digits[20];
+    size_t count = 0;
+    do {
+        digits[sizeof(digits) - 1 - count++] = '0' + (value % 10);
+        value /= 10;
+    } while (value > 0);
+    return appendBytes(&digits[sizeof(digits) - count], count);
+}
+
+SensythingTextWriter& SensythingTextWriter::appendHex(uint32_t value) {
+    static const char HEX_DIGITS[] = "0123456789abcdef";
+    char digits[8];
+    size_t count = 0;
+    do {
+        digits[sizeof(digits) - 1 - count++] = HEX_DIGITS[value & 0x0F];
+        value >>= 4;
+    } while (value > 0);
+    return appendBytes(&digits[sizeof(digits) - count], count);
+}
+
+// appendFixed() works on the float's exact value, mantissa * 2^shift, held in
+// 32-bit words (least significant first): up to 2^128 for the whole part, and
+// for a fraction up to 149 bits below the point plus the digit above them
+#define FIXED_WORDS 6
+
+// Multiply in place, returning what carried out of the top word
+static uint32_t fixedMultiply(uint32_t* words, size_t count, uint32_t factor) {
+    uint64_t carry = 0;
+    for (size_t i = 0; i < count; i++) {
+        carry += (uint64_t)words[i] * factor;
+        words[i] = (uint32_t)carry;
+        carry >>= 32;
+    }
+    return (uint32_t)carry;
+}
+
+// Divide in place, returning the remainder
+static uint32_t fixedDivide(uint32_t* words, size_t count, uint32_t divisor) {
+    uint64_t remainder = 0;
+    for (size_t i = count; i-- > 0;) {
+        remainder = (remainder << 32) | words[i];
+        words[i] = (uint32_t)(remainder / divisor);
+        remainder %= divisor;
+    }
+    return (uint32_t)remainder;
+}
+
+SensythingTextWriter& SensythingTextWriter::appendFixed(float value, uint8_t decimals) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    uint32_t exponent = (bits >> 23) & 0xFF;
+    uint32_t mantissa = bits & 0x7FFFFF;
+
+    if (bits >> 31) {
+        append('-');                             // printf keeps the sign of -0 and -nan
+    }
+    if (exponent == 0xFF) {
+        return append(mantissa ? "nan" : "inf");
+    }
+    if (decimals > 9) decimals = 9;
+    if (exponent) {
+        mantissa |= 0x800000;
+    } else {
+        exponent = 1;                            // Subnormal
+    }
+    int shift = (int)exponent - 150;
+
+    uint32_t words[FIXED_WORDS] = {0};
+    char digits[9];
+
+    // Whole number: every decimal is zero
+    if (shift >= 0) {
+        words[shift / 32] = mantissa << (shift % 32);
+        if (shift % 32 > 8) {
+            words[shift / 32 + 1] = mantissa >> (32 - shift % 32);
+        }
+        char text[40];                           // 2^128 has 39 digits
+        size_t count = 0;
+        bool more;
+        do {
+            uint32_t chunk = fixedDivide(words, FIXED_WORDS, 1000000000UL);
+            more = false;
+            for (size_t i = 0; i < FIXED_WORDS; i++) {
+                more = more || words[i];
+            }
+            for (int i = 0; i < 9 && (more || chunk || i == 0); i++) {
+                text[sizeof(text) - 1 - count++] = '0' + chunk % 10;
+                chunk /= 10;
+            }
+        } while (more);
+        appendBytes(&text[sizeof(text) - count], count);
+        if (decimals > 0) {
+            memset(digits, '0', decimals);
+            append('.');
+            appendBytes(digits, decimals);
+        }
+        return *this;
+    }
+
+    // Split at the binary point: the fraction is words / 2^point
+    uint32_t point = (uint32_t)-shift;
+    uint32_t whole = point < 24 ? mantissa >> point : 0;
+    words[0] = point < 24 ? mantissa & ((1UL << point) - 1) : mantissa;
+    size_t count = point / 32 + 2;               // Room for the digit above the point
+    uint32_t top = point / 32;
+    uint32_t bit = point % 32;
+
+    // Each digit is what multiplying by ten pushes above the point
+    for (uint8_t d = 0; d < decimals; d++) {
+        fixedMultiply(words, count, 10);
+        uint64_t above = ((uint64_t)words[top + 1] << 32 | words[top]) >> bit;
+        digits[d] = '0' + (char)above;
+        words[top] &= bit ? (1UL << bit) - 1 : 0;
+        words[top + 1] = 0;
+    }
+
+    // Round half to even on the exact remainder, as printf does
+    uint32_t halfWord = (point - 1) / 32;
+    uint32_t halfBit = 1UL << ((point - 1) % 32);
+    bool roundUp = false;
+    if (words[halfWord] & halfBit) {
+        bool exactHalf = (words[halfWord] & (halfBit - 1)) == 0;
+        for (uint32_t i = 0; i < halfWord && exactHalf; i++) {
+            exactHalf = words[i] == 0;
+        }
+        uint32_t last = decimals ? (uint32_t)(digits[decimals - 1] - '0') : whole;
+        roundUp = !exactHalf || (last & 1);
+    }
+    if (roundUp) {
+        int d = decimals - 1;
+        for (; d >= 0 && digits[d] == '9'; d--) {
+            digits[d] = '0';
+        }
+        if (d >= 0) {
+            digits[d]++;
+        } else {
+            whole++;
+        }
+    }
+
+    appendUInt(whole);
+    if (decimals > 0) {
+        append('.');
+        appendBytes(digits, decimals);
+    }
+    return *this;
+}
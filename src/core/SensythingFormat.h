@@ -0,0 +1,87 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Platform - Text Formatting
+//    Allocation-free writer shared by the CSV and JSON sinks
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SENSYTHING_FORMAT_H
+#define SENSYTHING_FORMAT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "SensythingTypes.h"
+
+/**
+ * Appends text to a caller-provided, fixed-size buffer.
+ *
+ * Nothing is allocated: integers and floats are converted in place, so the
+ * sinks can format every sample without touching the heap. The buffer is
+ * always NUL-terminated. Text that does not fit is dropped and overflowed()
+ * reports it; the buffer then holds the prefix that did fit.
+ */
+class SensythingTextWriter {
+public:
+    /**
+     * @param buffer Destination buffer
+     * @param size Buffer size in bytes including the terminating NUL (at least 1)
+     */
+    SensythingTextWriter(char* buffer, size_t size);
+
+    /**
+     * Discard the formatted text and start again at the beginning of the buffer
+     */
+    void reset();
+
+    SensythingTextWriter& append(const char* text);
+    SensythingTextWriter& append(char c);
+
+    /**
+     * Append an unsigned integer in decimal
+     */
+    SensythingTextWriter& appendUInt(uint32_t value);
+    SensythingTextWriter& appendUInt64(uint64_t value);
+
+    /**
+     * Append an unsigned integer in lower-case hex without leading zeros
+     * (matches String(value, HEX))
+     */
+    SensythingTextWriter& appendHex(uint32_t value);
+
+    /**
+     * Append a float with a fixed number of decimal places, exactly as
+     * printf("%.*f") prints it: the exact binary value rounded half to even,
+     * every digit of large values, a '-' whenever the sign bit is set (-0.0000,
+     * -nan) and "inf"/"nan" for the special values.
+     * @param value Value to format
+     * @param decimals Decimal places (0-9)
+     */
+    SensythingTextWriter& appendFixed(float value, uint8_t decimals);
+
+    const char* c_str() const { return buffer; }
+    size_t length() const { return used; }
+    bool overflowed() const { return overflow; }
+
+private:
+    char* buffer;
+    size_t capacity;      // Usable bytes (size - 1 for the NUL)
+    size_t used;
+    bool overflow;
+
+    SensythingTextWriter& appendBytes(const char* bytes, size_t count);
+};
+
+/**
+ * Check whether a board reports per-channel metadata worth a CSV column
+ * (the FDC1004 CAPDAC setting on Sensything Cap)
+ * @param config Board configuration
+ * @return true if metadata columns should be written
+ */
+inline bool sensythingHasMetadataColumns(const BoardConfig& config) {
+    return config.metadataColumns;
+}
+
+#endif // SENSYTHING_FORMAT_H
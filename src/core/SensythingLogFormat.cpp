@@ -0,0 +1,78 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Platform - Binary Log Format Implementation
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#include "SensythingLogFormat.h"
+#include "SensythingCRC.h"
+#include <string.h>
+
+// Copy a string into a fixed, NUL-padded field
+static void copyField(uint8_t* field, const char* text, size_t size) {
+    memset(field, 0, size);
+    if (text) {
+        strncpy((char*)field, text, size - 1);
+    }
+}
+
+size_t sensythingEncodeLogHeader(uint8_t* buffer, const BoardConfig& config, uint16_t syncRecords) {
+    uint8_t channelCount = config.channelCount;
+    if (channelCount > SENSYTHING_MAX_CHANNELS) {
+        channelCount = SENSYTHING_MAX_CHANNELS;
+    }
+
+    uint16_t headerSize = 44 + channelCount * (SENSYTHING_LOG_LABEL_SIZE + SENSYTHING_LOG_UNIT_SIZE) + 2;
+
+    size_t index = 0;
+    memcpy(&buffer[index], SENSYTHING_LOG_MAGIC, 4);
+    index += 4;
+    buffer[index++] = SENSYTHING_LOG_VERSION;
+    buffer[index++] = (uint8_t)config.boardType;
+    buffer[index++] = channelCount;
+    buffer[index++] = (uint8_t)sensythingLogRecordSize(channelCount);
+    memcpy(&buffer[index], &headerSize, 2);
+    index += 2;
+    memcpy(&buffer[index], &syncRecords, 2);
+    index += 2;
+
+    copyField(&buffer[index], config.boardName, SENSYTHING_LOG_NAME_SIZE);
+    index += SENSYTHING_LOG_NAME_SIZE;
+
+    for (uint8_t i = 0; i < channelCount; i++) {
+        copyField(&buffer[index], config.channels[i].label, SENSYTHING_LOG_LABEL_SIZE);
+        index += SENSYTHING_LOG_LABEL_SIZE;
+        copyField(&buffer[index], config.channels[i].unit, SENSYTHING_LOG_UNIT_SIZE);
+        index += SENSYTHING_LOG_UNIT_SIZE;
+    }
+
+    uint16_t crc = sensythingCRC16(buffer, index);
+    memcpy(&buffer[index], &crc, 2);
+    index += 2;
+
+    return index;
+}
+
+size_t sensythingEncodeLogRecord(uint8_t* buffer, const MeasurementData& data, uint8_t channelCount) {
+    size_t index = 0;
+    memcpy(&buffer[index], &data.timestamp, 4);
+    index += 4;
+    memcpy(&buffer[index], &data.measurement_count, 4);
+    index += 4;
+    memcpy(&buffer[index], data.channels, 4 * channelCount);
+    index += 4 * channelCount;
+    memcpy(&buffer[index], data.metadata, channelCount);
+    index += channelCount;
+    buffer[index++] = data.status_flags;
+    return index;
+}
+
+size_t sensythingEncodeLogSync(uint8_t* buffer, uint16_t recordCount, uint16_t crc) {
+    memcpy(&buffer[0], SENSYTHING_LOG_SYNC_MARKER, 4);
+    memcpy(&buffer[4], &recordCount, 2);
+    memcpy(&buffer[6], &crc, 2);
+    return SENSYTHING_LOG_SYNC_SIZE;
+}
@@ -0,0 +1,93 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Platform - Binary Log Format
+//    Self-describing fixed-record log written by SensythingSDCard
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SENSYTHING_LOG_FORMAT_H
+#define SENSYTHING_LOG_FORMAT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "SensythingTypes.h"
+
+// File layout (little-endian):
+//
+// Header
+//   [0]    char[4]  magic "STLG"
+//   [4]    uint8    format version (SENSYTHING_LOG_VERSION)
+//   [5]    uint8    board type (SensythingBoardType)
+//   [6]    uint8    channel count N
+//   [7]    uint8    record size R (bytes)
+//   [8]    uint16   header size H (bytes, including the CRC)
+//   [10]   uint16   records per sync block
+//   [12]   char[32] board name (NUL padded)
+//   [44]   N x { char[32] label, char[16] unit }
+//   [H-2]  uint16   CRC-16/CCITT-FALSE over bytes 0 .. H-3
+//
+// Record (R = 9 + 5N bytes)
+//   uint32   timestamp (ms)
+//   uint32   measurement count
+//   float32  channels[N]
+//   uint8    metadata[N]
+//   uint8    status flags
+//
+// Sync trailer, after every block of up to "records per sync block" records
+// and before every file sync, so everything on the card can be verified:
+//   char[4]  marker "SYNC"
+//   uint16   number of records in the block
+//   uint16   CRC-16/CCITT-FALSE over those records
+//
+// A reader that finds a bad CRC or a truncated tail scans forward for the next
+// marker whose count and CRC check out.
+
+#define SENSYTHING_LOG_MAGIC "STLG"
+#define SENSYTHING_LOG_VERSION 1
+#define SENSYTHING_LOG_NAME_SIZE 32
+#define SENSYTHING_LOG_LABEL_SIZE 32
+#define SENSYTHING_LOG_UNIT_SIZE 16
+#define SENSYTHING_LOG_SYNC_MARKER "SYNC"
+#define SENSYTHING_LOG_SYNC_SIZE 8
+#define SENSYTHING_LOG_HEADER_MAX_SIZE (44 + SENSYTHING_MAX_CHANNELS * \
+    (SENSYTHING_LOG_LABEL_SIZE + SENSYTHING_LOG_UNIT_SIZE) + 2)
+#define SENSYTHING_LOG_RECORD_MAX_SIZE (9 + 5 * SENSYTHING_MAX_CHANNELS)
+
+/**
+ * Size of one record for a channel count
+ */
+inline size_t sensythingLogRecordSize(uint8_t channelCount) {
+    return 9 + 5 * (size_t)channelCount;
+}
+
+/**
+ * Encode the file header from the board configuration
+ * @param buffer Output (at least SENSYTHING_LOG_HEADER_MAX_SIZE bytes)
+ * @param config Board configuration (name, channel labels and units)
+ * @param syncRecords Records per sync block
+ * @return Header size in bytes
+ */
+size_t sensythingEncodeLogHeader(uint8_t* buffer, const BoardConfig& config, uint16_t syncRecords);
+
+/**
+ * Encode one record
+ * @param buffer Output (at least SENSYTHING_LOG_RECORD_MAX_SIZE bytes)
+ * @param data Measurement to encode
+ * @param channelCount Channels per record (from the header)
+ * @return Record size in bytes
+ */
+size_t sensythingEncodeLogRecord(uint8_t* buffer, const MeasurementData& data, uint8_t channelCount);
+
+/**
+ * Encode a sync trailer
+ * @param buffer Output (at least SENSYTHING_LOG_SYNC_SIZE bytes)
+ * @param recordCount Records in the block
+ * @param crc CRC-16 over the block's records
+ * @return Trailer size in bytes
+ */
+size_t sensythingEncodeLogSync(uint8_t* buffer, uint16_t recordCount, uint16_t crc);
+
+#endif // SENSYTHING_LOG_FORMAT_H
@@ -0,0 +1,88 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Platform - Stage Latency Probes Implementation
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#include "SensythingPerf.h"
+
+static const char* const PERF_STAGE_NAMES[SENSYTHING_PERF_STAGE_COUNT] = {
+    "loop", "commands", "wifi_update", "read", "filter", "usb", "ble", "wifi", "sd"
+};
+
+SensythingPerf::SensythingPerf() {
+    reset();
+}
+
+void SensythingPerf::reset() {
+    memset(stages, 0, sizeof(stages));
+    for (uint8_t i = 0; i < SENSYTHING_PERF_STAGE_COUNT; i++) {
+        stages[i].minCycles = UINT32_MAX;
+    }
+    resetMs = millis();
+}
+
+const char* SensythingPerf::getStageName(SensythingPerfStageId stage) {
+    return stage < SENSYTHING_PERF_STAGE_COUNT ? PERF_STAGE_NAMES[stage] : "unknown";
+}
+
+uint32_t SensythingPerf::bucketUpperBound(uint32_t index) {
+    if (index < 2 * SENSYTHING_PERF_SUB_BUCKETS) {
+        return index;
+    }
+    uint32_t k = index - 2 * SENSYTHING_PERF_SUB_BUCKETS;
+    uint32_t shift = k / SENSYTHING_PERF_SUB_BUCKETS + 1;
+    uint64_t lower = (uint64_t)(SENSYTHING_PERF_SUB_BUCKETS + k % SENSYTHING_PERF_SUB_BUCKETS) << shift;
+    uint64_t upper = lower + (1ull << shift) - 1;
+    return upper > UINT32_MAX ? UINT32_MAX : (uint32_t)upper;
+}
+
+uint32_t SensythingPerf::getPercentileCycles(SensythingPerfStageId stage, uint8_t percent) const {
+    const SensythingPerfStage& s = stages[stage];
+    if (s.count == 0) {
+        return 0;
+    }
+
+    // Rank of the percentile sample, rounded up so p99 of 100 samples is the 99th
+    uint64_t rank = ((uint64_t)s.count * percent + 99) / 100;
+    if (rank == 0) {
+        rank = 1;
+    }
+
+    uint64_t seen = 0;
+    for (uint32_t i = 0; i < SENSYTHING_PERF_BUCKETS; i++) {
+        seen += s.buckets[i];
+        if (seen >= rank) {
+            // The bucket bound can overshoot the largest value actually seen
+            uint32_t bound = bucketUpperBound(i);
+            return bound < s.maxCycles ? bound : s.maxCycles;
+        }
+    }
+    return s.maxCycles;
+}
+
+void SensythingPerf::print() {
+    float cyclesPerUs = (float)ESP.getCpuFreqMHz();
+
+    Serial.println("=================================");
+    Serial.printf("%s STAGE TIMING (us, last %lu s)\n", EMOJI_TIME, (millis() - resetMs) / 1000);
+    Serial.println("=================================");
+    Serial.println("stage            count       min      mean       p99       max");
+    for (uint8_t i = 0; i < SENSYTHING_PERF_STAGE_COUNT; i++) {
+        SensythingPerfStageId id = (SensythingPerfStageId)i;
+        const SensythingPerfStage& s = stages[i];
+        if (s.count == 0) {
+            Serial.printf("%-12s %9u         -         -         -         -\n", getStageName(id), 0u);
+            continue;
+        }
+        Serial.printf("%-12s %9u %9.1f %9.1f %9.1f %9.1f\n", getStageName(id), s.count,
+                     s.minCycles / cyclesPerUs,
+                     (float)(s.totalCycles / s.count) / cyclesPerUs,
+                     getPercentileCycles(id, 99) / cyclesPerUs,
+                     s.maxCycles / cyclesPerUs);
+    }
+    Serial.println("=================================");
+}
@@ -0,0 +1,120 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Platform - Stage Latency Probes
+//    Cycle-counter timing of the update() stages with fixed-size histograms
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SENSYTHING_PERF_H
+#define SENSYTHING_PERF_H
+
+#include <Arduino.h>
+#include "SensythingConfig.h"
+
+/**
+ * Probed stages of the main loop
+ */
+enum SensythingPerfStageId {
+    SENSYTHING_PERF_LOOP = 0,                    // Whole update() call
+    SENSYTHING_PERF_COMMANDS,                    // processSerialCommands()
+    SENSYTHING_PERF_WIFI_UPDATE,                 // wifiModule->update()
+    SENSYTHING_PERF_READ,                        // readMeasurement() that returned a sample
+    SENSYTHING_PERF_FILTER,                      // Streaming filters (when any are configured)
+    SENSYTHING_PERF_USB,                         // USB sink
+    SENSYTHING_PERF_BLE,                         // BLE sink
+    SENSYTHING_PERF_WIFI,                        // WebSocket sink
+    SENSYTHING_PERF_SD,                          // SD sink, including file rotation
+    SENSYTHING_PERF_STAGE_COUNT
+};
+
+// Values below 2 * sub-buckets get one bucket each; above that every power of
+// two is split into (1 << SENSYTHING_PERF_SUB_BUCKET_BITS) buckets
+#define SENSYTHING_PERF_SUB_BUCKETS (1u << SENSYTHING_PERF_SUB_BUCKET_BITS)
+#define SENSYTHING_PERF_BUCKETS ((33 - SENSYTHING_PERF_SUB_BUCKET_BITS) * SENSYTHING_PERF_SUB_BUCKETS)
+
+typedef struct {
+    uint32_t count;
+    uint32_t minCycles;
+    uint32_t maxCycles;
+    uint64_t totalCycles;
+    uint32_t buckets[SENSYTHING_PERF_BUCKETS];  // Log-linear histogram of cycle counts
+} SensythingPerfStage;
+
+/**
+ * Per-stage latency statistics (min/max/mean/p99) in fixed storage.
+ *
+ * record() is a handful of instructions and never allocates, so it can sit in
+ * the sample path. Each stage must only be recorded from one task at a time;
+ * printing while a stage is being recorded may show a slightly torn sample,
+ * which is acceptable for diagnostics.
+ */
+class SensythingPerf {
+public:
+    SensythingPerf();
+
+    /**
+     * Add one measurement to a stage
+     * @param stage Stage to record into
+     * @param cycles Elapsed CPU cycles
+     */
+    inline void record(SensythingPerfStageId stage, uint32_t cycles) {
+        SensythingPerfStage& s = stages[stage];
+        s.count++;
+        s.totalCycles += cycles;
+        if (cycles < s.minCycles) s.minCycles = cycles;
+        if (cycles > s.maxCycles) s.maxCycles = cycles;
+        s.buckets[bucketIndex(cycles)]++;
+    }
+
+    /**
+     * Clear all stages
+     */
+    void reset();
+
+    /**
+     * Print the per-stage table in microseconds
+     */
+    void print();
+
+    /**
+     * Get a stage's percentile from its histogram
+     * @param stage Stage to query
+     * @param percent Percentile (e.g. 99)
+     * @return Upper bound of the bucket holding the percentile, in cycles (0 if empty)
+     */
+    uint32_t getPercentileCycles(SensythingPerfStageId stage, uint8_t percent) const;
+
+    const SensythingPerfStage& getStage(SensythingPerfStageId stage) const { return stages[stage]; }
+
+    static const char* getStageName(SensythingPerfStageId stage);
+
+private:
+    SensythingPerfStage stages[SENSYTHING_PERF_STAGE_COUNT];
+    unsigned long resetMs;
+
+    static inline uint32_t bucketIndex(uint32_t cycles) {
+        if (cycles < 2 * SENSYTHING_PERF_SUB_BUCKETS) {
+            return cycles;
+        }
+        uint32_t msb = 31 - __builtin_clz(cycles);
+        uint32_t sub = (cycles >> (msb - SENSYTHING_PERF_SUB_BUCKET_BITS)) & (SENSYTHING_PERF_SUB_BUCKETS - 1);
+        return 2 * SENSYTHING_PERF_SUB_BUCKETS +
+               (msb - SENSYTHING_PERF_SUB_BUCKET_BITS - 1) * SENSYTHING_PERF_SUB_BUCKETS + sub;
+    }
+
+    static uint32_t bucketUpperBound(uint32_t index);
+};
+
+// Probes for SensythingCore members; compiled out entirely when SENSYTHING_PERF is 0
+#if SENSYTHING_PERF
+#define SENSYTHING_PERF_BEGIN(name) uint32_t perfStart_##name = ESP.getCycleCount()
+#define SENSYTHING_PERF_END(name) perf.record(SENSYTHING_PERF_##name, ESP.getCycleCount() - perfStart_##name)
+#else
+#define SENSYTHING_PERF_BEGIN(name)
+#define SENSYTHING_PERF_END(name)
+#endif
+
+#endif // SENSYTHING_PERF_H
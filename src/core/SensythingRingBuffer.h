@@ -0,0 +1,96 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Platform - Sample Ring Buffer
+//    Fixed-capacity lock-free single-producer/single-consumer queue
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SENSYTHING_RING_BUFFER_H
+#define SENSYTHING_RING_BUFFER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+/**
+ * Lock-free single-producer/single-consumer ring buffer.
+ *
+ * One context (the acquisition side) may call push(), and one other context
+ * (the streaming side) may call pop()/peek(). No locks are taken, so push()
+ * never waits on a slow consumer: when the ring is full the sample is
+ * rejected and the caller decides how to account for it.
+ *
+ * @tparam T        Element type (copied by value, e.g. MeasurementData)
+ * @tparam Capacity Number of slots, must be a power of two
+ */
+template <typename T, size_t Capacity>
+class SensythingRingBuffer {
+    static_assert(Capacity >= 2, "Ring capacity must be at least 2");
+    static_assert((Capacity & (Capacity - 1)) == 0, "Ring capacity must be a power of two");
+
+public:
+    SensythingRingBuffer() : head(0), tail(0) {}
+
+    /**
+     * Append an element (producer side only)
+     * @param item Element to copy into the ring
+     * @return true if stored, false if the ring is full
+     */
+    bool push(const T& item) {
+        const uint32_t h = head.load(std::memory_order_relaxed);
+        const uint32_t t = tail.load(std::memory_order_acquire);
+        if (h - t >= Capacity) {
+            return false;
+        }
+        slots[h & (Capacity - 1)] = item;
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Remove the oldest element (consumer side only)
+     * @param item Receives the element
+     * @return true if an element was available
+     */
+    bool pop(T& item) {
+        const uint32_t t = tail.load(std::memory_order_relaxed);
+        const uint32_t h = head.load(std::memory_order_acquire);
+        if (h == t) {
+            return false;
+        }
+        item = slots[t & (Capacity - 1)];
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Discard all queued elements (consumer side only)
+     */
+    void clear() {
+        tail.store(head.load(std::memory_order_acquire), std::memory_order_release);
+    }
+
+    /**
+     * Number of queued elements (approximate when called concurrently)
+     */
+    size_t size() const {
+        return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+    }
+
+    bool isEmpty() const { return size() == 0; }
+    bool isFull() const { return size() >= Capacity; }
+    static constexpr size_t capacity() { return Capacity; }
+
+private:
+    T slots[Capacity];
+
+    // Free-running indices; only the low bits address a slot. Unsigned
+    // wrap-around keeps (head - tail) correct across overflow.
+    std::atomic<uint32_t> head;   // Written by producer
+    std::atomic<uint32_t> tail;   // Written by consumer
+};
+
+#endif // SENSYTHING_RING_BUFFER_H
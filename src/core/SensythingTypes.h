@@ -52,6 +52,25 @@ enum SensythingInterface {
     INTERFACE_ALL     = 0x0F
 };
 
+// Sink index for per-interface statistics and settings
+enum SensythingSink {
+    SENSYTHING_SINK_USB = 0,
+    SENSYTHING_SINK_BLE,
+    SENSYTHING_SINK_WIFI,
+    SENSYTHING_SINK_SD,
+    SENSYTHING_SINK_COUNT
+};
+
+/**
+ * Get a sink's short name, as used by commands and metrics labels
+ * @param sink Sink index
+ * @return "usb", "ble", "wifi" or "sd"
+ */
+inline const char* sensythingSinkName(SensythingSink sink) {
+    static const char* const names[SENSYTHING_SINK_COUNT] = {"usb", "ble", "wifi", "sd"};
+    return sink < SENSYTHING_SINK_COUNT ? names[sink] : "unknown";
+}
+
 // =================================================================================================
 // STATUS FLAGS
 // =================================================================================================
@@ -81,6 +100,7 @@ typedef struct {
     uint32_t measurement_count;                  // Sequential measurement number
     uint8_t channel_count;                       // Number of active channels
     uint8_t status_flags;                        // Status bits (see SENSYTHING_STATUS_* defines)
+    uint32_t channel_time_us[SENSYTHING_MAX_CHANNELS];  // Per-channel conversion time (esp_timer, low 32 bits; 0 = not recorded)
 } MeasurementData;
 
 // =================================================================================================
@@ -90,19 +110,24 @@ typedef struct {
 typedef struct {
     // Timing control
     unsigned long sampleInterval;                // Sample interval in milliseconds
-    unsigned long lastMeasurement;               // Timestamp of last measurement
+    unsigned long lastMeasurement;               // micros() of the last sensor read
+    uint8_t oversampleRatio;                     // Sensor reads averaged into each output sample
     unsigned long lastStatusUpdate;              // Timestamp of last status update
     unsigned long lastFileRotation;              // Timestamp of last SD file rotation
     
     // Measurement control
     bool measurementActive;                      // Master enable/disable
     uint32_t measurementCount;                   // Total measurements taken
+    uint32_t samplesAcquired;                    // Samples read since boot (reset_count keeps it)
+    uint32_t droppedSamples;                     // Samples lost because the sample ring was full
+    uint32_t queuePeak;                          // Most samples waiting in the ring at once
     
     // Communication interface flags
     bool usbStreamingEnabled;                    // USB Serial streaming
     bool bleStreamingEnabled;                    // BLE streaming
     bool wifiStreamingEnabled;                   // WiFi streaming
     bool sdLoggingEnabled;                       // SD card logging
+    uint8_t sinkRateDivisor[SENSYTHING_SINK_COUNT];  // Each sink gets the average of every N samples
     
     // Connection status
     bool bleConnected;                           // BLE client connected
@@ -115,25 +140,103 @@ typedef struct {
     
 } SystemState;
 
+// =================================================================================================
+// ACQUISITION STATISTICS (threaded acquisition mode)
+// =================================================================================================
+
+typedef struct {
+    uint32_t samplesAcquired;                    // Samples read by the acquisition task
+    uint32_t timerTicks;                         // Timer periods measured for jitter
+    uint32_t timerOverruns;                      // Timer ticks missed because a read ran long
+    uint32_t intervalUs;                         // Programmed timer period
+    uint32_t lastJitterUs;                       // |actual - programmed| period of the last tick
+    uint32_t maxJitterUs;                        // Worst period deviation since stats reset
+    uint64_t totalJitterUs;                      // Sum of deviations (mean = total / timerTicks)
+} AcquisitionStats;
+
+// =================================================================================================
+// SD CARD WRITER STATISTICS
+// =================================================================================================
+
+#define SENSYTHING_SD_LATENCY_BUCKETS 8          // <1, <2, <5, <10, <20, <50, <100, >=100 ms
+
+typedef struct {
+    uint32_t buffersWritten;                     // Write buffers handed to the card
+    uint32_t bytesWritten;                       // Bytes written to the current and previous files
+    uint32_t syncs;                              // File syncs (directory/FAT updates)
+    uint32_t overruns;                           // Lines dropped because both buffers were busy
+    uint32_t lastLatencyUs;                      // Duration of the last buffer write
+    uint32_t maxLatencyUs;                       // Slowest buffer write since stats reset
+    uint64_t totalLatencyUs;                     // Sum of buffer write durations
+    uint32_t latencyHistogram[SENSYTHING_SD_LATENCY_BUCKETS];  // Buffer writes per latency bucket
+} SDWriterStats;
+
+// =================================================================================================
+// SINK AND LOOP STATISTICS
+// =================================================================================================
+
+typedef struct {
+    uint32_t samplesDelivered;                   // Samples handed to the interface
+    uint32_t samplesDropped;                     // Samples accepted for sending but lost (full buffers, failed sends)
+    uint64_t bytesSent;                          // Payload bytes handed to the interface
+} SinkStats;
+
+typedef struct {
+    uint32_t count;                              // update() calls
+    uint64_t totalUs;                            // Time spent in update()
+    uint32_t windowMaxUs;                        // Slowest update() in the current window
+    uint32_t lastWindowMaxUs;                    // Slowest update() in the previous window
+    unsigned long windowStartMs;
+} LoopStats;
+
+// =================================================================================================
+// METRICS SNAPSHOT (exported by /api/metrics)
+// =================================================================================================
+
+typedef struct {
+    uint32_t uptimeSeconds;
+    uint32_t samplesAcquired;                    // Since boot
+    uint32_t samplesDropped;                     // Lost before reaching the sinks (sample ring full)
+    uint32_t queuePeak;                          // Most samples waiting in the sample ring at once
+    uint8_t activeInterfaces;                    // Bitmask of SensythingInterface
+    SinkStats sinks[SENSYTHING_SINK_COUNT];      // Zero for sinks that are not initialized
+    uint8_t wsClients;
+    SDWriterStats sdWriter;
+    uint32_t heapFree;
+    uint32_t heapMinFree;                        // Lowest free heap since boot
+    uint32_t heapLargestBlock;                   // Largest allocatable block
+    uint32_t psramSize;                          // 0 when no PSRAM is fitted
+    uint32_t psramFree;
+    uint32_t loopCount;
+    uint64_t loopTotalUs;
+    uint32_t loopMaxUs;                          // Slowest update() over the last one to two windows
+} SensythingMetrics;
+
 // =================================================================================================
 // SYSTEM STATUS STRUCTURE (for reporting)
 // =================================================================================================
 
 typedef struct {
     SensythingBoardType boardType;               // Board type identifier
-    String boardName;                            // Human-readable board name
-    String sensorType;                           // Sensor description
-    String firmwareVersion;                      // Firmware version string
+    const char* boardName;                       // Human-readable board name
+    const char* sensorType;                      // Sensor description
+    const char* firmwareVersion;                 // Firmware version string
     
     unsigned long uptimeSeconds;                 // System uptime
     float sampleRateHz;                          // Current sample rate
     uint32_t totalMeasurements;                  // Total measurements
+    uint32_t droppedSamples;                     // Samples dropped before reaching the sinks
     
     uint8_t activeInterfaces;                    // Bitmask of active interfaces
     bool bleConnected;
     bool wifiConnected;
     bool sdCardReady;
     
+    uint16_t bleMTU;                             // Negotiated ATT MTU (0 if BLE not initialized)
+    uint32_t bleConnIntervalUs;                  // Connection interval (0 until reported)
+    uint8_t blePHY;                              // Transmit PHY: 1 = LE 1M, 2 = LE 2M
+    float bleNotificationsPerSec;                // Achieved notification rate
+    
     String currentSDFile;                        // Current log file name
     uint32_t sdFileSize;                         // Current file size in bytes
 } SystemStatus;
@@ -154,12 +257,16 @@ typedef struct {
 // BOARD CONFIGURATION STRUCTURE
 // =================================================================================================
 
+// Boards describe themselves with a constant table (see the board .cpp files);
+// names and channel descriptions point at static storage so the sinks can hold
+// the configuration by reference without copying it or touching the heap.
 typedef struct {
     SensythingBoardType boardType;
-    String boardName;
-    String sensorType;
+    const char* boardName;                       // Static string, e.g. "Sensything Cap"
+    const char* sensorType;                      // Static string, e.g. "FDC1004 Capacitance"
     uint8_t channelCount;
-    ChannelInfo channels[SENSYTHING_MAX_CHANNELS];
+    const ChannelInfo* channels;                 // channelCount entries
+    bool metadataColumns;                        // Metadata (CAPDAC) is written as CSV columns
     
     // Pin configuration (board-specific)
     int8_t i2c_sda;
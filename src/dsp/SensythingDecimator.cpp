@@ -0,0 +1,75 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Platform - Oversampling Decimator Implementation
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#include "SensythingDecimator.h"
+
+#define CHANNEL_FAIL_MASK (SENSYTHING_STATUS_CH0_FAIL | SENSYTHING_STATUS_CH1_FAIL | \
+                           SENSYTHING_STATUS_CH2_FAIL | SENSYTHING_STATUS_CH3_FAIL)
+
+SensythingDecimator::SensythingDecimator() {
+    ratio = 1;
+    reset();
+}
+
+void SensythingDecimator::setRatio(uint8_t newRatio) {
+    ratio = newRatio > 0 ? newRatio : 1;
+    reset();
+}
+
+void SensythingDecimator::reset() {
+    count = 0;
+    memset(offset, 0, sizeof(offset));
+    memset(sum, 0, sizeof(sum));
+    memset(valid, 0, sizeof(valid));
+    firstTimestamp = 0;
+    statusFlags = 0;
+}
+
+bool SensythingDecimator::push(MeasurementData& data) {
+    if (ratio <= 1) {
+        return true;
+    }
+
+    uint8_t channels = data.channel_count < SENSYTHING_MAX_CHANNELS ? data.channel_count : SENSYTHING_MAX_CHANNELS;
+    if (count == 0) {
+        firstTimestamp = data.timestamp;
+    }
+
+    for (uint8_t i = 0; i < channels; i++) {
+        if (data.status_flags & (1 << i)) {
+            continue;  // Failed read of this channel
+        }
+        if (valid[i] == 0) {
+            offset[i] = data.channels[i];
+        }
+        sum[i] += data.channels[i] - offset[i];
+        valid[i]++;
+    }
+    statusFlags |= data.status_flags & ~CHANNEL_FAIL_MASK;
+
+    if (++count < ratio) {
+        return false;
+    }
+
+    // Block complete: the last read's metadata and channel times are kept
+    uint8_t flags = statusFlags;
+    for (uint8_t i = 0; i < channels; i++) {
+        if (valid[i] > 0) {
+            data.channels[i] = offset[i] + sum[i] / valid[i];
+        } else {
+            data.channels[i] = 0.0f;
+            flags |= (1 << i);
+        }
+    }
+    data.timestamp = firstTimestamp + (data.timestamp - firstTimestamp) / 2;
+    data.status_flags = flags;
+
+    reset();
+    return true;
+}
@@ -0,0 +1,65 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Platform - Oversampling Decimator
+//    Boxcar-averages N sensor reads into one output sample
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SENSYTHING_DECIMATOR_H
+#define SENSYTHING_DECIMATOR_H
+
+#include <Arduino.h>
+#include "../core/SensythingTypes.h"
+#include "../core/SensythingConfig.h"
+
+/**
+ * Boxcar (first-order CIC) decimator.
+ *
+ * Every `ratio` samples are averaged per channel into one output, which for
+ * white noise lowers the noise by sqrt(ratio). Channels whose CHn_FAIL bit is
+ * set are left out of their average; a channel that failed on every read of
+ * the block keeps the fail bit. The output timestamp is the middle of the
+ * block, matching the boxcar's group delay.
+ *
+ * Each channel accumulates its deviation from the block's first value, so
+ * large raw readings (e.g. 22-bit AFE4400 counts) keep their resolution in a
+ * single-precision sum.
+ */
+class SensythingDecimator {
+public:
+    SensythingDecimator();
+
+    /**
+     * Change the decimation ratio and drop any partial block
+     * @param ratio Reads per output sample (1 = pass through)
+     */
+    void setRatio(uint8_t ratio);
+
+    uint8_t getRatio() const { return ratio; }
+
+    /**
+     * Add one read to the current block
+     * @param data Read to add; replaced by the block average when the block completes
+     * @return true if data now holds an output sample
+     */
+    bool push(MeasurementData& data);
+
+    /**
+     * Drop any partial block
+     */
+    void reset();
+
+private:
+    uint8_t ratio;
+    uint8_t count;
+    float offset[SENSYTHING_MAX_CHANNELS];       // First valid value of the block
+    float sum[SENSYTHING_MAX_CHANNELS];          // Sum of deviations from offset
+    uint8_t valid[SENSYTHING_MAX_CHANNELS];      // Reads that did not fail
+    uint32_t firstTimestamp;
+    uint8_t statusFlags;                         // OR of the block's non-channel flags
+};
+
+#endif // SENSYTHING_DECIMATOR_H
@@ -0,0 +1,287 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Platform - Streaming Filters Implementation
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#include "SensythingFilter.h"
+#include <math.h>
+
+// =================================================================================================
+// FILTER CHAIN
+// =================================================================================================
+
+SensythingFilterChain::SensythingFilterChain() {
+    stageCount = 0;
+    sampleRateHz = 1000.0f / SENSYTHING_DEFAULT_SAMPLE_INTERVAL_MS;
+}
+
+bool SensythingFilterChain::addBandPass(float lowHz, float highHz) {
+    if (lowHz <= 0.0f || highHz <= lowHz) {
+        return false;
+    }
+    return addStage(SENSYTHING_FILTER_BANDPASS, lowHz, highHz);
+}
+
+bool SensythingFilterChain::addNotch(float hz) {
+    if (hz <= 0.0f) {
+        return false;
+    }
+    return addStage(SENSYTHING_FILTER_NOTCH, hz, 0.0f);
+}
+
+bool SensythingFilterChain::addMovingAverage(uint8_t length) {
+    if (length < 2 || length > SENSYTHING_FILTER_MA_MAX_LENGTH) {
+        return false;
+    }
+    return addStage(SENSYTHING_FILTER_MOVING_AVERAGE, length, 0.0f);
+}
+
+bool SensythingFilterChain::addDCBlock(float cutoffHz) {
+    if (cutoffHz <= 0.0f) {
+        return false;
+    }
+    return addStage(SENSYTHING_FILTER_DC_BLOCK, cutoffHz, 0.0f);
+}
+
+bool SensythingFilterChain::addStage(SensythingFilterType type, float param1, float param2) {
+    if (stageCount >= SENSYTHING_FILTER_MAX_STAGES) {
+        return false;
+    }
+    SensythingFilterStage& stage = stages[stageCount];
+    stage.type = type;
+    stage.param1 = param1;
+    stage.param2 = param2;
+    design(stage);
+    if (!stage.active) {
+        return false;  // Not usable at the current sample rate
+    }
+    stageCount++;
+    return true;
+}
+
+void SensythingFilterChain::clear() {
+    stageCount = 0;
+}
+
+void SensythingFilterChain::setSampleRate(float hz) {
+    sampleRateHz = hz;
+    for (uint8_t i = 0; i < stageCount; i++) {
+        design(stages[i]);
+    }
+}
+
+void SensythingFilterChain::resetState(SensythingFilterStage& stage) {
+    stage.z1 = 0.0f;
+    stage.z2 = 0.0f;
+    stage.sum = 0.0f;
+    stage.index = 0;
+    stage.filled = 0;
+}
+
+void SensythingFilterChain::design(SensythingFilterStage& stage) {
+    resetState(stage);
+    stage.b0 = 1.0f;
+    stage.b1 = stage.b2 = stage.a1 = stage.a2 = 0.0f;
+
+    float nyquist = sampleRateHz / 2.0f;
+    switch (stage.type) {
+        case SENSYTHING_FILTER_BANDPASS: {
+            // RBJ cookbook band-pass (0 dB peak) centred on the geometric mean
+            stage.active = stage.param2 < nyquist;
+            if (!stage.active) break;
+            float center = sqrtf(stage.param1 * stage.param2);
+            float q = center / (stage.param2 - stage.param1);
+            float w0 = 2.0f * (float)M_PI * center / sampleRateHz;
+            float alpha = sinf(w0) / (2.0f * q);
+            float a0 = 1.0f + alpha;
+            stage.b0 = alpha / a0;
+            stage.b1 = 0.0f;
+            stage.b2 = -alpha / a0;
+            stage.a1 = -2.0f * cosf(w0) / a0;
+            stage.a2 = (1.0f - alpha) / a0;
+            break;
+        }
+
+        case SENSYTHING_FILTER_NOTCH: {
+            stage.active = stage.param1 < nyquist;
+            if (!stage.active) break;
+            float w0 = 2.0f * (float)M_PI * stage.param1 / sampleRateHz;
+            float alpha = sinf(w0) / (2.0f * SENSYTHING_FILTER_NOTCH_Q);
+            float a0 = 1.0f + alpha;
+            stage.b0 = 1.0f / a0;
+            stage.b1 = -2.0f * cosf(w0) / a0;
+            stage.b2 = 1.0f / a0;
+            stage.a1 = stage.b1;
+            stage.a2 = (1.0f - alpha) / a0;
+            break;
+        }
+
+        case SENSYTHING_FILTER_MOVING_AVERAGE:
+            stage.active = true;
+            break;
+
+        case SENSYTHING_FILTER_DC_BLOCK:
+            // y[n] = x[n] - x[n-1] + R * y[n-1]
+            stage.active = stage.param1 < nyquist;
+            stage.b0 = expf(-2.0f * (float)M_PI * stage.param1 / sampleRateHz);
+            break;
+    }
+}
+
+float SensythingFilterChain::process(float x) {
+    for (uint8_t i = 0; i < stageCount; i++) {
+        SensythingFilterStage& s = stages[i];
+        if (!s.active) {
+            continue;
+        }
+
+        switch (s.type) {
+            case SENSYTHING_FILTER_BANDPASS:
+            case SENSYTHING_FILTER_NOTCH: {
+                float y = s.b0 * x + s.z1;
+                s.z1 = s.b1 * x - s.a1 * y + s.z2;
+                s.z2 = s.b2 * x - s.a2 * y;
+                x = y;
+                break;
+            }
+
+            case SENSYTHING_FILTER_MOVING_AVERAGE: {
+                uint8_t length = (uint8_t)s.param1;
+                if (s.filled < length) {
+                    s.filled++;
+                } else {
+                    s.sum -= s.window[s.index];
+                }
+                s.window[s.index] = x;
+                s.sum += x;
+                if (++s.index == length) {
+                    // Re-sum once per window so float rounding cannot accumulate
+                    s.index = 0;
+                    float sum = 0.0f;
+                    for (uint8_t k = 0; k < length; k++) {
+                        sum += s.window[k];
+                    }
+                    s.sum = sum;
+                }
+                x = s.sum / s.filled;
+                break;
+            }
+
+            case SENSYTHING_FILTER_DC_BLOCK: {
+                // z1 = previous input, z2 = previous output; start settled on the first sample
+                if (s.filled == 0) {
+                    s.z1 = x;
+                    s.filled = 1;
+                }
+                float y = x - s.z1 + s.b0 * s.z2;
+                s.z1 = x;
+                s.z2 = y;
+                x = y;
+                break;
+            }
+        }
+    }
+    return x;
+}
+
+void SensythingFilterChain::print() const {
+    if (stageCount == 0) {
+        Serial.print("raw");
+        return;
+    }
+    for (uint8_t i = 0; i < stageCount; i++) {
+        const SensythingFilterStage& s = stages[i];
+        if (i > 0) {
+            Serial.print(" -> ");
+        }
+        switch (s.type) {
+            case SENSYTHING_FILTER_BANDPASS:
+                Serial.printf("bandpass %.2f-%.2f Hz", s.param1, s.param2);
+                break;
+            case SENSYTHING_FILTER_NOTCH:
+                Serial.printf("notch %.2f Hz", s.param1);
+                break;
+            case SENSYTHING_FILTER_MOVING_AVERAGE:
+                Serial.printf("average %u", (unsigned)s.param1);
+                break;
+            case SENSYTHING_FILTER_DC_BLOCK:
+                Serial.printf("dc %.2f Hz", s.param1);
+                break;
+        }
+        if (!s.active) {
+            Serial.print(" (bypassed: above Nyquist)");
+        }
+    }
+}
+
+// =================================================================================================
+// FILTER BANK
+// =================================================================================================
+
+SensythingFilterBank::SensythingFilterBank() {
+    active = false;
+    totalCycles = 0;
+    samples = 0;
+}
+
+void SensythingFilterBank::process(MeasurementData& data) {
+    uint32_t start = ESP.getCycleCount();
+    uint8_t count = data.channel_count < SENSYTHING_MAX_CHANNELS ? data.channel_count : SENSYTHING_MAX_CHANNELS;
+    for (uint8_t i = 0; i < count; i++) {
+        // A failed read carries a placeholder 0.0; feeding it in would ring
+        // through the chain, so the state is held and the flag passes through
+        if (data.status_flags & (1 << i)) {
+            continue;
+        }
+        if (chains[i].getStageCount() > 0) {
+            data.channels[i] = chains[i].process(data.channels[i]);
+        }
+    }
+    totalCycles += ESP.getCycleCount() - start;
+    samples++;
+}
+
+void SensythingFilterBank::setSampleRate(float hz) {
+    for (uint8_t i = 0; i < SENSYTHING_MAX_CHANNELS; i++) {
+        chains[i].setSampleRate(hz);
+    }
+    refresh();
+}
+
+void SensythingFilterBank::clear() {
+    for (uint8_t i = 0; i < SENSYTHING_MAX_CHANNELS; i++) {
+        chains[i].clear();
+    }
+    refresh();
+}
+
+void SensythingFilterBank::refresh() {
+    active = false;
+    for (uint8_t i = 0; i < SENSYTHING_MAX_CHANNELS; i++) {
+        if (chains[i].getStageCount() > 0) {
+            active = true;
+        }
+    }
+    totalCycles = 0;
+    samples = 0;
+}
+
+uint32_t SensythingFilterBank::getCyclesPerSample() const {
+    return samples ? (uint32_t)(totalCycles / samples) : 0;
+}
+
+void SensythingFilterBank::print(const BoardConfig& config) const {
+    for (uint8_t i = 0; i < config.channelCount && i < SENSYTHING_MAX_CHANNELS; i++) {
+        Serial.printf("%s ch%u %-12s ", EMOJI_CONFIG, i, config.channels[i].label);
+        chains[i].print();
+        Serial.println();
+    }
+    if (samples > 0) {
+        Serial.printf("%s Filter cost: %u cycles (%.2f us) per sample\n", EMOJI_TIME,
+                     getCyclesPerSample(), (float)getCyclesPerSample() / ESP.getCpuFreqMHz());
+    }
+}
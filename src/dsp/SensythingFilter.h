@@ -0,0 +1,180 @@
+//////////////////////////////////////////////////////////////////////////////////////////
+//    (c) 2025 Protocentral Electronics
+//
+//    Sensything Platform - Streaming Filters
+//    Per-channel filter chains applied between acquisition and the sinks
+//
+//    This software is licensed under the MIT License(http://opensource.org/licenses/MIT).
+//
+//////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SENSYTHING_FILTER_H
+#define SENSYTHING_FILTER_H
+
+#include <Arduino.h>
+#include "../core/SensythingTypes.h"
+#include "../core/SensythingConfig.h"
+
+/**
+ * Filter stage types
+ */
+enum SensythingFilterType {
+    SENSYTHING_FILTER_BANDPASS = 0,              // Biquad band-pass between two corners
+    SENSYTHING_FILTER_NOTCH,                     // Biquad notch (mains hum)
+    SENSYTHING_FILTER_MOVING_AVERAGE,            // Boxcar average over N samples
+    SENSYTHING_FILTER_DC_BLOCK                   // One-pole high-pass (DC removal)
+};
+
+typedef struct {
+    SensythingFilterType type;
+    float param1;                                // Band-pass low, notch or DC cutoff (Hz); average length
+    float param2;                                // Band-pass high (Hz)
+    bool active;                                 // false if the design does not fit the sample rate
+
+    // Biquad (transposed direct form II), normalized so a0 = 1. The DC block
+    // uses b0 as its pole.
+    float b0, b1, b2, a1, a2;
+    float z1, z2;
+
+    // Moving average
+    float window[SENSYTHING_FILTER_MA_MAX_LENGTH];
+    float sum;
+    uint8_t index;
+    uint8_t filled;
+} SensythingFilterStage;
+
+/**
+ * Cascade of filter stages for one channel.
+ *
+ * Coefficients are designed for the sample rate given to setSampleRate(). A
+ * stage whose corner sits at or above Nyquist is rejected when added; one that
+ * ends up there after a rate change is kept but bypassed until the rate allows
+ * it again. process() is allocation-free and runs in the streaming context only.
+ */
+class SensythingFilterChain {
+public:
+    SensythingFilterChain();
+
+    /**
+     * Append a band-pass stage
+     * @param lowHz Lower corner
+     * @param highHz Upper corner
+     * @return true if added (false if the chain is full or the corners are invalid)
+     */
+    bool addBandPass(float lowHz, float highHz);
+
+    /**
+     * Append a notch stage (Q = SENSYTHING_FILTER_NOTCH_Q)
+     * @param hz Notch frequency, e.g. 50 or 60
+     * @return true if added
+     */
+    bool addNotch(float hz);
+
+    /**
+     * Append a moving average stage
+     * @param length Samples averaged (2 to SENSYTHING_FILTER_MA_MAX_LENGTH)
+     * @return true if added
+     */
+    bool addMovingAverage(uint8_t length);
+
+    /**
+     * Append a DC removal stage
+     * @param cutoffHz High-pass corner
+     * @return true if added
+     */
+    bool addDCBlock(float cutoffHz);
+
+    /**
+     * Remove all stages
+     */
+    void clear();
+
+    /**
+     * Redesign every stage for a new sample rate and clear the filter state
+     * @param hz Samples per second reaching the chain
+     */
+    void setSampleRate(float hz);
+
+    /**
+     * Run one sample through the chain
+     * @param x Input sample
+     * @return Filtered sample
+     */
+    float process(float x);
+
+    uint8_t getStageCount() const { return stageCount; }
+
+    /**
+     * Print the chain as "bandpass 0.50-5.00 Hz -> notch 50.00 Hz"
+     */
+    void print() const;
+
+private:
+    SensythingFilterStage stages[SENSYTHING_FILTER_MAX_STAGES];
+    uint8_t stageCount;
+    float sampleRateHz;
+
+    bool addStage(SensythingFilterType type, float param1, float param2);
+    void design(SensythingFilterStage& stage);
+    static void resetState(SensythingFilterStage& stage);
+};
+
+/**
+ * One filter chain per channel, with the per-sample cost of running them
+ */
+class SensythingFilterBank {
+public:
+    SensythingFilterBank();
+
+    /**
+     * Filter every channel of a sample in place. Channels flagged as failed
+     * (SENSYTHING_STATUS_CHn_FAIL) are left as they are and do not advance
+     * their chain.
+     * @param data Sample to filter
+     */
+    void process(MeasurementData& data);
+
+    /**
+     * Redesign all chains for a new sample rate
+     * @param hz Samples per second reaching the filters
+     */
+    void setSampleRate(float hz);
+
+    /**
+     * Remove every stage on every channel
+     */
+    void clear();
+
+    /**
+     * @return true if any channel has a stage
+     */
+    bool isActive() const { return active; }
+
+    SensythingFilterChain& getChain(uint8_t channel) { return chains[channel]; }
+
+    /**
+     * Mean cost of process() per sample
+     * @return CPU cycles (0 before the first filtered sample)
+     */
+    uint32_t getCyclesPerSample() const;
+
+    /**
+     * Print each channel's chain and the per-sample cost
+     * @param config Board configuration (channel labels)
+     */
+    void print(const BoardConfig& config) const;
+
+    /**
+     * Recount which channels are filtered and restart the cost figures;
+     * call after changing a chain
+     */
+    void refresh();
+
+private:
+    SensythingFilterChain chains[SENSYTHING_MAX_CHANNELS];
+    bool active;
+    uint64_t totalCycles;
+    uint32_t samples;
+};
+
+#endif // SENSYTHING_FILTER_H